@@ -17,6 +17,7 @@
 #include <fastjet/CDFMidPointPlugin.hh>
 #ifdef FASTJET_VERSION
 #include <fastjet/Selector.hh>
+#include <fastjet/CompositeJetStructure.hh>
 #include <fastjet/FunctionOfPseudoJet.hh>
 #include <fastjet/tools/JetMedianBackgroundEstimator.hh>
 #include <fastjet/tools/BackgroundEstimatorBase.hh>
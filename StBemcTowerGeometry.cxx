@@ -0,0 +1,94 @@
+//******************************************************************************
+//
+// StBemcTowerGeometry.cxx
+//
+// Authors: Joel Mazer
+//
+// Precomputed BEMC tower geometry with vertex-corrected eta/phi/cosh tables
+//
+//******************************************************************************
+
+#include "StBemcTowerGeometry.h"
+
+// C++ includes
+#include <math.h>
+
+// ROOT includes
+#include "TMath.h"
+
+// StRoot includes
+#include "StEmcUtil/geometry/StEmcGeom.h"
+
+ClassImp(StBemcTowerGeometry)
+
+//_______________________________________________________________________________________________
+StBemcTowerGeometry::StBemcTowerGeometry() : TObject(),
+  fFilled(kFALSE),
+  fVertex(0., 0., 0.)
+{
+  // tower positions - only needed once
+  StEmcGeom *geom = StEmcGeom::getEmcGeom("bemc");
+  for(int i = 0; i < kNTowers; i++) {
+    float xTower = 0., yTower = 0., zTower = 0.;
+    geom->getXYZ(i + 1, xTower, yTower, zTower);
+    fX[i] = xTower;
+    fY[i] = yTower;
+    fZ[i] = zTower;
+  }
+}
+//_______________________________________________________________________________________________
+StBemcTowerGeometry::~StBemcTowerGeometry()
+{
+}
+//
+// Function: set event vertex, recompute tower arrays only if it changed
+//_______________________________________________________________________________________________
+void StBemcTowerGeometry::SetVertex(const TVector3& vertex)
+{
+  if(fFilled && vertex == fVertex) return;
+
+  fVertex = vertex;
+  Fill();
+  fFilled = kTRUE;
+}
+//
+// Function: vertex-corrected tower arrays - one pass over all towers
+// - eta and phi follow TVector3::PseudoRapidity() and TVector3::Phi() conventions
+//_______________________________________________________________________________________________
+void StBemcTowerGeometry::Fill()
+{
+  const double twoPi = 2.0*TMath::Pi();
+  const double vx = fVertex.x(), vy = fVertex.y(), vz = fVertex.z();
+
+  for(int i = 0; i < kNTowers; i++) {
+    double x = fX[i] - vx;
+    double y = fY[i] - vy;
+    double z = fZ[i] - vz;
+    double rho = sqrt(x*x + y*y);
+    double r = sqrt(rho*rho + z*z);
+    double invR = (r > 0.) ? 1.0/r : 0.;
+
+    // cos(theta) = z/r, eta = -0.5 ln((1-cos)/(1+cos))
+    double cosTheta = z*invR;
+    fEta[i] = (cosTheta*cosTheta < 1.) ? -0.5*log((1.0 - cosTheta)/(1.0 + cosTheta)) : ((z > 0.) ? 10e10 : -10e10);
+
+    double phi = (x == 0. && y == 0.) ? 0. : atan2(y, x);
+    if(phi < 0.0) phi += twoPi;  // force from 0-2pi
+    fPhi[i] = phi;
+
+    fInvCosh[i] = rho*invR;      // sin(theta) = 1/cosh(eta)
+    fUx[i] = x*invR;
+    fUy[i] = y*invR;
+    fUz[i] = z*invR;
+  }
+}
+//
+// Function: tower position relative to vertex - same as StEmcPosition2::getPosFromVertex()
+//_______________________________________________________________________________________________
+TVector3 StBemcTowerGeometry::GetPosFromVertex(Int_t towerID) const
+{
+  if(towerID < 1 || towerID > kNTowers) return TVector3(0., 0., 0.);
+
+  int i = towerID - 1;
+  return TVector3(fX[i] - fVertex.x(), fY[i] - fVertex.y(), fZ[i] - fVertex.z());
+}
@@ -0,0 +1,68 @@
+//******************************************************************************
+//
+// StBemcTowerGeometry.h
+//
+// Authors: Joel Mazer
+//
+// Precomputed BEMC tower geometry: tower positions are read once from
+// StEmcGeom, the vertex-corrected eta, phi, 1/cosh(eta) and unit vectors
+// of all 4800 towers are filled in one pass when the vertex changes
+//
+//******************************************************************************
+
+#ifndef StBemcTowerGeometry_H
+#define StBemcTowerGeometry_H
+
+// ROOT includes
+#include "TObject.h"
+#include "TVector3.h"
+
+class StBemcTowerGeometry : public TObject
+{
+   public:
+
+    enum { kNTowers = 4800 };  // number of BEMC towers, towerID = 1 - 4800
+
+             StBemcTowerGeometry();
+    virtual  ~StBemcTowerGeometry();
+
+    // fill per-vertex arrays, does nothing if the vertex did not change
+    void              SetVertex(const TVector3& vertex);
+    const TVector3&   GetVertex() const                   { return fVertex; }
+
+    // accessors by tower ID (1 - 4800): same values as StEmcPosition2::getPosFromVertex(vertex, towerID)
+    Double_t          GetEta(Int_t towerID) const         { return fEta[towerID - 1]; }
+    Double_t          GetPhi(Int_t towerID) const         { return fPhi[towerID - 1]; }      // (0, 2pi)
+    Double_t          GetInvCosh(Int_t towerID) const     { return fInvCosh[towerID - 1]; }  // 1/cosh(eta) = sin(theta): Et = E * 1/cosh(eta)
+    Double_t          GetUx(Int_t towerID) const          { return fUx[towerID - 1]; }       // unit vector from vertex to tower
+    Double_t          GetUy(Int_t towerID) const          { return fUy[towerID - 1]; }
+    Double_t          GetUz(Int_t towerID) const          { return fUz[towerID - 1]; }
+    TVector3          GetPosFromVertex(Int_t towerID) const;
+
+    // contiguous arrays indexed by tower index (towerID - 1)
+    const Double_t   *GetEtaArray() const                 { return fEta; }
+    const Double_t   *GetPhiArray() const                 { return fPhi; }
+    const Double_t   *GetInvCoshArray() const             { return fInvCosh; }
+
+   private:
+    void              Fill();
+
+    Bool_t            fFilled;                            // per-vertex arrays filled
+    TVector3          fVertex;                            // vertex used for current arrays
+
+    // tower positions in STAR coordinates - fixed
+    Double_t          fX[kNTowers];
+    Double_t          fY[kNTowers];
+    Double_t          fZ[kNTowers];
+
+    // per-vertex arrays (SoA)
+    Double_t          fEta[kNTowers];
+    Double_t          fPhi[kNTowers];
+    Double_t          fInvCosh[kNTowers];
+    Double_t          fUx[kNTowers];
+    Double_t          fUy[kNTowers];
+    Double_t          fUz[kNTowers];
+
+    ClassDef(StBemcTowerGeometry, 1)
+};
+#endif
@@ -28,6 +28,7 @@
 
 // jet-framework includes
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 
 // old file kept
 #include "StPicoConstants.h"
@@ -383,13 +384,11 @@ Int_t StCentMaker::Make() {
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   int fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 30.0 GeV
@@ -510,11 +509,12 @@ Int_t StCentMaker::Make() {
   }
 
   // check for MB/HT event
-  bool fHaveMB5event   = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event  = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30); // MAIN
-  bool fHaveHT1Trigger = CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT1);
-  bool fHaveHT2Trigger = CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT2);   // MAIN
-  bool fHaveHT3Trigger = CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT3);
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMB5event   = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event  = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30); // MAIN
+  bool fHaveHT1Trigger = HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT1);
+  bool fHaveHT2Trigger = HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT2);   // MAIN
+  bool fHaveHT3Trigger = HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT3);
 
   //===========================================================================================================================
 //  StRefMultCorr *grefmultCorrUtil = CentralityMaker::instance()->getgRefMultCorr_P18ih_VpdMB30_AllLumi();
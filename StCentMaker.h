@@ -150,9 +150,6 @@ class StCentMaker : public StJetFrameworkPicoBase {
     TH1F *hMB30onlyrefCorr2RawTotal;//!
     TH1F *hMB5MB30refCorr2RawTotal;//!
 
-    // bad run list 
-    std::set<Int_t>        badRuns;
-
     // base class pointer object
     StJetFrameworkPicoBase *mBaseMaker;
 
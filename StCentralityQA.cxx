@@ -30,6 +30,7 @@
 
 // jet-framework includes
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 #include "StFemtoTrack.h"
 
 // old file kept
@@ -313,15 +314,11 @@ Int_t StCentralityQA::Make() {
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-  deadTowers = mBaseMaker->GetDeadTowers();
-  badTowers = mBaseMaker->GetBadTowers();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 30.0 GeV
@@ -480,10 +477,11 @@ Int_t StCentralityQA::Make() {
   cout<<endl;
 
   // check for MB/HT event
-  bool fHaveMBevent = CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30); 
-  bool fHaveEmcTrigger = CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent = HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30); 
+  bool fHaveEmcTrigger = HasHTTrigger(fTrigMask, fEmcTriggerEventType);
 
   // fill arrays for towers that fired trigger
   FillTowerTriggersArr();
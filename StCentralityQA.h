@@ -126,13 +126,6 @@ class StCentralityQA : public StJetFrameworkPicoBase {
     TH1  *hTriggerIds;//!
     TH1  *hEmcTriggers;//!
 
-    // bad and dead tower list set
-    std::set<Int_t>        badTowers;
-    std::set<Int_t>        deadTowers;
-
-    // bad run list set
-    std::set<Int_t>        badRuns;
-
     // base class pointer object
     StJetFrameworkPicoBase *mBaseMaker;
 
@@ -34,6 +34,7 @@
 
 // jet-framework includes
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 #include "StRhoParameter.h"
 #include "StRho.h"
 #include "StJetMakerTask.h"
@@ -232,15 +233,11 @@ Int_t StDummyMaker::Make() {
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-  deadTowers = mBaseMaker->GetDeadTowers();
-  badTowers = mBaseMaker->GetBadTowers();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   //for(int i = 1; i<4801; i++) {  if(!mBaseMaker->IsTowerOK(i))  cout<<"tower: "<<i<<" is not good!!"<<endl;  }
@@ -310,10 +307,11 @@ Int_t StDummyMaker::Make() {
   if(fDebugLevel == StJetFrameworkPicoBase::kDebugEmcTrigger) cout<<endl;
 
   // check for MB/HT event
-  bool fHaveMBevent = CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-  bool fHaveEmcTrigger = CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent = HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  bool fHaveEmcTrigger = HasHTTrigger(fTrigMask, fEmcTriggerEventType);
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if(doppAnalysis)  fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;
   if(!doppAnalysis) fRunForMB = (fHaveMB5event || fHaveMB30event) ? kTRUE : kFALSE;
@@ -333,7 +331,7 @@ Int_t StDummyMaker::Make() {
   }
 
   // get jet collection associated with JetMaker
-  fJets = static_cast<TClonesArray*>(JetMaker->GetJets());
+  fJets = GetJetArray(JetMaker);
   if(!fJets) {
     LOG_WARN << Form(" No fJets object! Skip! ") << endm;
     return kStWarn;
@@ -428,7 +426,7 @@ void StDummyMaker::RunJets()
 
 /*
     // TEST - when using constituent subtractor
-    vector<fastjet::PseudoJet> fConstituents = jet->GetJetConstituents();
+    const vector<fastjet::PseudoJet> &fConstituents = jet->GetJetConstituents();
     for(UInt_t ic = 0; ic < fConstituents.size(); ++ic) {
       // get user defined index
       Int_t uid = fConstituents[ic].user_index();
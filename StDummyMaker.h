@@ -125,13 +125,6 @@ class StDummyMaker : public StJetFrameworkPicoBase {
     TH1F *hJetPt;//!
     TH1F *hJetCorrPt;//!
 
-    // bad and dead tower list
-    std::set<Int_t>        badTowers;
-    std::set<Int_t>        deadTowers;
-
-    // bad run list
-    std::set<Int_t>        badRuns;
-
     // base class pointer object
     StJetFrameworkPicoBase *mBaseMaker;
 
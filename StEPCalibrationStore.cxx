@@ -0,0 +1,238 @@
+//******************************************************************************
+//
+// StEPCalibrationStore.cxx
+//
+// Authors: Joel Mazer
+//
+// Binary, memory-mapped event plane calibration store
+//
+//******************************************************************************
+
+#include "StEPCalibrationStore.h"
+
+// C++ includes
+#include <iostream>
+#include <string.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// ROOT includes
+#include "TMath.h"
+#include "TSystem.h"
+
+using std::cout;
+using std::endl;
+
+ClassImp(StEPCalibrationStore)
+
+namespace {
+  const char   kMagic[8] = {'S', 'T', 'E', 'P', 'C', 'A', 'L', '\0'};
+  const UInt_t kByteOrder = 0x01020304;
+  const UInt_t kHeaderSize = 8 + 4*sizeof(UInt_t);
+}
+
+//_______________________________________________________________________________________________
+StEPCalibrationStore::StEPCalibrationStore() : TObject(),
+  fFileName(""),
+  fMap(0x0),
+  fMapSize(0),
+  fMapped(kFALSE),
+  fEntries(0x0),
+  fNEntries(0),
+  fData(0x0)
+{
+}
+
+//_______________________________________________________________________________________________
+StEPCalibrationStore::~StEPCalibrationStore()
+{ /*  */
+  // destructor
+  Close();
+}
+//
+// Function: map calibration file into memory and check header
+//_______________________________________________________________________________________________
+Bool_t StEPCalibrationStore::Open(const char *fileName)
+{
+  Close();
+
+  TString name = fileName;
+  gSystem->ExpandPathName(name);
+
+  int fd = open(name.Data(), O_RDONLY);
+  if(fd < 0) {
+    cout<<"StEPCalibrationStore: can't open "<<name<<endl;
+    return kFALSE;
+  }
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (ULong64_t)st.st_size < kHeaderSize) {
+    cout<<"StEPCalibrationStore: "<<name<<" is not a calibration file!"<<endl;
+    close(fd);
+    return kFALSE;
+  }
+  fMapSize = st.st_size;
+
+  // map read-only, fall back to reading into memory if mmap is not available
+  void *map = mmap(0x0, fMapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(map != MAP_FAILED) {
+    fMap = map;
+    fMapped = kTRUE;
+  } else {
+    fMap = new char[fMapSize];
+    fMapped = kFALSE;
+    if(pread(fd, fMap, fMapSize, 0) != (ssize_t)fMapSize) {
+      cout<<"StEPCalibrationStore: read error for "<<name<<endl;
+      close(fd);
+      Close();
+      return kFALSE;
+    }
+  }
+  close(fd);
+
+  // header
+  const char *base = static_cast<const char*>(fMap);
+  const UInt_t *head = reinterpret_cast<const UInt_t*>(base + 8);
+  UInt_t version = head[0], byteOrder = head[1], nEntries = head[2];
+  if(memcmp(base, kMagic, 8) != 0 || byteOrder != kByteOrder) {
+    cout<<"StEPCalibrationStore: "<<name<<" is not a calibration file or has different byte order!"<<endl;
+    Close();
+    return kFALSE;
+  }
+  if(version != kVersion) {
+    cout<<"StEPCalibrationStore: "<<name<<" has version "<<version<<", expected "<<kVersion<<endl;
+    Close();
+    return kFALSE;
+  }
+
+  ULong64_t dataStart = kHeaderSize + (ULong64_t)nEntries*sizeof(StEPCalibEntry);
+  if(dataStart > fMapSize) {
+    cout<<"StEPCalibrationStore: "<<name<<" is truncated!"<<endl;
+    Close();
+    return kFALSE;
+  }
+
+  // check that all tables are inside the file
+  const StEPCalibEntry *entries = reinterpret_cast<const StEPCalibEntry*>(base + kHeaderSize);
+  ULong64_t nData = (fMapSize - dataStart)/sizeof(Double_t);
+  for(UInt_t i = 0; i < nEntries; i++) {
+    if(entries[i].offset + entries[i].nValues > nData) {
+      cout<<"StEPCalibrationStore: "<<name<<" is truncated!"<<endl;
+      Close();
+      return kFALSE;
+    }
+  }
+
+  fFileName = name;
+  fEntries = entries;
+  fNEntries = nEntries;
+  fData = reinterpret_cast<const Double_t*>(base + dataStart);
+
+  cout<<"StEPCalibrationStore: mapped "<<fNEntries<<" tables from "<<fFileName<<endl;
+  return kTRUE;
+}
+//
+// Function: unmap file - table pointers are invalid afterwards
+//_______________________________________________________________________________________________
+void StEPCalibrationStore::Close()
+{
+  if(fMap) {
+    if(fMapped) munmap(fMap, fMapSize);
+    else        delete [] static_cast<char*>(fMap);
+  }
+
+  fMap = 0x0;
+  fMapSize = 0;
+  fMapped = kFALSE;
+  fEntries = 0x0;
+  fNEntries = 0;
+  fData = 0x0;
+}
+//
+// Function: jet radius key - R x 100
+//_______________________________________________________________________________________________
+Int_t StEPCalibrationStore::JetRadKey(Double_t jetRad)
+{
+  return (jetRad < 0.) ? -1 : TMath::Nint(100.*jetRad);
+}
+//
+// Function: find index entry - linear search, only used when resolving tables at Init
+//_______________________________________________________________________________________________
+const StEPCalibEntry *StEPCalibrationStore::FindEntry(Int_t runFlag, Int_t detector, Int_t jetType, Double_t jetRad, Int_t ptBin, Int_t method, Int_t table) const
+{
+  int jetRadKey = JetRadKey(jetRad);
+  for(UInt_t i = 0; i < fNEntries; i++) {
+    const StEPCalibEntry &e = fEntries[i];
+    if(e.runFlag == runFlag && e.detector == detector && e.jetType == jetType && e.jetRad == jetRadKey &&
+       e.ptBin == ptBin && e.method == method && e.table == table) return &e;
+  }
+
+  return 0x0;
+}
+//
+// Function: pointer to first value of a table
+//_______________________________________________________________________________________________
+const Double_t *StEPCalibrationStore::GetTable(Int_t runFlag, Int_t detector, Int_t jetType, Double_t jetRad, Int_t ptBin, Int_t method, Int_t table, UInt_t nValues) const
+{
+  const StEPCalibEntry *e = FindEntry(runFlag, detector, jetType, jetRad, ptBin, method, table);
+  if(!e) return 0x0;
+  if(nValues > 0 && e->nValues != nValues) {
+    cout<<"StEPCalibrationStore: table has "<<e->nValues<<" values, expected "<<nValues<<" - not used!"<<endl;
+    return 0x0;
+  }
+
+  return fData + e->offset;
+}
+//
+// Function: number of values of a table, 0 if not in file
+//_______________________________________________________________________________________________
+UInt_t StEPCalibrationStore::GetTableSize(Int_t runFlag, Int_t detector, Int_t jetType, Double_t jetRad, Int_t ptBin, Int_t method, Int_t table) const
+{
+  const StEPCalibEntry *e = FindEntry(runFlag, detector, jetType, jetRad, ptBin, method, table);
+  return (e) ? e->nValues : 0;
+}
+//
+// Function: add a table for writing
+//_______________________________________________________________________________________________
+void StEPCalibrationStore::AddTable(Int_t runFlag, Int_t detector, Int_t jetType, Double_t jetRad, Int_t ptBin, Int_t method, Int_t table, const Double_t *values, UInt_t nValues)
+{
+  StEPCalibEntry e;
+  e.runFlag = runFlag;
+  e.detector = detector;
+  e.jetType = jetType;
+  e.jetRad = JetRadKey(jetRad);
+  e.ptBin = ptBin;
+  e.method = method;
+  e.table = table;
+  e.nValues = nValues;
+  e.offset = fNewData.size();
+
+  fNewEntries.push_back(e);
+  fNewData.insert(fNewData.end(), values, values + nValues);
+}
+//
+// Function: write added tables to file
+//_______________________________________________________________________________________________
+Bool_t StEPCalibrationStore::WriteFile(const char *fileName) const
+{
+  FILE *fp = fopen(fileName, "wb");
+  if(!fp) {
+    cout<<"StEPCalibrationStore: can't create "<<fileName<<endl;
+    return kFALSE;
+  }
+
+  UInt_t head[4] = {kVersion, kByteOrder, (UInt_t)fNewEntries.size(), 0};
+  bool ok = (fwrite(kMagic, 1, 8, fp) == 8);
+  ok = ok && (fwrite(head, sizeof(UInt_t), 4, fp) == 4);
+  if(!fNewEntries.empty()) ok = ok && (fwrite(&fNewEntries[0], sizeof(StEPCalibEntry), fNewEntries.size(), fp) == fNewEntries.size());
+  if(!fNewData.empty())    ok = ok && (fwrite(&fNewData[0], sizeof(Double_t), fNewData.size(), fp) == fNewData.size());
+  fclose(fp);
+
+  if(!ok) { cout<<"StEPCalibrationStore: write error for "<<fileName<<endl; return kFALSE; }
+
+  cout<<"StEPCalibrationStore: wrote "<<fNewEntries.size()<<" tables to "<<fileName<<endl;
+  return kTRUE;
+}
@@ -0,0 +1,95 @@
+//******************************************************************************
+//
+// StEPCalibrationStore.h
+//
+// Authors: Joel Mazer
+//
+// Binary event plane calibration store: recentering and shift tables for
+// BBC, ZDC and TPC are kept in one versioned file which is memory-mapped,
+// each table is found by (run flag, detector, jet type, jet R, pt bin, method)
+// and used through a flat pointer
+//
+// file layout (native byte order, 8-byte aligned):
+//   header:  char magic[8], UInt_t version, UInt_t byteOrder, UInt_t nEntries, UInt_t (unused)
+//   index:   StEPCalibEntry[nEntries]
+//   data:    Double_t values of all tables
+//
+//******************************************************************************
+
+#ifndef StEPCalibrationStore_H
+#define StEPCalibrationStore_H
+
+// ROOT includes
+#include "TObject.h"
+#include "TString.h"
+#include <vector>
+
+// index entry of one calibration table
+struct StEPCalibEntry {
+  Int_t     runFlag;     // StJetFrameworkPicoBase::fRunFlagEnum
+  Int_t     detector;    // StEventPlaneMaker::fDetectorType
+  Int_t     jetType;     // StJetFrameworkPicoBase::fJetTypeEnum, -1 if not jet dependent
+  Int_t     jetRad;      // jet radius x 100, -1 if not jet dependent
+  Int_t     ptBin;       // pt assoc bin, -1 for all tracks
+  Int_t     method;      // StJetFrameworkPicoBase::fTPCEPmethodEnum, -1 if not jet dependent
+  Int_t     table;       // StEPCalibrationStore::fTableType
+  UInt_t    nValues;     // number of Double_t values
+  ULong64_t offset;      // first value, in units of Double_t from start of data block
+};
+
+class StEPCalibrationStore : public TObject
+{
+   public:
+
+    // table types and layouts
+    //   TPC recenter: [4][9][20]       Qnx, Qny, Qpx, Qpy  x  [ref9][region_vz]
+    //   TPC shift:    [2][9][20][20]   N, P  x  [ref9][region_vz][nharm-1]
+    //   BBC/ZDC recenter: [4][nRuns]  ex, ey, wx, wy  x  [run index]
+    //   BBC/ZDC shift:    [2][9][20][20]   A, B  x  [ref9][region_vz][nharm-1]
+    enum fTableType { kRecenter = 0, kShift = 1 };
+
+    enum { kVersion = 1 };
+    enum { kNRef9 = 9, kNVzRegions = 20, kNHarmonics = 20 };
+    enum { kNShiftValues = 2*kNRef9*kNVzRegions*kNHarmonics, kNTPCRecenterValues = 4*kNRef9*kNVzRegions };
+
+             StEPCalibrationStore();
+    virtual  ~StEPCalibrationStore();
+
+    // reading: map file into memory, tables stay valid until Close()
+    Bool_t            Open(const char *fileName);
+    void              Close();
+    Bool_t            IsOpen() const                     { return (fData != 0x0); }
+    const char       *GetFileName() const                { return fFileName.Data(); }
+
+    // table lookup, 0x0 if not in file or nValues differs (nValues = 0: any size)
+    const Double_t   *GetTable(Int_t runFlag, Int_t detector, Int_t jetType, Double_t jetRad, Int_t ptBin, Int_t method, Int_t table, UInt_t nValues = 0) const;
+    UInt_t            GetTableSize(Int_t runFlag, Int_t detector, Int_t jetType, Double_t jetRad, Int_t ptBin, Int_t method, Int_t table) const;
+    Int_t             GetNTables() const                 { return (Int_t)fNEntries; }
+
+    // writing: collect tables, then write file (used by macros/makeEPCalibrationStore.C)
+    void              AddTable(Int_t runFlag, Int_t detector, Int_t jetType, Double_t jetRad, Int_t ptBin, Int_t method, Int_t table, const Double_t *values, UInt_t nValues);
+    Bool_t            WriteFile(const char *fileName) const;
+
+    // flat index of tables
+    static Int_t      TPCRecenterIndex(Int_t comp, Int_t ref9, Int_t region_vz)    { return (comp*kNRef9 + ref9)*kNVzRegions + region_vz; }
+    static Int_t      ShiftIndex(Int_t comp, Int_t ref9, Int_t region_vz, Int_t nharm) { return ((comp*kNRef9 + ref9)*kNVzRegions + region_vz)*kNHarmonics + nharm - 1; }
+
+   private:
+    const StEPCalibEntry *FindEntry(Int_t runFlag, Int_t detector, Int_t jetType, Double_t jetRad, Int_t ptBin, Int_t method, Int_t table) const;
+    static Int_t      JetRadKey(Double_t jetRad);
+
+    TString           fFileName;                    // mapped file
+    void             *fMap;                         //! start of mapped file
+    ULong64_t         fMapSize;                     //  size of mapped file
+    Bool_t            fMapped;                      //  kTRUE: mmap, kFALSE: read into memory
+    const StEPCalibEntry *fEntries;                 //! index of tables
+    UInt_t            fNEntries;                    //  number of tables
+    const Double_t   *fData;                        //! data block
+
+    // tables added for writing
+    std::vector<StEPCalibEntry> fNewEntries;        //!
+    std::vector<Double_t> fNewData;                 //!
+
+    ClassDef(StEPCalibrationStore, 1)
+};
+#endif
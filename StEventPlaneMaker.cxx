@@ -40,11 +40,15 @@
 
 // jet-framework includes
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 #include "StRhoParameter.h"
 #include "StRho.h"
 #include "StJetMakerTask.h"
 #include "StPicoEPCorrectionsIncludes.h"
 #include "StCentMaker.h"
+#include "StTrackCacheMaker.h"
+#include "StTrackEtaPhiGrid.h"
+#include "StEPCalibrationStore.h"
 
 // old file kept
 #include "StPicoConstants.h"
@@ -90,6 +94,14 @@ StEventPlaneMaker::StEventPlaneMaker(const char *name, StPicoDstMaker *picoMaker
   fJets = 0x0;
   fRunNumber = 0;
   fEPcalibFileName = "$STROOT_CALIB/eventplaneFlat.root";
+  fEPcalibStoreFileName = "";
+  fEPCalibStore = 0x0;
+  for(int im = 0; im < kNTPCEPmethods; im++) {
+    for(int ib = 0; ib < kNTPCptAssocBins; ib++) { fTPCRecenterTab[im][ib] = 0x0; fTPCShiftTab[im][ib] = 0x0; }
+  }
+  fBBCRecenterTab = 0x0; fZDCRecenterTab = 0x0;
+  fBBCRecenterNRuns = 0; fZDCRecenterNRuns = 0;
+  fBBCShiftTab = 0x0; fZDCShiftTab = 0x0;
   fEPTPCn = 0.; fEPTPCp = 0.; fEPTPC = 0.; fEPBBC = 0.; fEPZDC = 0.;
   fCalibFile = 0x0; fCalibFile2 = 0x0;
   mPicoDstMaker = 0x0;
@@ -112,6 +124,12 @@ StEventPlaneMaker::StEventPlaneMaker(const char *name, StPicoDstMaker *picoMaker
   doEventPlaneRes = kFALSE;
   doTPCptassocBin = kFALSE;
   fTPCptAssocBin = -99;
+  doAllTPCptAssocBins = kFALSE;
+  for(int im = 0; im < kNTPCEPmethods; im++) {
+    for(int ib = 0; ib < kNTPCptAssocBins; ib++) {
+      fTPCEPbin[im][ib] = -999; fTPCAEPbin[im][ib] = -999; fTPCBEPbin[im][ib] = -999;
+    }
+  }
   doReadCalibFile = kFALSE;
   doRejectBadRuns = kFALSE;
   fEmcTriggerEventType = 0; // see StJetFrameworkPicoBase::fEmcTriggerFlagEnum
@@ -261,6 +279,7 @@ StEventPlaneMaker::~StEventPlaneMaker()
     }
   }
 
+  if(fEPCalibStore)  delete fEPCalibStore;
 }
 //
 //
@@ -269,12 +288,26 @@ Int_t StEventPlaneMaker::Init() {
   // initialize the histograms
   DeclareHistograms();
 
+  // all pt assoc bins in one maker: Q-vectors are split into random sub-events as in pt assoc bin mode
+  // histograms and calibration profiles are filled for the configured bin (default: 2.0-20.0 GeV bin)
+  if(doAllTPCptAssocBins) {
+    doTPCptassocBin = kTRUE;
+    if(fTPCptAssocBin < 0 || fTPCptAssocBin >= kNTPCptAssocBins) fTPCptAssocBin = kNTPCptAssocBins - 1;
+  }
+
   if(tpc_recenter_read_switch || bbc_recenter_read_switch || zdc_recenter_read_switch) {
   }
 
   if(tpc_shift_read_switch || bbc_shift_read_switch || zdc_shift_read_switch) {
   }
 
+  // map binary calibration store and resolve the tables used by this maker once
+  if(fEPcalibStoreFileName != "") {
+    fEPCalibStore = new StEPCalibrationStore();
+    if(fEPCalibStore->Open(fEPcalibStoreFileName.Data())) ResolveCalibrationTables();
+    else LOG_WARN << "Event plane calibration store " << fEPcalibStoreFileName << " not available, using compiled-in corrections!" << endm;
+  }
+
   // Calibration parameters can be read in from .root files or from various header function
   // will need to uncomment the below and in the BBC, ZDC, and TPC functions
   // initialize calibration file for event plane
@@ -296,6 +329,36 @@ Int_t StEventPlaneMaker::Init() {
   return kStOK;
 }
 //
+// Function: resolve calibration table pointers from binary store
+// - done once at Init, per event corrections are direct indexed loads
+//_______________________________________________________________________________________
+void StEventPlaneMaker::ResolveCalibrationTables() {
+  if(!fEPCalibStore || !fEPCalibStore->IsOpen()) return;
+
+  // TPC: per method and pt assoc bin for this jet type and radius
+  int nTPC = 0;
+  for(int im = 0; im < kNTPCEPmethods; im++) {
+    for(int ib = 0; ib < kNTPCptAssocBins; ib++) {
+      fTPCRecenterTab[im][ib] = fEPCalibStore->GetTable(fRunFlag, kTPC, fJetType, fJetRad, ib, im, StEPCalibrationStore::kRecenter, StEPCalibrationStore::kNTPCRecenterValues);
+      fTPCShiftTab[im][ib] = fEPCalibStore->GetTable(fRunFlag, kTPC, fJetType, fJetRad, ib, im, StEPCalibrationStore::kShift, StEPCalibrationStore::kNShiftValues);
+      if(fTPCRecenterTab[im][ib]) nTPC++;
+      if(fTPCShiftTab[im][ib]) nTPC++;
+    }
+  }
+
+  // BBC and ZDC: not jet dependent, recentering per run
+  fBBCRecenterNRuns = fEPCalibStore->GetTableSize(fRunFlag, kBBC, -1, -1., -1, -1, StEPCalibrationStore::kRecenter) / 4;
+  fZDCRecenterNRuns = fEPCalibStore->GetTableSize(fRunFlag, kZDC, -1, -1., -1, -1, StEPCalibrationStore::kRecenter) / 4;
+  fBBCRecenterTab = fEPCalibStore->GetTable(fRunFlag, kBBC, -1, -1., -1, -1, StEPCalibrationStore::kRecenter, 4*fBBCRecenterNRuns);
+  fZDCRecenterTab = fEPCalibStore->GetTable(fRunFlag, kZDC, -1, -1., -1, -1, StEPCalibrationStore::kRecenter, 4*fZDCRecenterNRuns);
+  fBBCShiftTab = fEPCalibStore->GetTable(fRunFlag, kBBC, -1, -1., -1, -1, StEPCalibrationStore::kShift, StEPCalibrationStore::kNShiftValues);
+  fZDCShiftTab = fEPCalibStore->GetTable(fRunFlag, kZDC, -1, -1., -1, -1, StEPCalibrationStore::kShift, StEPCalibrationStore::kNShiftValues);
+  if(!fBBCRecenterTab) fBBCRecenterNRuns = 0;
+  if(!fZDCRecenterTab) fZDCRecenterNRuns = 0;
+
+  cout<<"StEventPlaneMaker: resolved "<<nTPC<<" TPC tables, BBC "<<fBBCRecenterNRuns<<" runs, ZDC "<<fZDCRecenterNRuns<<" runs from calibration store"<<endl;
+}
+//
 //
 //_______________________________________________________________________________________
 Int_t StEventPlaneMaker::Finish() { 
@@ -717,6 +780,11 @@ Int_t StEventPlaneMaker::Make() {
   // - this ensures a past event value somehow doesn't get re-used (Apr2020)
   fCentralityScaled = 0.0, ref9 = 0, ref16 = 0;
   TPC_PSI2 = -999; TPCA_PSI2 = -999; TPCB_PSI2 = -999;
+  for(int im = 0; im < kNTPCEPmethods; im++) {
+    for(int ib = 0; ib < kNTPCptAssocBins; ib++) {
+      fTPCEPbin[im][ib] = -999; fTPCAEPbin[im][ib] = -999; fTPCBEPbin[im][ib] = -999;
+    }
+  }
   BBC_PSI2 = -999;  ZDC_PSI2 = -999;
   BBC_PSI1 = -999;  ZDC_PSI1 = -999;
   PSI2 = -999;  RES = -999;
@@ -756,15 +824,16 @@ Int_t StEventPlaneMaker::Make() {
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
+  // get shared track cache (0x0 if not in chain or not current)
+  GetTrackCache();
+
   // cut event on max track pt > 30.0 GeV
   if(GetMaxTrackPt() > fMaxEventTrackPt) return kStOK;
 
@@ -823,10 +892,11 @@ Int_t StEventPlaneMaker::Make() {
   FillEmcTriggersHist(hEmcTriggers);
  
   // check for MB and HT triggers - Type Flag corresponds to selected type of MB or EMC
-  bool fHaveMBevent = CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-  bool fHaveEmcTrigger = CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent = HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  bool fHaveEmcTrigger = HasHTTrigger(fTrigMask, fEmcTriggerEventType);
 
   // switches for Event Plane analysis
   Bool_t doEPAnalysis = kFALSE;  // set false by default
@@ -850,7 +920,7 @@ Int_t StEventPlaneMaker::Make() {
   }
 
   // get jet collection associated with JetMaker
-  fJets = static_cast<TClonesArray*>(JetMaker->GetJets());
+  fJets = GetJetArray(JetMaker);
   if(!fJets) {
     LOG_WARN << Form(" No fJets object! Skip! ") << endm;
     return kStWarn;
@@ -893,10 +963,18 @@ Int_t StEventPlaneMaker::Make() {
   int region_vz = GetVzRegion(zVtx);
   if(region_vz > 900) return kStOK;
 
+  // tracks to remove around the leading jets for the TPC event plane
+  FlagJetRemovalTracks();
+
   // get BBC, ZDC, TPC event planes
   BBC_EP_Cal(ref9, region_vz, 2);
   ZDC_EP_Cal(ref9, region_vz, 2);  // will probably want n=1 for ZDC
-  EventPlaneCal(ref9, region_vz, 2, fTPCptAssocBin);
+  if(doAllTPCptAssocBins) {
+    // one track loop for all pt assoc bins and TPC methods
+    EventPlaneCalAllBins(ref9, region_vz, 2);
+  } else {
+    EventPlaneCal(ref9, region_vz, 2, fTPCptAssocBin);
+  }
   hEventPlane->Fill(TPC_PSI2);
   //cout<<"print2:  TPC_PSI2: "<<TPC_PSI2<<"  TPCA_PSI2: "<<TPCA_PSI2<<"  TPCB_PSI2: "<<TPCB_PSI2<<endl;
 
@@ -1147,25 +1225,34 @@ void StEventPlaneMaker::GetEventPlane(Bool_t flattenEP, Int_t n, Int_t method, D
   int nTOT = 0, nA = 0, nB = 0;
   int nTrack = mPicoDst->numberOfTracks();
   for(int i = 0; i < nTrack; i++) {
-    // get track pointer
-    StPicoTrack *track = static_cast<StPicoTrack*>(mPicoDst->track(i));
-    if(!track) { continue; }
-
-    // apply standard track cuts - (can apply more restrictive cuts below)
-    if(!(AcceptTrack(track, Bfield, mVertex))) { continue; }
-
-    // primary track switch: get momentum vector of track - global or primary track
-    TVector3 mTrkMom;
-    if(doUsePrimTracks) { // get primary track vector
-      mTrkMom = track->pMom();
-    } else {              // get global track vector
-      mTrkMom = track->gMom(mVertex, Bfield);
-    }
-
     // track variables
-    double pt = mTrkMom.Perp();
-    double phi = mTrkMom.Phi();
-    double eta = mTrkMom.PseudoRapidity();
+    double pt, phi, eta;
+    if(mTrackCache) {
+      // use kinematics cached once per event, phi already (0, 2pi)
+      if(!(AcceptTrack(mTrackCache, i))) { continue; }
+      pt = mTrackCache->GetPt(i);
+      phi = mTrackCache->GetPhi(i);
+      eta = mTrackCache->GetEta(i);
+    } else {
+      // get track pointer
+      StPicoTrack *track = static_cast<StPicoTrack*>(mPicoDst->track(i));
+      if(!track) { continue; }
+
+      // apply standard track cuts - (can apply more restrictive cuts below)
+      if(!(AcceptTrack(track, Bfield, mVertex))) { continue; }
+
+      // primary track switch: get momentum vector of track - global or primary track
+      TVector3 mTrkMom;
+      if(doUsePrimTracks) { // get primary track vector
+        mTrkMom = track->pMom();
+      } else {              // get global track vector
+        mTrkMom = track->gMom(mVertex, Bfield);
+      }
+
+      pt = mTrkMom.Perp();
+      phi = mTrkMom.Phi();
+      eta = mTrkMom.PseudoRapidity();
+    }
 
     // should set a soft pt range (0.2 - 5.0?)
     // more acceptance cuts now - after getting 3-vector
@@ -1412,7 +1499,12 @@ Int_t StEventPlaneMaker::BBC_EP_Cal(int ref9, int region_vz, int n) { //refmult,
   if(bbc_shift_read_switch) {
     // Method 1: reading values from a function in a *.h file
     // recentering procedure
-    if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
+    if(fBBCRecenterTab && RunId_Order >= 0 && RunId_Order < fBBCRecenterNRuns) {
+      sumcos_E -= fBBCRecenterTab[RunId_Order];
+      sumsin_E -= fBBCRecenterTab[fBBCRecenterNRuns + RunId_Order];
+      sumcos_W -= fBBCRecenterTab[2*fBBCRecenterNRuns + RunId_Order];
+      sumsin_W -= fBBCRecenterTab[3*fBBCRecenterNRuns + RunId_Order];
+    } else if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
       sumcos_E -= bbc_center_ex_Run14[RunId_Order];
       sumsin_E -= bbc_center_ey_Run14[RunId_Order];
       sumcos_W -= bbc_center_wx_Run14[RunId_Order];
@@ -1497,23 +1589,23 @@ Int_t StEventPlaneMaker::BBC_EP_Cal(int ref9, int region_vz, int n) { //refmult,
   double bbc_delta_psi = 0.;	
   double bbc_shift_Aval = 0., bbc_shift_Bval = 0.; // comment in with code chunk below
   if(bbc_apply_corr_switch) { // need to have ran recentering + shift prior
-    for(int nharm = 1; nharm < 21; nharm++){
-      // Method 1: load from *.h file function
-      // perform 'shift' to BBC event plane angle
-      ////bbc_delta_psi += (bbc_shift_A[ref9][region_vz][z-1]*cos(2*z*bPhi_rcd) + bbc_shift_B[ref9][region_vz][z-1]*sin(2*z*bPhi_rcd)); 
-      ///bbc_delta_psi += (bbc_shift_A[ref9][region_vz][nharm-1] * cos(2*nharm*bPhi_rcd) + 
-      ///                  bbc_shift_B[ref9][region_vz][nharm-1] * sin(2*nharm*bPhi_rcd));
-
-      // recentering procedure
-      if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
-        bbc_delta_psi += (bbc_shift_A_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*bPhi_rcd) +
-                          bbc_shift_B_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*bPhi_rcd));
-      } else if(fRunFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
-        bbc_delta_psi += (bbc_shift_A[ref9][region_vz][nharm-1] * cos(2*nharm*bPhi_rcd) +
-                          bbc_shift_B[ref9][region_vz][nharm-1] * sin(2*nharm*bPhi_rcd));
-      }
+    // Method 1: load from *.h file function (or binary calibration store) - all 20 harmonics in one pass
+    // perform 'shift' to BBC event plane angle
+    const Double_t *bbcShiftA = 0x0, *bbcShiftB = 0x0;
+    if(fBBCShiftTab) {
+      bbcShiftA = fBBCShiftTab + StEPCalibrationStore::ShiftIndex(0, ref9, region_vz, 1);
+      bbcShiftB = fBBCShiftTab + StEPCalibrationStore::ShiftIndex(1, ref9, region_vz, 1);
+    } else if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
+      bbcShiftA = bbc_shift_A_Run14[ref9][region_vz];
+      bbcShiftB = bbc_shift_B_Run14[ref9][region_vz];
+    } else if(fRunFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
+      bbcShiftA = bbc_shift_A[ref9][region_vz];
+      bbcShiftB = bbc_shift_B[ref9][region_vz];
+    }
+    bbc_delta_psi = ShiftCorrection(bPhi_rcd, bbcShiftA, bbcShiftB, kMaxShiftHarmonics);
 
 /*
+    for(int nharm = 1; nharm < 21; nharm++){
       // reading in from file
       if(fCalibFile2 && doReadCalibFile){
         // Method 2: load from *.root calibration file
@@ -1531,9 +1623,8 @@ Int_t StEventPlaneMaker::BBC_EP_Cal(int ref9, int region_vz, int n) { //refmult,
         delete htempBBC_ShiftA;
         delete htempBBC_ShiftB;
       }
-*/
-
     }
+*/
 
   }
 
@@ -1743,21 +1834,23 @@ Int_t StEventPlaneMaker::ZDC_EP_Cal(int ref9, int region_vz, int n) {
   double zdc_delta_psi = 0.;
   double zdc_shift_Aval = 0., zdc_shift_Bval = 0.; // comment in with below code chunk
   if(zdc_apply_corr_switch) { // need to have ran recentering + shift prior
-    for(int nharm = 1; nharm < 21; nharm++){
-      // Method 1: load from *.h file function
-      // perform 'shift' to ZDC event plane angle
-      ///zdc_delta_psi += (zdc_shift_A[ref9][region_vz][nharm-1] * cos(2*nharm*zPhi_rcd) +
-      ///                  zdc_shift_B[ref9][region_vz][nharm-1] * sin(2*nharm*zPhi_rcd));
-
-      if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
-        zdc_delta_psi += (zdc_shift_A_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*zPhi_rcd) +
-                          zdc_shift_B_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*zPhi_rcd));
-      } else if(fRunFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
-        zdc_delta_psi += (zdc_shift_A[ref9][region_vz][nharm-1] * cos(2*nharm*zPhi_rcd) +
-                          zdc_shift_B[ref9][region_vz][nharm-1] * sin(2*nharm*zPhi_rcd));
-      }
+    // Method 1: load from *.h file function (or binary calibration store) - all 20 harmonics in one pass
+    // perform 'shift' to ZDC event plane angle
+    const Double_t *zdcShiftA = 0x0, *zdcShiftB = 0x0;
+    if(fZDCShiftTab) {
+      zdcShiftA = fZDCShiftTab + StEPCalibrationStore::ShiftIndex(0, ref9, region_vz, 1);
+      zdcShiftB = fZDCShiftTab + StEPCalibrationStore::ShiftIndex(1, ref9, region_vz, 1);
+    } else if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
+      zdcShiftA = zdc_shift_A_Run14[ref9][region_vz];
+      zdcShiftB = zdc_shift_B_Run14[ref9][region_vz];
+    } else if(fRunFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
+      zdcShiftA = zdc_shift_A[ref9][region_vz];
+      zdcShiftB = zdc_shift_B[ref9][region_vz];
+    }
+    zdc_delta_psi = ShiftCorrection(zPhi_rcd, zdcShiftA, zdcShiftB, kMaxShiftHarmonics);
 
 /*
+    for(int nharm = 1; nharm < 21; nharm++){
       // reading in from file
       if(fCalibFile2 && doReadCalibFile){
         // Method 2: load from *.root calibration file
@@ -1774,10 +1867,9 @@ Int_t StEventPlaneMaker::ZDC_EP_Cal(int ref9, int region_vz, int n) {
         // delete temp histos
         delete htempZDC_ShiftA;
         delete htempZDC_ShiftB;
-      }      
-*/
-
+      }
     }
+*/
   }
 
   int ns = 0;
@@ -1900,7 +1992,12 @@ Double_t StEventPlaneMaker::ZDCSMD_GetPosition(int id_order, int eastwest, int v
   double mZDCSMDCenterex = 0.0, mZDCSMDCenterey = 0.0, mZDCSMDCenterwx = 0.0, mZDCSMDCenterwy = 0.0; 
   if(zdc_shift_read_switch || zdc_apply_corr_switch){
     // recentering procedure - read from a function in .h file 
-    if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
+    if(fZDCRecenterTab && id_order >= 0 && id_order < fZDCRecenterNRuns) {
+      mZDCSMDCenterex = fZDCRecenterTab[id_order];
+      mZDCSMDCenterey = fZDCRecenterTab[fZDCRecenterNRuns + id_order];
+      mZDCSMDCenterwx = fZDCRecenterTab[2*fZDCRecenterNRuns + id_order];
+      mZDCSMDCenterwy = fZDCRecenterTab[3*fZDCRecenterNRuns + id_order];
+    } else if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
       mZDCSMDCenterex = zdc_center_ex_Run14[id_order];
       mZDCSMDCenterey = zdc_center_ey_Run14[id_order];
       mZDCSMDCenterwx = zdc_center_wx_Run14[id_order];
@@ -1963,9 +2060,6 @@ Double_t StEventPlaneMaker::ZDCSMD_GetPosition(int id_order, int eastwest, int v
 // Calculate TPC event plane angle with correction
 // ___________________________________________________________________________________
 Int_t StEventPlaneMaker::EventPlaneCal(int ref9, int region_vz, int n, int ptbin) {
-  double res = 0.;
-  double pi = 1.0*TMath::Pi();
-
   // initialize Q-vector components
   Q2x_raw = 0.;
   Q2y_raw = 0.;
@@ -1979,6 +2073,16 @@ Int_t StEventPlaneMaker::EventPlaneCal(int ref9, int region_vz, int n, int ptbin
   // function to calculate Q-vectors
   QvectorCal(ref9, region_vz, n, ptbin);
 
+  // event plane angles, corrections and histograms
+  return TPCEventPlaneFromQvectors(ref9, region_vz, n);
+}
+//
+// Calculate TPC event plane angles from the Q-vector components and fill histograms
+// ___________________________________________________________________________________
+Int_t StEventPlaneMaker::TPCEventPlaneFromQvectors(int ref9, int region_vz, int n) {
+  double res = 0.;
+  double pi = 1.0*TMath::Pi();
+
   // TEST - debug TPC
   if(fabs(Q2x_m) < 1e-6) { cout<<"TPC Q2x_m < 1e-6, "<<Q2x_m<<endl; 
     hTPCepDebug->Fill(1.); }
@@ -2064,26 +2168,20 @@ Int_t StEventPlaneMaker::EventPlaneCal(int ref9, int region_vz, int n, int ptbin
   double tpc_delta_psi = 0.;
   double tpc_shift_Aval = 0., tpc_shift_Bval = 0.; // comment in with code chunk below
   if(tpc_apply_corr_switch) { // FIXME: file needs to exist and need to have ran recentering + shift prior
-    // loop over harmonics
-    for(int nharm = 1; nharm < 21; nharm++){
-      // Method 1: load from *.h file function
-      // perform 'shift' to TPC event plane angle
-      // KEEP in mind, the naming convent here means nothing for functions: tpc_shift_N and tpc_shift_P,
-      // they are corresponing to Bn and An components above!
-      // so hTPC_shft_N and hTPC_shift_P also have misleading names
-      //shift_delta_psi += (shift_A[ref9][region_vz][z-1]*cos(2*z*psi2_rcd) + shift_B[ref9][region_vz][z-1]*sin(2*z*psi2_rcd));
-      //tpc_delta_psi += (tpc_shift_N[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-      //                  tpc_shift_P[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-
-      if(doTPCptassocBin) {
-        tpc_delta_psi += GetTPCShiftingValue(tPhi_rcd, nharm, ref9, region_vz);
-      } else {
-        // standard default method (all pt bins combined for reaction plane calculation)
-        tpc_delta_psi += (tpc_shift_N[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                          tpc_shift_P[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-      }
+    // Method 1: load from *.h file function - all 20 harmonics in one pass
+    // perform 'shift' to TPC event plane angle
+    // KEEP in mind, the naming convent here means nothing for functions: tpc_shift_N and tpc_shift_P,
+    // they are corresponing to Bn and An components above!
+    // so hTPC_shft_N and hTPC_shift_P also have misleading names
+    if(doTPCptassocBin) {
+      tpc_delta_psi = GetTPCShiftCorrection(tPhi_rcd, ref9, region_vz, fTPCEPmethod, fTPCptAssocBin);
+    } else {
+      // standard default method (all pt bins combined for reaction plane calculation)
+      tpc_delta_psi = ShiftCorrection(tPhi_rcd, tpc_shift_N[ref9][region_vz], tpc_shift_P[ref9][region_vz], kMaxShiftHarmonics);
+    }
 
 /*
+    for(int nharm = 1; nharm < 21; nharm++){
       // reading in from file
       // started correcting names..
       if(fCalibFile2 && doReadCalibFile){
@@ -2102,9 +2200,8 @@ Int_t StEventPlaneMaker::EventPlaneCal(int ref9, int region_vz, int n, int ptbin
         delete htempTPC_ShiftA;
         delete htempTPC_ShiftB;
       }
-*/
-
     } // nharm loop
+*/
   } // correction switch
 
   int ns = 0;
@@ -2151,6 +2248,41 @@ Int_t StEventPlaneMaker::EventPlaneCal(int ref9, int region_vz, int n, int ptbin
   return kStOk;
 }
 //
+// Function: flag the tracks removed around the leading (+ subleading) jet for the TPC event plane
+// - one eta-strip and one cone query per jet on the track grid of the event, instead of
+//   the distance of every track to both jets in each Q-vector loop
+// - the cone uses the phi distance across 0/2pi
+// ______________________________________________________________________________________________
+void StEventPlaneMaker::FlagJetRemovalTracks() {
+  int nTrack = mPicoDst->numberOfTracks();
+  fJetRemovalFlags.assign(nTrack, 0);
+  if(fExcludeLeadingJetsFromFit <= 0) return;
+  if(!fLeadingJet && !fSubLeadingJet) return;
+
+  // accepted tracks of the event in an eta-phi grid
+  StTrackEtaPhiGrid *trackGrid = GetTrackGrid();
+  if(!trackGrid) return;
+
+  StJet *removeJet[2] = {fLeadingJet, fSubLeadingJet};
+  UChar_t stripFlag[2] = {kInLeadingJetStrip, kInSubLeadingJetStrip};
+  UChar_t coneFlag[2]  = {kInLeadingJetCone, kInSubLeadingJetCone};
+  for(int ij = 0; ij < 2; ij++) {
+    if(!removeJet[ij]) continue;
+
+    // eta strip around jet
+    int nStrip = trackGrid->FindInEtaStrip(removeJet[ij]->Eta(), fJetRad*fExcludeLeadingJetsFromFit, fGridEntries);
+    for(int is = 0; is < nStrip; is++) {
+      fJetRemovalFlags[trackGrid->GetTrackIndex(fGridEntries[is])] |= stripFlag[ij];
+    }
+
+    // cone (in eta and phi) around jet
+    int nCone = trackGrid->FindInCone(removeJet[ij]->Eta(), removeJet[ij]->Phi(), fJetRad, fGridEntries, &fGridDeltaR);
+    for(int ic = 0; ic < nCone; ic++) {
+      if(fGridDeltaR[ic] < fJetRad) fJetRemovalFlags[trackGrid->GetTrackIndex(fGridEntries[ic])] |= coneFlag[ij];
+    }
+  }
+}
+//
 // this is a function for Qvector calculation for TPC event plane
 // ______________________________________________________________________________________________
 void StEventPlaneMaker::QvectorCal(int ref9, int region_vz, int n, int ptbin) {
@@ -2165,45 +2297,39 @@ void StEventPlaneMaker::QvectorCal(int ref9, int region_vz, int n, int ptbin) {
   TRandom3 *rand = new TRandom3();
   //TRandom *rand = new TRandom();
 
-  // leading jet check and removal
-  double excludeInEta = -999, excludeInPhi = -999;
-  double excludeInEtaSub = -999., excludeInPhiSub = -999.;
-  if(fExcludeLeadingJetsFromFit > 0 ) {    // remove the leading jet from EP estimate
-    if(fLeadingJet) {
-      excludeInEta = fLeadingJet->Eta();
-      excludeInPhi = fLeadingJet->Phi();
-    }
-
-    if(fSubLeadingJet) {
-      excludeInEtaSub = fSubLeadingJet->Eta();
-      excludeInPhiSub = fSubLeadingJet->Phi();
-    }
-  } // get location of leading jets for removal
-
 //cout<<"ref9: "<<ref9<<"  region_vz: "<<region_vz<<"  n: "<<n<<"  ptbin: "<<ptbin<<"  Ntrack: "<<mPicoDst->numberOfTracks()<<endl;
 
   // loop over tracks
   int Qtrack = mPicoDst->numberOfTracks();
   for(int i = 0; i < Qtrack; i++){
-    // get track pointer
-    StPicoTrack *track = static_cast<StPicoTrack*>(mPicoDst->track(i));
-    if(!track) { continue; }
-
-    // apply standard track cuts - (can apply more restrictive cuts below)
-    if(!(AcceptTrack(track, Bfield, mVertex))) { continue; }
-
-    // primary track switch: get momentum vector of track - global or primary track
-    TVector3 mTrkMom;
-    if(doUsePrimTracks) { // get primary track vector
-      mTrkMom = track->pMom();
-    } else {              // get global track vector
-      mTrkMom = track->gMom(mVertex, Bfield);
-    }
-
     // track variables
-    double pt = mTrkMom.Perp();
-    double phi = mTrkMom.Phi();
-    double eta = mTrkMom.PseudoRapidity();
+    double pt, phi, eta;
+    if(mTrackCache) {
+      // use kinematics cached once per event, phi already (0, 2pi)
+      if(!(AcceptTrack(mTrackCache, i))) { continue; }
+      pt = mTrackCache->GetPt(i);
+      phi = mTrackCache->GetPhi(i);
+      eta = mTrackCache->GetEta(i);
+    } else {
+      // get track pointer
+      StPicoTrack *track = static_cast<StPicoTrack*>(mPicoDst->track(i));
+      if(!track) { continue; }
+
+      // apply standard track cuts - (can apply more restrictive cuts below)
+      if(!(AcceptTrack(track, Bfield, mVertex))) { continue; }
+
+      // primary track switch: get momentum vector of track - global or primary track
+      TVector3 mTrkMom;
+      if(doUsePrimTracks) { // get primary track vector
+        mTrkMom = track->pMom();
+      } else {              // get global track vector
+        mTrkMom = track->gMom(mVertex, Bfield);
+      }
+
+      pt = mTrkMom.Perp();
+      phi = mTrkMom.Phi();
+      eta = mTrkMom.PseudoRapidity();
+    }
 
     // should set a soft pt range (0.2 - 5.0?)
     if(pt > fEventPlaneMaxTrackPtCut) continue;   // 5.0 GeV
@@ -2223,38 +2349,32 @@ void StEventPlaneMaker::QvectorCal(int ref9, int region_vz, int n, int ptbin) {
       if(ptbin == 7) { if((pt > 4.00) && (pt <= 5.0)) continue; }  // 4.00 - 5.0 GeV assoc bin used for correlations
     }
 
+    // leading (+ subleading) jet removal: tracks flagged once per event by FlagJetRemovalTracks()
+    UChar_t jetFlags = fJetRemovalFlags[i];
+
     // Method1: kRemoveEtaStrip - remove strip only when we have a leading jet
     if(fTPCEPmethod == kRemoveEtaStrip){
-      if((fLeadingJet) && (fExcludeLeadingJetsFromFit > 0) && ((TMath::Abs(eta - excludeInEta) < fJetRad*fExcludeLeadingJetsFromFit ) )) continue;
+      if(jetFlags & kInLeadingJetStrip) continue;
 
     } else if(fTPCEPmethod == kRemoveEtaPhiCone){
       // Method2: kRemoveEtaPhiCone - remove cone (in eta and phi) around leading jet
-      double deltaR = 1.0*TMath::Sqrt((eta - excludeInEta)*(eta - excludeInEta) + (phi - excludeInPhi)*(phi - excludeInPhi));
-      if((fLeadingJet) && (fExcludeLeadingJetsFromFit > 0) && (deltaR < fJetRad) ) continue;
+      if(jetFlags & kInLeadingJetCone) continue;
 
     } else if(fTPCEPmethod == kRemoveLeadingJetConstituents){
       // Method3: kRemoveLeadingJetConstituents - remove tracks above 2 GeV in cone around leading jet
-      double deltaR = 1.0*TMath::Sqrt((eta - excludeInEta)*(eta - excludeInEta) + (phi - excludeInPhi)*(phi - excludeInPhi));
-      if((fLeadingJet) && (fExcludeLeadingJetsFromFit > 0) && (pt > fJetConstituentCut) && (deltaR < fJetRad)) continue;
+      if((pt > fJetConstituentCut) && (jetFlags & kInLeadingJetCone)) continue;
 
     } else if(fTPCEPmethod == kRemoveEtaStripLeadSub){
       // Method4: kRemoveEtaStripLeadSub - remove strip only when we have a leading + subleading jet
-      if((fLeadingJet) && (fExcludeLeadingJetsFromFit > 0) && ((TMath::Abs(eta - excludeInEta) < fJetRad*fExcludeLeadingJetsFromFit ) )) continue;
-      if((fSubLeadingJet) && (fExcludeLeadingJetsFromFit > 0) && ((TMath::Abs(eta - excludeInEtaSub) < fJetRad*fExcludeLeadingJetsFromFit ) )) continue;
+      if(jetFlags & (kInLeadingJetStrip | kInSubLeadingJetStrip)) continue;
 
     } else if(fTPCEPmethod == kRemoveEtaPhiConeLeadSub){
       // Method5: kRemoveEtaPhiConeLeadSub - remove cone (in eta and phi) around leading + subleading jet
-      double deltaR    = 1.0*TMath::Sqrt((eta - excludeInEta)*(eta - excludeInEta) + (phi - excludeInPhi)*(phi - excludeInPhi));
-      double deltaRSub = 1.0*TMath::Sqrt((eta - excludeInEtaSub)*(eta - excludeInEtaSub) + (phi - excludeInPhiSub)*(phi - excludeInPhiSub));
-      if((fLeadingJet)    && (fExcludeLeadingJetsFromFit > 0) && (deltaR    < fJetRad)) continue;
-      if((fSubLeadingJet) && (fExcludeLeadingJetsFromFit > 0) && (deltaRSub < fJetRad)) continue;
+      if(jetFlags & (kInLeadingJetCone | kInSubLeadingJetCone)) continue;
 
     } else if(fTPCEPmethod == kRemoveLeadingSubJetConstituents){
       // Method6: kRemoveLeadingSubJetConstituents - remove tracks above 2 GeV in cone around leading + subleading jet
-      double deltaR = 1.0*TMath::Sqrt((eta - excludeInEta)*(eta - excludeInEta) + (phi - excludeInPhi)*(phi - excludeInPhi));
-      double deltaRSub = 1.0*TMath::Sqrt((eta - excludeInEtaSub)*(eta - excludeInEtaSub) + (phi - excludeInPhiSub)*(phi - excludeInPhiSub));
-      if((fLeadingJet) && (fExcludeLeadingJetsFromFit > 0) && (pt > fJetConstituentCut) && (deltaR < fJetRad)) continue;
-      if((fSubLeadingJet) && (fExcludeLeadingJetsFromFit > 0) && (pt > fJetConstituentCut) && (deltaRSub < fJetRad)) continue;
+      if((pt > fJetConstituentCut) && (jetFlags & (kInLeadingJetCone | kInSubLeadingJetCone))) continue;
 
     } else {
       // DO NOTHING! nothing is removed...
@@ -2318,8 +2438,8 @@ void StEventPlaneMaker::QvectorCal(int ref9, int region_vz, int n, int ptbin) {
     // STEP2: read in recentering for TPC event plane
     if(tpc_shift_read_switch){ 
       if(doTPCptassocBin) {
-        x -= GetTPCRecenterValue(randomNum, "x", ref9, region_vz);
-        y -= GetTPCRecenterValue(randomNum, "y", ref9, region_vz);
+        x -= GetTPCRecenterValue(randomNum, "x", ref9, region_vz, fTPCEPmethod, fTPCptAssocBin);
+        y -= GetTPCRecenterValue(randomNum, "y", ref9, region_vz, fTPCEPmethod, fTPCptAssocBin);
       } else {
         ////////////////////////////////////
         if(eta > 0){ // POSITIVE region
@@ -2399,6 +2519,261 @@ void StEventPlaneMaker::QvectorCal(int ref9, int region_vz, int n, int ptbin) {
   //cout<<"Q2x_p = "<<Q2x_p<<"  Q2y_p = "<<Q2y_p<<"  Q2x_m = "<<Q2x_m<<"  Q2y_m = "<<Q2y_m<<endl;
   //cout<<"nA = "<<nA<<"  nB = "<<nB<<"  nTOT = "<<nTOT<<endl;
 }
+//
+// Calculate TPC event planes for all pt assoc bins and methods from one track loop
+// - the configured bin (fTPCptAssocBin, fTPCEPmethod) fills the histograms as EventPlaneCal does
+// ___________________________________________________________________________________
+Int_t StEventPlaneMaker::EventPlaneCalAllBins(int ref9, int region_vz, int n) {
+  // initialize Q-vector components of configured bin
+  Q2x_raw = 0.;
+  Q2y_raw = 0.;
+  Q2x_p = 0.;
+  Q2x_m = 0.;
+  Q2y_p = 0.;
+  Q2y_m = 0.;
+  Q2x = 0.;
+  Q2y = 0.;
+
+  // Q-vectors and event plane angles for all bins and methods
+  QvectorCalAllBins(ref9, region_vz, n);
+
+  // configured bin: angles, corrections and histograms
+  return TPCEventPlaneFromQvectors(ref9, region_vz, n);
+}
+//
+// Q-vector calculation for all pt assoc bins and TPC methods in a single track loop
+// - the k-th track accepted for a bin / method gets the k-th random number, as in QvectorCal
+// - recentering is the same shift for each track of a sub-event: subtracted once per track count
+// ______________________________________________________________________________________________
+void StEventPlaneMaker::QvectorCalAllBins(int ref9, int region_vz, int n) {
+  int order = n; //2;
+  double pi = 1.0*TMath::Pi();
+
+  // pt assoc bins: a track is removed from the event plane of its own bin (see QvectorCal)
+  const double ptAssocBinEdges[kNTPCptAssocBins + 1] = {0.20, 0.50, 1.00, 1.50, 2.00, 20.0};
+
+  // raw Q-vector sums and number of tracks for sub-events A and B
+  double QxA[kNTPCEPmethods][kNTPCptAssocBins], QyA[kNTPCEPmethods][kNTPCptAssocBins];
+  double QxB[kNTPCEPmethods][kNTPCptAssocBins], QyB[kNTPCEPmethods][kNTPCptAssocBins];
+  int nA[kNTPCEPmethods][kNTPCptAssocBins], nB[kNTPCEPmethods][kNTPCptAssocBins];
+  for(int im = 0; im < kNTPCEPmethods; im++) {
+    for(int ib = 0; ib < kNTPCptAssocBins; ib++) {
+      QxA[im][ib] = 0.; QyA[im][ib] = 0.; QxB[im][ib] = 0.; QyB[im][ib] = 0.;
+      nA[im][ib] = 0; nB[im][ib] = 0;
+    }
+  }
+
+  // random numbers for sub-event selection: QvectorCal uses a new TRandom3 (default seed) every event
+  int Qtrack = mPicoDst->numberOfTracks();
+  if((int)fRandomSequence.size() < Qtrack) {
+    TRandom3 rand;
+    fRandomSequence.resize(Qtrack);
+    for(int i = 0; i < Qtrack; i++) fRandomSequence[i] = rand.Rndm();
+  }
+
+  // loop over tracks
+  for(int i = 0; i < Qtrack; i++){
+    // track variables
+    double pt, phi, eta;
+    if(mTrackCache) {
+      // use kinematics cached once per event, phi already (0, 2pi)
+      if(!(AcceptTrack(mTrackCache, i))) { continue; }
+      pt = mTrackCache->GetPt(i);
+      phi = mTrackCache->GetPhi(i);
+      eta = mTrackCache->GetEta(i);
+    } else {
+      // get track pointer
+      StPicoTrack *track = static_cast<StPicoTrack*>(mPicoDst->track(i));
+      if(!track) { continue; }
+
+      // apply standard track cuts - (can apply more restrictive cuts below)
+      if(!(AcceptTrack(track, Bfield, mVertex))) { continue; }
+
+      // primary track switch: get momentum vector of track - global or primary track
+      TVector3 mTrkMom;
+      if(doUsePrimTracks) { // get primary track vector
+        mTrkMom = track->pMom();
+      } else {              // get global track vector
+        mTrkMom = track->gMom(mVertex, Bfield);
+      }
+
+      pt = mTrkMom.Perp();
+      phi = mTrkMom.Phi();
+      eta = mTrkMom.PseudoRapidity();
+    }
+
+    // should set a soft pt range (0.2 - 5.0?)
+    if(pt > fEventPlaneMaxTrackPtCut) continue;   // 5.0 GeV
+    if(phi < 0.0)    phi += 2.0*pi;
+    if(phi > 2.0*pi) phi -= 2.0*pi;
+
+    // pt assoc bin of track
+    int trackPtBin = -1;
+    for(int ib = 0; ib < kNTPCptAssocBins; ib++) {
+      if((pt > ptAssocBinEdges[ib]) && (pt <= ptAssocBinEdges[ib + 1])) { trackPtBin = ib; break; }
+    }
+
+    // leading (+ subleading) jet removal for each method - tracks flagged once per event by FlagJetRemovalTracks()
+    UChar_t jetFlags = fJetRemovalFlags[i];
+    bool inStrip    = (jetFlags & kInLeadingJetStrip);
+    bool inStripSub = (jetFlags & kInSubLeadingJetStrip);
+    bool inCone     = (jetFlags & kInLeadingJetCone);
+    bool inConeSub  = (jetFlags & kInSubLeadingJetCone);
+    bool isConst    = (pt > fJetConstituentCut);
+
+    bool removed[kNTPCEPmethods];
+    removed[kRemoveNothing]                   = kFALSE;
+    removed[kRemoveEtaStrip]                  = inStrip;
+    removed[kRemoveEtaPhiCone]                = inCone;
+    removed[kRemoveLeadingJetConstituents]    = isConst && inCone;
+    removed[kRemoveEtaStripLeadSub]           = inStrip || inStripSub;
+    removed[kRemoveEtaPhiConeLeadSub]         = inCone || inConeSub;
+    removed[kRemoveLeadingSubJetConstituents] = isConst && (inCone || inConeSub);
+
+    // configure track weight when performing Q-vector summation
+    double trackweight;
+    if(fTrackWeight == kNoWeight) {
+      trackweight = 1.0;
+    } else if(fTrackWeight == kPtLinearWeight) {
+      trackweight = pt;
+    } else if(fTrackWeight == kPtLinear2Const5Weight) {
+      trackweight = (pt <= 2.0) ? pt : 2.0;
+    } else {
+      // nothing choosen, so don't use weight
+      trackweight = 1.0;
+    }
+
+    // components (x and y)
+    double x = trackweight * cos(order*phi);
+    double y = trackweight * sin(order*phi);
+
+    // add to each method and pt assoc bin using this track
+    for(int im = 0; im < kNTPCEPmethods; im++) {
+      if(removed[im]) continue;
+
+      for(int ib = 0; ib < kNTPCptAssocBins; ib++) {
+        if(ib == trackPtBin) continue;
+
+        double randomNum = fRandomSequence[nA[im][ib] + nB[im][ib]];
+        if(randomNum >= 0.5) { // subevent A
+          QxA[im][ib] += x;
+          QyA[im][ib] += y;
+          nA[im][ib]++;
+        } else {               // subevent B
+          QxB[im][ib] += x;
+          QyB[im][ib] += y;
+          nB[im][ib]++;
+        }
+
+        // STEP1: calculate recentering for TPC event plane - configured bin
+        if(tpc_recenter_read_switch && (im == fTPCEPmethod) && (ib == fTPCptAssocBin)) {
+          if(randomNum >= 0.5) { Q2_p[ref9][region_vz]->Fill(0.5, x); Q2_p[ref9][region_vz]->Fill(1.5, y); }
+          if(randomNum <  0.5) { Q2_m[ref9][region_vz]->Fill(0.5, x); Q2_m[ref9][region_vz]->Fill(1.5, y); }
+        }
+      } // pt assoc bins
+    } // methods
+  } // track loop
+
+  // recentered Q-vectors and event plane angles
+  for(int im = 0; im < kNTPCEPmethods; im++) {
+    for(int ib = 0; ib < kNTPCptAssocBins; ib++) {
+      // STEP2: read in recentering for TPC event plane
+      double QxAcorr = QxA[im][ib], QyAcorr = QyA[im][ib];
+      double QxBcorr = QxB[im][ib], QyBcorr = QyB[im][ib];
+      if(tpc_shift_read_switch) {
+        QxAcorr -= nA[im][ib] * GetTPCRecenterValue(1.0, "x", ref9, region_vz, im, ib);
+        QyAcorr -= nA[im][ib] * GetTPCRecenterValue(1.0, "y", ref9, region_vz, im, ib);
+        QxBcorr -= nB[im][ib] * GetTPCRecenterValue(0.0, "x", ref9, region_vz, im, ib);
+        QyBcorr -= nB[im][ib] * GetTPCRecenterValue(0.0, "y", ref9, region_vz, im, ib);
+      }
+
+      // Q-vectors of configured bin for TPCEventPlaneFromQvectors()
+      if((im == fTPCEPmethod) && (ib == fTPCptAssocBin)) {
+        Q2x_raw = QxA[im][ib] + QxB[im][ib];
+        Q2y_raw = QyA[im][ib] + QyB[im][ib];
+        Q2x_p = QxAcorr;
+        Q2y_p = QyAcorr;
+        Q2x_m = QxBcorr;
+        Q2y_m = QyBcorr;
+        Q2x = QxAcorr + QxBcorr;
+        Q2y = QyAcorr + QyBcorr;
+      }
+
+      if((QxA[im][ib] + QxB[im][ib] == 0.) && (QyA[im][ib] + QyB[im][ib] == 0.)) continue;
+
+      // sub-event angles (0, pi)
+      double psi2p = atan2(QyAcorr, QxAcorr);
+      double psi2m = atan2(QyBcorr, QxBcorr);
+      if(psi2p < 0.) psi2p += 2*pi;
+      if(psi2m < 0.) psi2m += 2*pi;
+      fTPCAEPbin[im][ib] = psi2p / n;
+      fTPCBEPbin[im][ib] = psi2m / n;
+
+      // recentered and shifted full TPC event plane (0, pi)
+      fTPCEPbin[im][ib] = GetTPCShiftedEP(QxAcorr + QxBcorr, QyAcorr + QyBcorr, n, ref9, region_vz, im, ib);
+    }
+  }
+}
+//
+// recentered Q-vector -> shifted TPC event plane angle (0, pi): same steps as TPCEventPlaneFromQvectors
+// ______________________________________________________________________________________________
+Double_t StEventPlaneMaker::GetTPCShiftedEP(Double_t Qx, Double_t Qy, Int_t n, Int_t ref9, Int_t region_vz, Int_t method, Int_t ptbin) {
+  double pi = 1.0*TMath::Pi();
+
+  double tPhi_rcd = atan2(Qy, Qx);     // (-pi, pi)
+  if(tPhi_rcd < 0.) tPhi_rcd += 2*pi;  // (0, 2*pi]
+  tPhi_rcd /= n;                       // (0, pi)
+
+  // STEP3: shift correction
+  double tpc_delta_psi = 0.;
+  if(tpc_apply_corr_switch) tpc_delta_psi = GetTPCShiftCorrection(tPhi_rcd, ref9, region_vz, method, ptbin);
+
+  //=====tpc_delta_psi (-pi, pi)
+  int ns = int(fabs(tpc_delta_psi) / pi);
+  if(tpc_delta_psi > 0) tpc_delta_psi -= ns*pi;
+  if(tpc_delta_psi < 0) tpc_delta_psi += ns*pi;
+
+  // shifted event plane from {0, pi}
+  double tPhi_fnl = tPhi_rcd + tpc_delta_psi;
+  if(tPhi_fnl < 0.0)    tPhi_fnl += pi;
+  if(tPhi_fnl > 1.0*pi) tPhi_fnl -= pi;
+
+  return tPhi_fnl;
+}
+//
+// TPC event plane of pt assoc bin and method
+// - single-bin mode only has the configured bin and method
+//_____________________________________________________________________________
+Double_t StEventPlaneMaker::GetTPCEP(Int_t ptbin, Int_t method) const
+{
+  if(!doAllTPCptAssocBins) {
+    if((method == fTPCEPmethod) && (!doTPCptassocBin || ptbin == fTPCptAssocBin)) return TPC_PSI2;
+    return -999;
+  }
+
+  if(ptbin < 0 || ptbin >= kNTPCptAssocBins || method < 0 || method >= kNTPCEPmethods) return -999;
+  return fTPCEPbin[method][ptbin];
+}
+//
+// TPC sub-event A plane of pt assoc bin
+//_____________________________________________________________________________
+Double_t StEventPlaneMaker::GetTPCEPA(Int_t ptbin) const
+{
+  if(!doAllTPCptAssocBins) return (!doTPCptassocBin || ptbin == fTPCptAssocBin) ? TPCA_PSI2 : -999;
+
+  if(ptbin < 0 || ptbin >= kNTPCptAssocBins || fTPCEPmethod < 0 || fTPCEPmethod >= kNTPCEPmethods) return -999;
+  return fTPCAEPbin[fTPCEPmethod][ptbin];
+}
+//
+// TPC sub-event B plane of pt assoc bin
+//_____________________________________________________________________________
+Double_t StEventPlaneMaker::GetTPCEPB(Int_t ptbin) const
+{
+  if(!doAllTPCptAssocBins) return (!doTPCptassocBin || ptbin == fTPCptAssocBin) ? TPCB_PSI2 : -999;
+
+  if(ptbin < 0 || ptbin >= kNTPCptAssocBins || fTPCEPmethod < 0 || fTPCEPmethod >= kNTPCEPmethods) return -999;
+  return fTPCBEPbin[fTPCEPmethod][ptbin];
+}
 
 //
 // Fill event plane resolution histograms
@@ -2624,106 +2999,112 @@ Double_t StEventPlaneMaker::GetEventPlaneAngle(TString det, Int_t order, Int_t c
 //
 // return recentering value
 //____________________________________________________________________________________________________________________
-Double_t StEventPlaneMaker::GetTPCRecenterValue(Double_t randomNum, TString coordinate, Int_t ref9, Int_t region_vz) {
+Double_t StEventPlaneMaker::GetTPCRecenterValue(Double_t randomNum, TString coordinate, Int_t ref9, Int_t region_vz, Int_t method, Int_t ptbin) {
+    // binary calibration store: Qnx, Qny (subevent B), Qpx, Qpy (subevent A)
+    if(method >= 0 && method < kNTPCEPmethods && ptbin >= 0 && ptbin < kNTPCptAssocBins && fTPCRecenterTab[method][ptbin]) {
+      int comp = ((randomNum >= 0.5) ? 2 : 0) + (coordinate.Contains("x") ? 0 : 1);
+      return fTPCRecenterTab[method][ptbin][StEPCalibrationStore::TPCRecenterIndex(comp, ref9, region_vz)];
+    }
+
     //==================recentering procedure.
     // STEP2: read in recentering for TPC event plane
         if(randomNum >= 0.5) { // subevent A
-          switch(fTPCEPmethod) {
+          switch(method) {
             // also have option of tpc_center_Qpx_bin0_Method1
             case kRemoveEtaStrip:
               if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
                 if(fJetType == kFullJet) {
 
                   if(fJetRad == 0.5) { // Jet radius: R=0.5
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin0_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin0_Method1_R05_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin1_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin1_Method1_R05_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin2_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin2_Method1_R05_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin3_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin3_Method1_R05_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin4_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin4_Method1_R05_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.5
 
                   if(fJetRad == 0.4) { // Jet radius: R=0.4
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin0_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin0_Method1_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin1_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin1_Method1_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin2_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin2_Method1_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin3_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin3_Method1_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin4_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin4_Method1_R04_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.4
 
                   if(fJetRad == 0.3) { // Jet radius: R=0.3
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin0_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin0_Method1_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin1_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin1_Method1_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin2_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin2_Method1_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin3_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin3_Method1_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin4_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin4_Method1_R03_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.3
 
                   if(fJetRad == 0.2) { // Jet radius: R=0.2
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin0_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin0_Method1_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin1_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin1_Method1_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin2_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin2_Method1_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin3_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin3_Method1_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin4_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin4_Method1_R02_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.2
 
                   if(fJetRad == 0.1) { // Jet radius: R=0.1
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin0_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin0_Method1_R01_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin1_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin1_Method1_R01_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin2_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin2_Method1_R01_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin3_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin3_Method1_R01_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin4_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin4_Method1_R01_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
@@ -2733,19 +3114,19 @@ Double_t StEventPlaneMaker::GetTPCRecenterValue(Double_t randomNum, TString coor
 
                 if(fJetType == kChargedJet) {
                   if(fJetRad == 0.4) { // Jet radius: R=0.4
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin0_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin0_Method1ch_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin1_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin1_Method1ch_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin2_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin2_Method1ch_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin3_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin3_Method1ch_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin4_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin4_Method1ch_R04_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
@@ -2753,38 +3134,38 @@ Double_t StEventPlaneMaker::GetTPCRecenterValue(Double_t randomNum, TString coor
 
 
                   if(fJetRad == 0.3) { // Jet radius: R=0.3
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin0_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin0_Method1ch_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin1_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin1_Method1ch_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin2_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin2_Method1ch_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin3_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin3_Method1ch_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin4_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin4_Method1ch_R03_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.3
 
                   if(fJetRad == 0.2) { // Jet radius: R=0.2
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin0_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin0_Method1ch_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin1_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin1_Method1ch_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin2_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin2_Method1ch_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin3_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin3_Method1ch_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qpx_bin4_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qpy_bin4_Method1ch_R02_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
@@ -2804,101 +3185,101 @@ Double_t StEventPlaneMaker::GetTPCRecenterValue(Double_t randomNum, TString coor
         }  // rand >= 0.5
 
         if(randomNum < 0.5) { // subevent B             
-          switch(fTPCEPmethod) {
+          switch(method) {
             case kRemoveEtaStrip:
               if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
                 if(fJetType == kFullJet) {
 
                   if(fJetRad == 0.5) { // Jet radius: R=0.5
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin0_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin0_Method1_R05_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin1_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin1_Method1_R05_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin2_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin2_Method1_R05_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin3_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin3_Method1_R05_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin4_Method1_R05_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin4_Method1_R05_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.5
 
                   if(fJetRad == 0.4) { // Jet radius: R=0.4
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin0_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin0_Method1_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin1_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin1_Method1_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin2_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin2_Method1_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin3_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin3_Method1_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin4_Method1_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin4_Method1_R04_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.4
 
                   if(fJetRad == 0.3) { // Jet radius: R=0.3
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin0_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin0_Method1_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin1_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin1_Method1_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin2_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin2_Method1_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin3_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin3_Method1_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin4_Method1_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin4_Method1_R03_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.3  
 
                   if(fJetRad == 0.2) { // Jet radius: R=0.2
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin0_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin0_Method1_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin1_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin1_Method1_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin2_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin2_Method1_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin3_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin3_Method1_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin4_Method1_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin4_Method1_R02_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.2  
 
                   if(fJetRad == 0.1) { // Jet radius: R=0.1
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin0_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin0_Method1_R01_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin1_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin1_Method1_R01_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin2_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin2_Method1_R01_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin3_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin3_Method1_R01_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin4_Method1_R01_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin4_Method1_R01_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
@@ -2908,57 +3289,57 @@ Double_t StEventPlaneMaker::GetTPCRecenterValue(Double_t randomNum, TString coor
 
                 if(fJetType == kChargedJet) {
                   if(fJetRad == 0.4) { // Jet radius: R=0.4
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin0_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin0_Method1ch_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin1_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin1_Method1ch_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin2_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin2_Method1ch_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin3_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin3_Method1ch_R04_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin4_Method1ch_R04_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin4_Method1ch_R04_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.4
 
                   if(fJetRad == 0.3) { // Jet radius: R=0.3
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin0_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin0_Method1ch_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin1_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin1_Method1ch_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin2_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin2_Method1ch_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin3_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin3_Method1ch_R03_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin4_Method1ch_R03_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin4_Method1ch_R03_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                   } // R=0.3  
 
                   if(fJetRad == 0.2) { // Jet radius: R=0.2
-                    if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
+                    if(ptbin == 0) {         // 0.20-0.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin0_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin0_Method1ch_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
+                    } else if(ptbin == 1) {  // 0.50-1.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin1_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin1_Method1ch_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
+                    } else if(ptbin == 2) {  // 1.00-1.50 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin2_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin2_Method1ch_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
+                    } else if(ptbin == 3) {  // 1.50-2.00 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin3_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin3_Method1ch_R02_Run14[ref9][region_vz];
-                    } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
+                    } else if(ptbin == 4) {  // 2.00-20.0 GeV
                       if(coordinate.Contains("x")) return tpc_center_Qnx_bin4_Method1ch_R02_Run14[ref9][region_vz];
                       if(coordinate.Contains("y")) return tpc_center_Qny_bin4_Method1ch_R02_Run14[ref9][region_vz];
                     } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
@@ -2979,9 +3360,26 @@ Double_t StEventPlaneMaker::GetTPCRecenterValue(Double_t randomNum, TString coor
     return 0.;
 }
 //
-// return shifting value
+// return TPC shift correction summed over all harmonics
 //____________________________________________________________________________________________________________________
-Double_t StEventPlaneMaker::GetTPCShiftingValue(Double_t tPhi_rcd, Int_t nharm, Int_t ref9, Int_t region_vz) {
+Double_t StEventPlaneMaker::GetTPCShiftCorrection(Double_t tPhi_rcd, Int_t ref9, Int_t region_vz, Int_t method, Int_t ptbin) {
+  const Double_t *shiftN = 0x0, *shiftP = 0x0;
+  if(!GetTPCShiftRows(ref9, region_vz, method, ptbin, shiftN, shiftP)) return 0.;
+
+  return ShiftCorrection(tPhi_rcd, shiftN, shiftP, kMaxShiftHarmonics);
+}
+//
+// return TPC shift coefficient rows (harmonics 1-20) for ref9 and vz region: N (cos) and P (sin) terms
+//____________________________________________________________________________________________________________________
+Bool_t StEventPlaneMaker::GetTPCShiftRows(Int_t ref9, Int_t region_vz, Int_t method, Int_t ptbin, const Double_t *&shiftN, const Double_t *&shiftP) {
+  // binary calibration store
+  if(method >= 0 && method < kNTPCEPmethods && ptbin >= 0 && ptbin < kNTPCptAssocBins && fTPCShiftTab[method][ptbin]) {
+    const Double_t *tab = fTPCShiftTab[method][ptbin];
+    shiftN = tab + StEPCalibrationStore::ShiftIndex(0, ref9, region_vz, 1);
+    shiftP = tab + StEPCalibrationStore::ShiftIndex(1, ref9, region_vz, 1);
+    return kTRUE;
+  }
+
 /*
   if(tpc_apply_corr_switch) { // FIXME: file needs to exist and need to have ran recentering + shift prior
     // loop over harmonics
@@ -2997,7 +3395,7 @@ Double_t StEventPlaneMaker::GetTPCShiftingValue(Double_t tPhi_rcd, Int_t nharm,
 */
 
         // TPC event plane calculation method
-        switch(fTPCEPmethod) {
+        switch(method) {
           case kRemoveEtaStrip: // added new usage to this switch on May31
             // run flag switch
             if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
@@ -3006,97 +3404,122 @@ Double_t StEventPlaneMaker::GetTPCShiftingValue(Double_t tPhi_rcd, Int_t nharm,
                 // jet size switch
 
                 if(fJetRad == 0.5) { // Jet radius: R=0.5
-                  if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
-                    return (tpc_shift_N_bin0_Method1_R05_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin0_Method1_R05_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
-                    return (tpc_shift_N_bin1_Method1_R05_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin1_Method1_R05_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
-                    return (tpc_shift_N_bin2_Method1_R05_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin2_Method1_R05_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
-                    return (tpc_shift_N_bin3_Method1_R05_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin3_Method1_R05_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
-                    return (tpc_shift_N_bin4_Method1_R05_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin4_Method1_R05_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
+                  if(ptbin == 0) {         // 0.20-0.50 GeV
+                    shiftN = tpc_shift_N_bin0_Method1_R05_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin0_Method1_R05_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 1) {  // 0.50-1.00 GeV
+                    shiftN = tpc_shift_N_bin1_Method1_R05_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin1_Method1_R05_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 2) {  // 1.00-1.50 GeV
+                    shiftN = tpc_shift_N_bin2_Method1_R05_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin2_Method1_R05_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 3) {  // 1.50-2.00 GeV
+                    shiftN = tpc_shift_N_bin3_Method1_R05_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin3_Method1_R05_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 4) {  // 2.00-20.0 GeV
+                    shiftN = tpc_shift_N_bin4_Method1_R05_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin4_Method1_R05_Run14[ref9][region_vz];
+                    return kTRUE;
                   } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                 } // R=0.5
 
                 if(fJetRad == 0.4) { // Jet radius: R=0.4
-                  if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
-                    return (tpc_shift_N_bin0_Method1_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin0_Method1_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
-                    return (tpc_shift_N_bin1_Method1_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin1_Method1_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
-                    return (tpc_shift_N_bin2_Method1_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin2_Method1_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
-                    return (tpc_shift_N_bin3_Method1_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin3_Method1_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
-                    return (tpc_shift_N_bin4_Method1_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin4_Method1_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
+                  if(ptbin == 0) {         // 0.20-0.50 GeV
+                    shiftN = tpc_shift_N_bin0_Method1_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin0_Method1_R04_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 1) {  // 0.50-1.00 GeV
+                    shiftN = tpc_shift_N_bin1_Method1_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin1_Method1_R04_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 2) {  // 1.00-1.50 GeV
+                    shiftN = tpc_shift_N_bin2_Method1_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin2_Method1_R04_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 3) {  // 1.50-2.00 GeV
+                    shiftN = tpc_shift_N_bin3_Method1_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin3_Method1_R04_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 4) {  // 2.00-20.0 GeV
+                    shiftN = tpc_shift_N_bin4_Method1_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin4_Method1_R04_Run14[ref9][region_vz];
+                    return kTRUE;
                   } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                 } // R=0.4
 
                 if(fJetRad == 0.3) { // Jet radius: R=0.3
-                  if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
-                    return (tpc_shift_N_bin0_Method1_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin0_Method1_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
-                    return (tpc_shift_N_bin1_Method1_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin1_Method1_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
-                    return (tpc_shift_N_bin2_Method1_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin2_Method1_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
-                    return (tpc_shift_N_bin3_Method1_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin3_Method1_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
-                    return (tpc_shift_N_bin4_Method1_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin4_Method1_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
+                  if(ptbin == 0) {         // 0.20-0.50 GeV
+                    shiftN = tpc_shift_N_bin0_Method1_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin0_Method1_R03_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 1) {  // 0.50-1.00 GeV
+                    shiftN = tpc_shift_N_bin1_Method1_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin1_Method1_R03_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 2) {  // 1.00-1.50 GeV
+                    shiftN = tpc_shift_N_bin2_Method1_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin2_Method1_R03_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 3) {  // 1.50-2.00 GeV
+                    shiftN = tpc_shift_N_bin3_Method1_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin3_Method1_R03_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 4) {  // 2.00-20.0 GeV
+                    shiftN = tpc_shift_N_bin4_Method1_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin4_Method1_R03_Run14[ref9][region_vz];
+                    return kTRUE;
                   } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                 } // R=0.3
 
                 if(fJetRad == 0.2) { // Jet radius: R=0.2
-                  if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
-                    return (tpc_shift_N_bin0_Method1_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin0_Method1_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
-                    return (tpc_shift_N_bin1_Method1_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin1_Method1_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
-                    return (tpc_shift_N_bin2_Method1_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin2_Method1_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
-                    return (tpc_shift_N_bin3_Method1_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin3_Method1_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
-                    return (tpc_shift_N_bin4_Method1_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin4_Method1_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
+                  if(ptbin == 0) {         // 0.20-0.50 GeV
+                    shiftN = tpc_shift_N_bin0_Method1_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin0_Method1_R02_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 1) {  // 0.50-1.00 GeV
+                    shiftN = tpc_shift_N_bin1_Method1_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin1_Method1_R02_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 2) {  // 1.00-1.50 GeV
+                    shiftN = tpc_shift_N_bin2_Method1_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin2_Method1_R02_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 3) {  // 1.50-2.00 GeV
+                    shiftN = tpc_shift_N_bin3_Method1_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin3_Method1_R02_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 4) {  // 2.00-20.0 GeV
+                    shiftN = tpc_shift_N_bin4_Method1_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin4_Method1_R02_Run14[ref9][region_vz];
+                    return kTRUE;
                   } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                 } // R=0.2
 
                 if(fJetRad == 0.1) { // Jet radius: R=0.1
-                  if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
-                    return (tpc_shift_N_bin0_Method1_R01_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin0_Method1_R01_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
-                    return (tpc_shift_N_bin1_Method1_R01_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin1_Method1_R01_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
-                    return (tpc_shift_N_bin2_Method1_R01_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin2_Method1_R01_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
-                    return (tpc_shift_N_bin3_Method1_R01_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin3_Method1_R01_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
-                    return (tpc_shift_N_bin4_Method1_R01_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin4_Method1_R01_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
+                  if(ptbin == 0) {         // 0.20-0.50 GeV
+                    shiftN = tpc_shift_N_bin0_Method1_R01_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin0_Method1_R01_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 1) {  // 0.50-1.00 GeV
+                    shiftN = tpc_shift_N_bin1_Method1_R01_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin1_Method1_R01_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 2) {  // 1.00-1.50 GeV
+                    shiftN = tpc_shift_N_bin2_Method1_R01_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin2_Method1_R01_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 3) {  // 1.50-2.00 GeV
+                    shiftN = tpc_shift_N_bin3_Method1_R01_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin3_Method1_R01_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 4) {  // 2.00-20.0 GeV
+                    shiftN = tpc_shift_N_bin4_Method1_R01_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin4_Method1_R01_Run14[ref9][region_vz];
+                    return kTRUE;
                   } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                 } // R=0.1
 
@@ -3104,59 +3527,74 @@ Double_t StEventPlaneMaker::GetTPCShiftingValue(Double_t tPhi_rcd, Int_t nharm,
 
               if(fJetType == kChargedJet) {
                 if(fJetRad == 0.4) { // Jet radius: R=0.4
-                  if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
-                    return (tpc_shift_N_bin0_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin0_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
-                    return (tpc_shift_N_bin1_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin1_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
-                    return (tpc_shift_N_bin2_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin2_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
-                    return (tpc_shift_N_bin3_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin3_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
-                    return (tpc_shift_N_bin4_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin4_Method1ch_R04_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
+                  if(ptbin == 0) {         // 0.20-0.50 GeV
+                    shiftN = tpc_shift_N_bin0_Method1ch_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin0_Method1ch_R04_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 1) {  // 0.50-1.00 GeV
+                    shiftN = tpc_shift_N_bin1_Method1ch_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin1_Method1ch_R04_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 2) {  // 1.00-1.50 GeV
+                    shiftN = tpc_shift_N_bin2_Method1ch_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin2_Method1ch_R04_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 3) {  // 1.50-2.00 GeV
+                    shiftN = tpc_shift_N_bin3_Method1ch_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin3_Method1ch_R04_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 4) {  // 2.00-20.0 GeV
+                    shiftN = tpc_shift_N_bin4_Method1ch_R04_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin4_Method1ch_R04_Run14[ref9][region_vz];
+                    return kTRUE;
                   } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                 } // R=0.4
 
                 if(fJetRad == 0.3) { // Jet radius: R=0.3
-                  if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
-                    return (tpc_shift_N_bin0_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin0_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
-                    return (tpc_shift_N_bin1_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin1_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
-                    return (tpc_shift_N_bin2_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin2_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
-                    return (tpc_shift_N_bin3_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin3_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
-                    return (tpc_shift_N_bin4_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin4_Method1ch_R03_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
+                  if(ptbin == 0) {         // 0.20-0.50 GeV
+                    shiftN = tpc_shift_N_bin0_Method1ch_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin0_Method1ch_R03_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 1) {  // 0.50-1.00 GeV
+                    shiftN = tpc_shift_N_bin1_Method1ch_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin1_Method1ch_R03_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 2) {  // 1.00-1.50 GeV
+                    shiftN = tpc_shift_N_bin2_Method1ch_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin2_Method1ch_R03_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 3) {  // 1.50-2.00 GeV
+                    shiftN = tpc_shift_N_bin3_Method1ch_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin3_Method1ch_R03_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 4) {  // 2.00-20.0 GeV
+                    shiftN = tpc_shift_N_bin4_Method1ch_R03_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin4_Method1ch_R03_Run14[ref9][region_vz];
+                    return kTRUE;
                   } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                 } // R=0.3
 
                 if(fJetRad == 0.2) { // Jet radius: R=0.2
-                  if(fTPCptAssocBin == 0) {         // 0.20-0.50 GeV
-                    return (tpc_shift_N_bin0_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin0_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 1) {  // 0.50-1.00 GeV
-                    return (tpc_shift_N_bin1_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin1_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 2) {  // 1.00-1.50 GeV
-                    return (tpc_shift_N_bin2_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin2_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 3) {  // 1.50-2.00 GeV
-                    return (tpc_shift_N_bin3_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin3_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
-                  } else if(fTPCptAssocBin == 4) {  // 2.00-20.0 GeV
-                    return (tpc_shift_N_bin4_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                            tpc_shift_P_bin4_Method1ch_R02_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
+                  if(ptbin == 0) {         // 0.20-0.50 GeV
+                    shiftN = tpc_shift_N_bin0_Method1ch_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin0_Method1ch_R02_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 1) {  // 0.50-1.00 GeV
+                    shiftN = tpc_shift_N_bin1_Method1ch_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin1_Method1ch_R02_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 2) {  // 1.00-1.50 GeV
+                    shiftN = tpc_shift_N_bin2_Method1ch_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin2_Method1ch_R02_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 3) {  // 1.50-2.00 GeV
+                    shiftN = tpc_shift_N_bin3_Method1ch_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin3_Method1ch_R02_Run14[ref9][region_vz];
+                    return kTRUE;
+                  } else if(ptbin == 4) {  // 2.00-20.0 GeV
+                    shiftN = tpc_shift_N_bin4_Method1ch_R02_Run14[ref9][region_vz];
+                    shiftP = tpc_shift_P_bin4_Method1ch_R02_Run14[ref9][region_vz];
+                    return kTRUE;
                   } else { cout<<"NOT CONFIGURED PROPERLY, please select pt assoc bin!"<<endl; }
                 } // R=0.2
 
@@ -2,6 +2,7 @@
 #define StEventPlaneMaker_h
 
 #include "StJetFrameworkPicoBase.h"
+#include <vector>
 class StJetFrameworkPicoBase;
 
 // ROOT classes
@@ -28,6 +29,7 @@ class StJet;
 class StRho;
 class StRhoParameter;
 class StCentMaker;
+class StEPCalibrationStore;
 
 //class StEventPlaneMaker : public StMaker {
 class StEventPlaneMaker : public StJetFrameworkPicoBase {
@@ -52,6 +54,9 @@ class StEventPlaneMaker : public StJetFrameworkPicoBase {
       kEPD = 4
     };
 
+    // TPC event plane: pt assoc bins and jet removal methods (StJetFrameworkPicoBase::fTPCEPmethodEnum)
+    enum { kNTPCptAssocBins = 5, kNTPCEPmethods = 7 };
+
     StEventPlaneMaker(const char *name, StPicoDstMaker *picoMaker, const char *jetMakerName, const char *rhoMakerName);
     virtual ~StEventPlaneMaker();
    
@@ -127,14 +132,21 @@ class StEventPlaneMaker : public StJetFrameworkPicoBase {
     virtual void            SetdoEventPlaneRes(Bool_t depr)                 {doEventPlaneRes = depr; }
     virtual void            SetdoEPTPCptAssocMethod(Bool_t ptbin)           {doTPCptassocBin = ptbin; }
     virtual void            SetEPTPCptAssocBin(Int_t pb)                    {fTPCptAssocBin = pb; }
+    virtual void            SetdoEPTPCAllPtAssocBins(Bool_t all)            {doAllTPCptAssocBins = all; } // all pt assoc bins + methods in one maker
 
     // Where to read calib object with EP calibration if not default
     void                    SetEPcalibFileName(TString filename)            {fEPcalibFileName = filename; } 
+    void                    SetEPcalibStoreFileName(TString filename)       {fEPcalibStoreFileName = filename; } // binary store, see macros/makeEPCalibrationStore.C
     void                    SetOutFileNameEP(TString epout)                 {mOutNameEP = epout; }
     virtual void            SetdoReadCalibFile(Bool_t rc)                   {doReadCalibFile = rc; } 
 
     // get functions:
     Double_t                GetTPCEP()                { return TPC_PSI2; }
+    Double_t                GetTPCEP(Int_t ptbin) const                     { return GetTPCEP(ptbin, fTPCEPmethod); }
+    Double_t                GetTPCEP(Int_t ptbin, Int_t method) const;
+    Double_t                GetTPCEPA(Int_t ptbin) const;
+    Double_t                GetTPCEPB(Int_t ptbin) const;
+    Bool_t                  GetdoEPTPCAllPtAssocBins() const                { return doAllTPCptAssocBins; }
 
   protected:
     TH1                    *FillEmcTriggersHist(TH1 *h);                          // EmcTrigger counter histo
@@ -144,12 +156,18 @@ class StEventPlaneMaker : public StJetFrameworkPicoBase {
     void                    CalculateEventPlaneResolution(Double_t bbc, Double_t zdc, Double_t tpc, Double_t tpcN, Double_t tpcP, Double_t bbc1, Double_t zdc1);
     static Double_t         CalculateEventPlaneChi(Double_t res);
     Double_t                GetEventPlaneAngle(TString det, Int_t order, Int_t correction, TString subevt);
-    Double_t                GetTPCRecenterValue(Double_t randomNum, TString coordinate, Int_t ref9, Int_t region_vz);
-    Double_t                GetTPCShiftingValue(Double_t tPhi_rcd, Int_t nharm, Int_t ref9, Int_t region_vz);
+    Double_t                GetTPCRecenterValue(Double_t randomNum, TString coordinate, Int_t ref9, Int_t region_vz, Int_t method, Int_t ptbin);
+    Double_t                GetTPCShiftCorrection(Double_t tPhi_rcd, Int_t ref9, Int_t region_vz, Int_t method, Int_t ptbin); // all harmonics
+    Bool_t                  GetTPCShiftRows(Int_t ref9, Int_t region_vz, Int_t method, Int_t ptbin, const Double_t *&shiftN, const Double_t *&shiftP);
+    Double_t                GetTPCShiftedEP(Double_t Qx, Double_t Qy, Int_t n, Int_t ref9, Int_t region_vz, Int_t method, Int_t ptbin);
 
     // Added from Liang
     void                    QvectorCal(int ref9, int region_vz, int n, int ptbin);
     Int_t                   EventPlaneCal(int ref9, int region_vz, int n, int ptbin);
+    Int_t                   TPCEventPlaneFromQvectors(int ref9, int region_vz, int n);
+    void                    QvectorCalAllBins(int ref9, int region_vz, int n);
+    Int_t                   EventPlaneCalAllBins(int ref9, int region_vz, int n);
+    void                    FlagJetRemovalTracks();  // tracks around the leading (+ subleading) jet, once per event
     Int_t                   BBC_EP_Cal(int ref9, int region_vz, int n); //refmult, the region of vz, and order of EP
     Int_t                   ZDC_EP_Cal(int ref9, int region_vz, int n);
     Double_t                BBC_GetPhi(int e_w,int iTile); //east == 0
@@ -160,6 +178,7 @@ class StEventPlaneMaker : public StJetFrameworkPicoBase {
     Bool_t                  doEventPlaneRes;         // event plane resolution switch
     Bool_t                  doTPCptassocBin;         // TPC event plane calculated on a pt assoc bin basis
     Int_t                   fTPCptAssocBin;          // pt associated bin to calculate event plane for
+    Bool_t                  doAllTPCptAssocBins;     // TPC event plane for all pt assoc bins and methods in one track loop
     Bool_t                  doReadCalibFile;         // read calibration file switch
 
     // event selection types
@@ -215,9 +234,37 @@ class StEventPlaneMaker : public StJetFrameworkPicoBase {
     Double_t                ZDC_raw_east;
     Double_t                ZDC_raw_west;
 
+    // TPC event plane angles per method and pt assoc bin (doAllTPCptAssocBins mode)
+    Double_t                fTPCEPbin[kNTPCEPmethods][kNTPCptAssocBins];
+    Double_t                fTPCAEPbin[kNTPCEPmethods][kNTPCptAssocBins];
+    Double_t                fTPCBEPbin[kNTPCEPmethods][kNTPCptAssocBins];
+    std::vector<Double_t>   fRandomSequence;         // sub-event random numbers: same TRandom3 sequence each event, as in QvectorCal
+
+    // leading (+ subleading) jet removal flags per PicoDst track index, filled by FlagJetRemovalTracks()
+    enum fJetRemovalFlagEnum {
+      kInLeadingJetStrip    = BIT(0), // |eta - eta_jet| < fJetRad*fExcludeLeadingJetsFromFit
+      kInSubLeadingJetStrip = BIT(1),
+      kInLeadingJetCone     = BIT(2), // deltaR < fJetRad
+      kInSubLeadingJetCone  = BIT(3)
+    };
+    std::vector<UChar_t>    fJetRemovalFlags;
+
   private:
     Int_t                   fRunNumber;
     TString                 fEPcalibFileName; 
+    TString                 fEPcalibStoreFileName;   // binary calibration store, compiled-in headers used if empty
+
+    // calibration tables resolved at Init from the binary store (0x0: use compiled-in headers)
+    StEPCalibrationStore   *fEPCalibStore;           //!
+    const Double_t         *fTPCRecenterTab[kNTPCEPmethods][kNTPCptAssocBins]; //! [4][9][20]
+    const Double_t         *fTPCShiftTab[kNTPCEPmethods][kNTPCptAssocBins];    //! [2][9][20][20]
+    const Double_t         *fBBCRecenterTab;         //! [4][fBBCRecenterNRuns]
+    const Double_t         *fZDCRecenterTab;         //! [4][fZDCRecenterNRuns]
+    Int_t                   fBBCRecenterNRuns;
+    Int_t                   fZDCRecenterNRuns;
+    const Double_t         *fBBCShiftTab;            //! [2][9][20][20]
+    const Double_t         *fZDCShiftTab;            //! [2][9][20][20]
+    void                    ResolveCalibrationTables();
     Double_t                fEPTPCResolution;
     Double_t                fEPTPCn;
     Double_t                fEPTPCp;
@@ -329,15 +376,12 @@ class StEventPlaneMaker : public StJetFrameworkPicoBase {
     TProfile              *fProfV4Resolution[9];//! resolution parameters for v4
     TProfile              *fProfV5Resolution[9];//! resolution parameters for v5
 
-    // bad run list 
-    std::set<Int_t>        badRuns;
-
     // base class pointer object
     StJetFrameworkPicoBase *mBaseMaker;
 
     // maker names
     TString                fAnalysisMakerName;
                 
-    ClassDef(StEventPlaneMaker, 2)
+    ClassDef(StEventPlaneMaker, 4)
 };
 #endif
@@ -31,8 +31,8 @@
 
 // jet-framework includes
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 #include "StEventPoolManager.h"
-#include "StFemtoTrack.h"
 #include "StCentMaker.h"
 
 // old file kept
@@ -59,6 +59,7 @@ StEventPoolMaker::StEventPoolMaker(const char *name, StPicoDstMaker *picoMaker,
   fHistZvertBinMin = 0;
   fHistZvertBinMax = 20;             // (-40, 40) 4cm bins
   fPoolMgr = 0x0;
+  fMixTracks = 0x0;
   fRunNumber = 0;
   mPicoDstMaker = 0x0;
   mPicoDst = 0x0;
@@ -114,6 +115,7 @@ StEventPoolMaker::~StEventPoolMaker()
   if(hMixEvtStatZvsCent)  delete hMixEvtStatZvsCent;
 
   fPoolMgr->Clear(); delete fPoolMgr;
+  if(fMixTracks) delete fMixTracks;
 }
 //
 //__________________________________________________________________________________________
@@ -123,6 +125,9 @@ Int_t StEventPoolMaker::Init() {
   // initialize the histograms
   DeclareHistograms();
 
+  // track columns for the event pools - reused every event
+  fMixTracks = new StEventPoolTracks();
+
   return kStOK;
 }
 //
@@ -131,6 +136,9 @@ Int_t StEventPoolMaker::Init() {
 Int_t StEventPoolMaker::Finish() { 
   cout << "StEventPoolMaker::Finish()\n";
 
+  // event pool memory
+  if(fPoolMgr) fPoolMgr->PrintMemoryUsage();
+
   //  Write histos to file and close it.
   if(mOutName!="") {
     TFile *fout = new TFile(mOutName.Data(), "UPDATE");
@@ -292,13 +300,11 @@ Int_t StEventPoolMaker::Make() {
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 35.0 GeV (30 Oct25, 2018)
@@ -371,10 +377,11 @@ Int_t StEventPoolMaker::Make() {
   if(fDebugLevel == kDebugEmcTrigger) cout<<endl;
 
   // check for MB/HT event
-  bool fHaveMBevent = CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30); 
-  bool fHaveEmcTrigger = CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent = HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30); 
+  bool fHaveEmcTrigger = HasHTTrigger(fTrigMask, fEmcTriggerEventType);
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if(doppAnalysis)  fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;
   if(!doppAnalysis) fRunForMB = (fHaveMB5event || fHaveMB30event) ? kTRUE : kFALSE;
@@ -403,7 +410,7 @@ Int_t StEventPoolMaker::Make() {
     if(fRunForMB) { // kMB5 or kMB30 (don't exclude HT)
     //if(fRunForMB && (!fHaveEmcTrigger)) { // kMB5 or kMB30 excluding HT
       // create a list of reduced objects. This speeds up processing and reduces memory consumption for the event pool
-      pool->UpdatePool(CloneAndReduceTrackList());
+      pool->UpdatePool(ReduceTrackList());
 
     } // MB 
   }
@@ -457,7 +464,7 @@ Int_t StEventPoolMaker::Make() {
     if(fRunForMB) { // kMB or kMB30 (don't exclude HT)
     //if(fRunForMB && (!fHaveEmcTrigger)) { // kMB or kMB30 (excluding HT)
       // create a list of reduced objects. This speeds up processing and reduces memory consumption for the event pool
-      pool->UpdatePool(CloneAndReduceTrackList());
+      pool->UpdatePool(ReduceTrackList());
 
       // fill QA histo's
       hMixEvtStatZVtx->Fill(zVtx);
@@ -470,17 +477,14 @@ Int_t StEventPoolMaker::Make() {
 }
 //
 //________________________________________________________________________________
-TClonesArray *StEventPoolMaker::CloneAndReduceTrackList()
+StEventPoolTracks *StEventPoolMaker::ReduceTrackList()
 {
-  // clones a track list by using StPicoTrack which uses much less memory (used for event mixing)
-  //  TClonesArray *tracksClone = new TClonesArray("StPicoTrack"); // original way
-  TClonesArray *tracksClone = new TClonesArray("StFemtoTrack");
-//  tracksClone->SetName("tracksClone");
-//  tracksClone->SetOwner(kTRUE);
+  // reduces the track list to pt, eta, phi, charge columns (used for event mixing)
+  //  - columns are refilled every event and copied into the pool arena: no allocation per track
 
   // construct variables, get # of tracks
   int nMixTracks = mPicoDst->numberOfTracks();
-  int iterTrk = 0;
+  fMixTracks->Clear();
   //const double pi = 1.0*TMath::Pi();
 
   // loop over tracks
@@ -519,19 +523,11 @@ TClonesArray *StEventPoolMaker::CloneAndReduceTrackList()
     }
 */
 
-    // create StFemtoTracks out of accepted tracks - light-weight object for mixing
-    //  StFemtoTrack *t = new StFemtoTrack(pt, eta, phi, charge);
-    StFemtoTrack *t = new StFemtoTrack(trk, Bfield, mVertex, doUsePrimTracks);
-    if(!t) continue;
-
-    // add light-weight tracks passing cuts to TClonesArray
-    ((*tracksClone)[iterTrk]) =  t;
-
-    //delete t;
-    ++iterTrk;
+    // add accepted tracks to light-weight columns for mixing
+    fMixTracks->AddTrack(mTrkMom.Perp(), mTrkMom.PseudoRapidity(), mTrkMom.Phi(), trk->charge());
   } // end of looping through tracks
 
-  return tracksClone;
+  return fMixTracks;
 }
 //
 //
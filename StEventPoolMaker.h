@@ -22,6 +22,7 @@ class StPicoTrack;
 // jet-framework classes
 class StEventPoolManager;
 class StEventPool;
+class StEventPoolTracks;
 class StCentMaker;
 
 class StEventPoolMaker : public StJetFrameworkPicoBase {
@@ -122,8 +123,9 @@ class StEventPoolMaker : public StJetFrameworkPicoBase {
     Int_t                   fHistZvertBinMax;            // min z-vertex bin for histogram loop
 
     // event pool
-    TClonesArray           *CloneAndReduceTrackList();
+    StEventPoolTracks      *ReduceTrackList();
     StEventPoolManager     *fPoolMgr;//!  // event pool Manager object
+    StEventPoolTracks      *fMixTracks;//! // track columns added to event pool, reused every event
 
   private:
     Int_t                   fRunNumber;
@@ -149,9 +151,6 @@ class StEventPoolMaker : public StJetFrameworkPicoBase {
     // base class pointer
     StJetFrameworkPicoBase *mBaseMaker;
 
-    // bad run list set
-    std::set<Int_t>        badRuns;
-
     // maker names
     TString                fAnalysisMakerName;
     TString                fEventMixerMakerName;
@@ -1,9 +1,13 @@
 #include "StEventPoolManager.h"
+#include "StFemtoTrack.h"
 
 // ROOT includes
 #include "TList.h"
 #include "TRandom.h"
+#include "TBuffer.h"
 #include <iostream>
+#include <algorithm>
+#include <string.h>
 
 // namespaces
 using std::cout;
@@ -11,6 +15,11 @@ using std::endl;
 
 ClassImp(StEventPool)
 
+namespace {
+  // global event counter of all pools
+  Int_t gPoolEventIndex = -1;
+}
+
 //_______________________________________________________________________________________________
 void StEventPool::PrintInfo() const
 {
@@ -21,6 +30,9 @@ void StEventPool::PrintInfo() const
   cout << Form("%20s: %.1f to %.1f", "Z-vtx range", fZvtxMin, fZvtxMax) << endl;
   cout << Form("%20s: %.1f to %.1f", "Psi range", fPsiMin, fPsiMax) << endl;
   cout << Form("%20s: %.1f to %.1f", "Pt range", fPtMin, fPtMax) << endl;
+  if(!fArena.empty())
+    cout << Form("%20s: %d tracks, %.2f MB, %d early evictions", "Track arena",
+                 fArenaCapacity, GetMemoryUsage()/1048576., fNArenaEvictions) << endl;
 
   return;
 }
@@ -44,17 +56,6 @@ Bool_t StEventPool::EventMatchesBin(Double_t mult, Double_t zvtx, Double_t psi,
   return (multOK && zvtxOK && psiOK && ptOK);
 }
 
-//_______________________________________________________________________________________________
-Int_t StEventPool::NTracksInPool() const
-{
-  // Number of tracks for this cent, zvtx bin; possibly includes many events.
-  Int_t ntrk = 0;
-  for (Int_t i = 0; i < (Int_t)fEvents.size(); ++i) {
-    ntrk += fNTracksInEvent.at(i);
-  }
-  return ntrk;
-}
-
 //_______________________________________________________________________________________________
 Int_t StEventPool::SetEventMultRange(Int_t multMin, Int_t multMax)
 {
@@ -108,6 +109,211 @@ Int_t StEventPool::GlobalEventIndex(Int_t j) const
   return fEventIndex.at(j);
 }
 
+//_______________________________________________________________________________________________
+Bool_t StEventPool::RemoveFirstEventCheck(Int_t nTrk, Int_t mult) const
+{
+  // remove 0th element before appending an event with <mult> tracks
+  if(nTrk > fTargetTrackDepth) {
+    Int_t nTrksFirstEvent= fNTracksInEvent.front();
+    Int_t diff = nTrk - nTrksFirstEvent + mult;
+    if(diff > fTargetTrackDepth)
+      return kTRUE;
+  }
+
+  return kFALSE;
+}
+
+//_______________________________________________________________________________________________
+void StEventPool::RemoveFirstEvent()
+{
+  // remove oldest event: TObjArray events are deleted, arena events only release their slot
+  if(!fEvents.empty()) {
+    TObjArray *fa = fEvents.front();
+    delete fa;
+    fEvents.pop_front();         // remove first track array 
+  }
+  if(!fEventOffset.empty()) fEventOffset.pop_front();
+  fNTracksInPool -= fNTracksInEvent.front();
+  fNTracksInEvent.pop_front(); // remove first int
+  fEventIndex.pop_front();
+
+  if(fNTracksInEvent.empty()) fArenaTail = 0;
+}
+
+//_______________________________________________________________________________________________
+void StEventPool::AllocateArena(Int_t nTracks)
+{
+  // allocate track arena once: room for the target track depth plus a few large events,
+  // which covers the pool after the eviction policy plus the gap left when wrapping around
+  // beyond that the oldest events are evicted early, so pool memory stays bounded
+  // only called for an empty pool: the arena grows only if a single event does not fit
+  Int_t capacity = fArenaCapacity;
+  if(capacity <= 0) capacity = fTargetTrackDepth + 4*kArenaEventReserve;
+  if(capacity < nTracks) {
+    if(!fArena.empty())
+      cout << "StEventPool: event with " << nTracks << " tracks exceeds track arena of " << fArenaCapacity << ", growing arena" << endl;
+    capacity = nTracks;
+  }
+
+  fArenaCapacity = capacity;
+  fArena.assign((ULong64_t)kNArenaColumns*fArenaCapacity, 0.);
+  fArenaTail = 0;
+}
+
+//_______________________________________________________________________________________________
+Int_t StEventPool::ArenaSlot(Int_t nTracks) const
+{
+  // first track of a contiguous free slot of <nTracks> in the ring buffer, -1 if none
+  // live tracks are [head, tail) or, after wrapping, [head, capacity) + [0, tail)
+  if(nTracks > fArenaCapacity) return -1;
+  if(fEventOffset.empty()) return 0;
+
+  Int_t head = fEventOffset.front();
+  if(fArenaTail > head) {
+    if(fArenaTail + nTracks <= fArenaCapacity) return fArenaTail;
+    if(nTracks <= head) return 0;    // wrap around
+    return -1;
+  }
+
+  if(fArenaTail + nTracks <= head) return fArenaTail;
+  return -1;
+}
+
+//_______________________________________________________________________________________________
+Int_t StEventPool::CompactArena(std::vector<Float_t> &arena, deque<int> &offsets) const
+{
+  // copy the tracks of the pooled events back to back into <arena>: column stride = number of
+  // live tracks, <offsets> are the event offsets in it - returns the number of live tracks
+  Int_t nLive = 0;
+  for(Int_t i = 0; i < (Int_t)fEventOffset.size(); i++) nLive += fNTracksInEvent.at(i);
+
+  arena.assign((ULong64_t)kNArenaColumns*nLive, -1.);
+  offsets.clear();
+  Bool_t haveEff = (fArena.size() >= (ULong64_t)kNArenaColumns*fArenaCapacity);
+  Int_t pos = 0;
+  for(Int_t i = 0; i < (Int_t)fEventOffset.size(); i++) {
+    Int_t n = fNTracksInEvent.at(i);
+    for(Int_t col = 0; col < kNArenaColumns; col++) {
+      if(col == kNArenaColumns - 1 && !haveEff) continue; // no efficiency column: stays -1
+      if(n > 0) memcpy(&arena[(ULong64_t)col*nLive + pos], ArenaColumn(col) + fEventOffset.at(i), n*sizeof(Float_t));
+    }
+    offsets.push_back(pos);
+    pos += n;
+  }
+
+  return nLive;
+}
+
+//_______________________________________________________________________________________________
+void StEventPool::ExpandArena()
+{
+  // arena read back holds the live tracks back to back: copy them to the start of a ring buffer
+  // of fArenaCapacity tracks, so the pool can be filled further
+  Int_t nLive = (Int_t)(fArena.size()/kNArenaColumns);
+  if(fEventOffset.empty()) {
+    fArena.clear();
+    fArenaTail = 0;
+    return;
+  }
+  if(nLive == 0) {
+    AllocateArena(0);  // only empty events
+    return;
+  }
+
+  std::vector<Float_t> compact;
+  compact.swap(fArena);
+  if(fArenaCapacity < nLive) fArenaCapacity = nLive;
+  fArena.assign((ULong64_t)kNArenaColumns*fArenaCapacity, 0.);
+  for(Int_t col = 0; col < kNArenaColumns; col++)
+    memcpy(ArenaColumn(col), &compact[(ULong64_t)col*nLive], nLive*sizeof(Float_t));
+  fArenaTail = nLive;
+}
+
+//_______________________________________________________________________________________________
+Bool_t StEventPool::ConvertEvents()
+{
+  // pools saved before the track arena hold TObjArrays of tracks in fEvents: copy them into the
+  // arena, so they can be mixed with GetEventTracks() - only possible for StFemtoTrack tracks
+  if(fEvents.empty()) return kFALSE;
+
+  Int_t nTotal = 0;
+  for(Int_t i = 0; i < (Int_t)fEvents.size(); i++) {
+    TObjArray *tca = fEvents[i];
+    if(!tca) return kFALSE;
+    for(Int_t j = 0; j < tca->GetEntriesFast(); j++) {
+      if(!dynamic_cast<StFemtoTrack*>(tca->At(j))) return kFALSE;
+    }
+    nTotal += tca->GetEntriesFast();
+  }
+
+  fArena.clear();
+  AllocateArena(nTotal);
+  fEventOffset.clear();
+  fNTracksInEvent.clear();
+  Int_t offset = 0;
+  for(Int_t i = 0; i < (Int_t)fEvents.size(); i++) {
+    TObjArray *tca = fEvents[i];
+    Int_t n = tca->GetEntriesFast();
+    for(Int_t j = 0; j < n; j++) {
+      StFemtoTrack *trk = static_cast<StFemtoTrack*>(tca->At(j));
+      ArenaColumn(0)[offset + j] = trk->Pt();
+      ArenaColumn(1)[offset + j] = trk->Eta();
+      ArenaColumn(2)[offset + j] = trk->Phi();
+      ArenaColumn(3)[offset + j] = trk->Charge();
+      ArenaColumn(4)[offset + j] = trk->ReWeightCorr();
+      ArenaColumn(5)[offset + j] = trk->MBTrig();
+      ArenaColumn(6)[offset + j] = -1.;
+    }
+    fEventOffset.push_back(offset);
+    fNTracksInEvent.push_back(n);
+    offset += n;
+    delete tca;
+  }
+  fEvents.clear();
+  fArenaTail = offset;
+  fNTracksInPool = offset;
+
+  return kTRUE;
+}
+
+//_______________________________________________________________________________________________
+void StEventPool::Streamer(TBuffer &R__b)
+{
+  // the track arena is written compacted to the live tracks of the pooled events and expanded
+  // to its capacity when read back, pools of version < 3 (TObjArray events) are converted to it
+  if(R__b.IsReading()) {
+    UInt_t R__s, R__c;
+    Version_t R__v = R__b.ReadVersion(&R__s, &R__c);
+    R__b.ReadClassBuffer(StEventPool::Class(), this, R__v, R__s, R__c);
+
+    // running track count not saved before version 4
+    if(R__v < 4) {
+      fNTracksInPool = 0;
+      for(Int_t i = 0; i < (Int_t)fNTracksInEvent.size(); i++) fNTracksInPool += fNTracksInEvent[i];
+    }
+
+    if(R__v < 3) ConvertEvents();
+    else if(R__v >= 6) ExpandArena();
+
+    // early version 3 pools did not save the arena: nothing to mix with
+    if(fEvents.empty() && fEventOffset.size() != fNTracksInEvent.size()) Clear();
+  } else {
+    // swap in the compact arena for writing, then restore the ring buffer
+    std::vector<Float_t> arena;
+    deque<int> offsets;
+    Int_t tail = fArenaTail;
+    fArenaTail = CompactArena(arena, offsets);
+    fArena.swap(arena);
+    fEventOffset.swap(offsets);
+
+    R__b.WriteClassBuffer(StEventPool::Class(), this);
+
+    fArena.swap(arena);
+    fEventOffset.swap(offsets);
+    fArenaTail = tail;
+  }
+}
+
 //_______________________________________________________________________________________________
 Int_t StEventPool::UpdatePool(TObjArray *trk)
 {
@@ -119,11 +325,16 @@ Int_t StEventPool::UpdatePool(TObjArray *trk)
   if(fLockFlag)
   {
     Form("Tried to fill a locked StEventPool.");
-    return fEvents.size();
+    return GetCurrentNEvents();
+  }
+  if(!fEventOffset.empty()) {
+    cout << "StEventPool::UpdatePool(): pool holds arena events, TObjArray not added" << endl;
+    delete trk;
+    return GetCurrentNEvents();
   }
 
-  static Int_t iEvent = -1; 
-  iEvent++;
+  gPoolEventIndex++;
+  Int_t iEvent = gPoolEventIndex;
 
   Int_t mult = trk->GetEntries();
   Int_t nTrk = NTracksInPool();
@@ -132,23 +343,108 @@ Int_t StEventPool::UpdatePool(TObjArray *trk)
     fNTimes++;
 
   // remove 0th element before appending this event
-  Bool_t removeFirstEvent = 0;
-  if(nTrk > fTargetTrackDepth) {
-    Int_t nTrksFirstEvent= fNTracksInEvent.front();
-    Int_t diff = nTrk - nTrksFirstEvent + mult;
-    if(diff > fTargetTrackDepth)
-      removeFirstEvent = 1;
+  if(RemoveFirstEventCheck(nTrk, mult)) RemoveFirstEvent();
+
+  fNTracksInEvent.push_back(mult);
+  fNTracksInPool += mult;
+  fEvents.push_back(trk);
+  fEventIndex.push_back(iEvent);
+
+  if(fNTimes == 1) {
+    fFirstFilled = kTRUE;
+    if (StEventPool::fDebug) {
+      cout << "\nPool " << MultBinIndex() << ", " << ZvtxBinIndex() << " ready at event "<< iEvent;
+      PrintInfo();
+      cout << endl;
+    }
+    fNTimes++; // See this message exactly once/pool
+  } else {
+    fFirstFilled = kFALSE;
   }
-  if(removeFirstEvent) {
-    TObjArray *fa = fEvents.front();
-    delete fa;
-    fEvents.pop_front();         // remove first track array 
-    fNTracksInEvent.pop_front(); // remove first int
-    fEventIndex.pop_front();
+
+  fWasUpdated = true;
+
+  if(StEventPool::fDebug) {
+    cout << " Event " << fEventIndex.back();
+    cout << " PoolDepth = " << GetCurrentNEvents(); 
+    cout << " NTracksInCurrentEvent = " << NTracksInCurrentEvent();
   }
 
+  return GetCurrentNEvents();
+}
+
+//_______________________________________________________________________________________________
+Int_t StEventPool::UpdatePool(const StEventPoolTracks *trk)
+{
+  // add track columns of current event - copied into the arena, <trk> can be reused
+  StEventPoolTrackView view;
+  view.n = trk->GetEntries();
+  view.pt = (view.n > 0) ? &trk->fPt[0] : 0x0;
+  view.eta = (view.n > 0) ? &trk->fEta[0] : 0x0;
+  view.phi = (view.n > 0) ? &trk->fPhi[0] : 0x0;
+  view.charge = (view.n > 0) ? &trk->fCharge[0] : 0x0;
+  view.weight = (view.n > 0) ? &trk->fWeight[0] : 0x0;
+  view.trig = (view.n > 0) ? &trk->fTrig[0] : 0x0;
+  view.eff = (view.n > 0) ? &trk->fEff[0] : 0x0;
+
+  return UpdatePool(view);
+}
+
+//_______________________________________________________________________________________________
+Int_t StEventPool::UpdatePool(const StEventPoolTrackView &trk)
+{
+  // Ring buffer in the preallocated track arena: the oldest events are removed (O(1))
+  // following the track depth policy, and further while the new event does not fit
+
+  if(fLockFlag)
+  {
+    Form("Tried to fill a locked StEventPool.");
+    return GetCurrentNEvents();
+  }
+  if(!fEvents.empty()) {
+    cout << "StEventPool::UpdatePool(): pool holds TObjArray events, tracks not added" << endl;
+    return GetCurrentNEvents();
+  }
+
+  gPoolEventIndex++;
+  Int_t iEvent = gPoolEventIndex;
+
+  Int_t mult = trk.n;
+  Int_t nTrk = NTracksInPool();
+
+  if(!IsReady() && IsReady(nTrk + mult, GetCurrentNEvents() + 1))
+    fNTimes++;
+
+  // remove 0th element before appending this event
+  if(RemoveFirstEventCheck(nTrk, mult)) RemoveFirstEvent();
+
+  // find contiguous slot in arena, arenas of older saved pools get the efficiency column added
+  if(fArena.empty()) AllocateArena(mult);
+  else if(fArena.size() < (ULong64_t)kNArenaColumns*fArenaCapacity) fArena.resize((ULong64_t)kNArenaColumns*fArenaCapacity, -1.);
+  Int_t offset = ArenaSlot(mult);
+  while(offset < 0 && GetCurrentNEvents() > 0) {
+    RemoveFirstEvent();
+    fNArenaEvictions++;
+    offset = ArenaSlot(mult);
+  }
+  if(offset < 0) {
+    AllocateArena(mult);
+    offset = 0;
+  }
+
+  // copy columns
+  if(mult > 0) {
+    const Float_t *src[kNArenaColumns] = {trk.pt, trk.eta, trk.phi, trk.charge, trk.weight, trk.trig, trk.eff};
+    for(Int_t col = 0; col < kNArenaColumns; col++) {
+      if(src[col]) memcpy(ArenaColumn(col) + offset, src[col], mult*sizeof(Float_t));
+      else         std::fill(ArenaColumn(col) + offset, ArenaColumn(col) + offset + mult, -1.f);
+    }
+  }
+  fArenaTail = offset + mult;
+
+  fEventOffset.push_back(offset);
   fNTracksInEvent.push_back(mult);
-  fEvents.push_back(trk);
+  fNTracksInPool += mult;
   fEventIndex.push_back(iEvent);
 
   if(fNTimes == 1) {
@@ -171,7 +467,7 @@ Int_t StEventPool::UpdatePool(TObjArray *trk)
     cout << " NTracksInCurrentEvent = " << NTracksInCurrentEvent();
   }
 
-  return fEvents.size();
+  return GetCurrentNEvents();
 }
 
 //_______________________________________________________________________________________________
@@ -188,8 +484,11 @@ Long64_t StEventPool::Merge(TCollection *hlist)
   while ( (tmpObj = static_cast<StEventPool*>(objIter())) )
   {
     // Update this pool (it won't get fuller than demanded)
+    // events are copied: <tmpObj> keeps ownership of its own events
     for(Int_t i = 0; i < (Int_t)tmpObj->fEvents.size(); i++)
-      UpdatePool(tmpObj->fEvents.at(i));
+      UpdatePool(static_cast<TObjArray*>(tmpObj->fEvents.at(i)->Clone()));
+    for(Int_t i = 0; i < (Int_t)tmpObj->fEventOffset.size(); i++)
+      UpdatePool(tmpObj->GetEventTracks(i));
   }
   fLockFlag = origLock;
   return hlist->GetEntries() + 1;
@@ -201,20 +500,32 @@ void StEventPool::Clear(Option_t *opt)
 {
   // Clear the pool without deleting the object
   // Don't touch lock or save flag here to be fully flexible
+  // the track arena stays allocated for refilling
+  for(Int_t i = 0; i < (Int_t)fEvents.size(); i++)
+    delete fEvents[i];
   fEvents.clear();
   fNTracksInEvent.clear();
   fEventIndex.clear();
-  fWasUpdated = 0;
-  fFirstFilled = 0;
+  fEventOffset.clear();
+  fNTracksInPool = 0;
+  fArenaTail = 0;
   fWasUpdated = 0;
   fFirstFilled = 0;
   fNTimes = 0;
 }
 
+//_______________________________________________________________________________________________
+ULong64_t StEventPool::GetMemoryUsage() const
+{
+  // bytes held by the track arena
+  return (ULong64_t)fArena.capacity()*sizeof(Float_t);
+}
+
 //_______________________________________________________________________________________________
 TObject *StEventPool::GetRandomTrack() const
 {
   // Get any random track from the pool, sampled with uniform probability.
+  if(fEvents.empty()) return 0x0;
   UInt_t ranEvt = gRandom->Integer(fEvents.size());
   TObjArray *tca = fEvents.at(ranEvt);
   UInt_t ranTrk = gRandom->Integer(tca->GetEntries());
@@ -235,9 +546,36 @@ TObjArray *StEventPool::GetEvent(Int_t i) const
   return tca;
 }
 
+//_______________________________________________________________________________________________
+StEventPoolTrackView StEventPool::GetEventTracks(Int_t i) const
+{
+  // track columns of pooled event i: contiguous arrays in the arena
+  StEventPoolTrackView view;
+  view.n = 0;
+  view.pt = view.eta = view.phi = view.charge = view.weight = view.trig = view.eff = 0x0;
+
+  if (i < 0 || i >= (Int_t)fEventOffset.size()) {
+    cout << "StEventPool::GetEventTracks(" 
+	 << i << "): Invalid index" << endl;
+    return view;
+  }
+
+  Int_t offset = fEventOffset.at(i);
+  view.n = fNTracksInEvent.at(i);
+  view.pt = ArenaColumn(0) + offset;
+  view.eta = ArenaColumn(1) + offset;
+  view.phi = ArenaColumn(2) + offset;
+  view.charge = ArenaColumn(3) + offset;
+  view.weight = ArenaColumn(4) + offset;
+  view.trig = ArenaColumn(5) + offset;
+  view.eff = (fArena.size() >= (ULong64_t)kNArenaColumns*fArenaCapacity) ? ArenaColumn(6) + offset : 0x0;
+  return view;
+}
+
 //_______________________________________________________________________________________________
 TObjArray *StEventPool::GetRandomEvent() const
 {
+  if(fEvents.empty()) return 0x0;
   UInt_t ranEvt = gRandom->Integer(fEvents.size());
   TObjArray *tca = fEvents.at(ranEvt);
   return tca;
@@ -456,6 +794,37 @@ void StEventPoolManager::SetTargetValues(Int_t trackDepth, Float_t fraction, Int
   }
 }
 
+//_______________________________________________________________________________________________
+void StEventPoolManager::SetArenaCapacity(Int_t nTracks)
+{
+  // sets track arena size (tracks per column) in all event pools, used at first fill
+  for(Int_t i = 0; i < (Int_t)fEvPool.size(); i++)
+    fEvPool.at(i)->SetArenaCapacity(nTracks);
+}
+
+//_______________________________________________________________________________________________
+ULong64_t StEventPoolManager::GetMemoryUsage() const
+{
+  // bytes held by the track arenas of all pools
+  ULong64_t bytes = 0;
+  for(Int_t i = 0; i < (Int_t)fEvPool.size(); i++)
+    bytes += fEvPool.at(i)->GetMemoryUsage();
+  return bytes;
+}
+
+//_______________________________________________________________________________________________
+void StEventPoolManager::PrintMemoryUsage() const
+{
+  Int_t nAllocated = 0, nEvictions = 0;
+  for(Int_t i = 0; i < (Int_t)fEvPool.size(); i++) {
+    if(fEvPool.at(i)->GetMemoryUsage() > 0) nAllocated++;
+    nEvictions += fEvPool.at(i)->GetNArenaEvictions();
+  }
+
+  cout << Form("StEventPoolManager: %d of %d pools allocated, track arenas %.2f MB, %d early evictions",
+               nAllocated, (Int_t)fEvPool.size(), GetMemoryUsage()/1048576., nEvictions) << endl;
+}
+
 //_______________________________________________________________________________________________
 void StEventPoolManager::ClearPools()
 {
@@ -608,17 +977,24 @@ StEventPool *StEventPoolManager::GetEventPool(Int_t centVal, Double_t zVtxVal, D
 //_______________________________________________________________________________________________
 StEventPool *StEventPoolManager::GetEventPool(Double_t centVal, Double_t zVtxVal, Double_t psiVal, Int_t iPt) const
 {
-  // Return appropriate pool for this centrality and z-vertex value.
-  for (Int_t iM = 0; iM < fNMultBins; iM++) {
-    for (Int_t iZ = 0; iZ < fNZvtxBins; iZ++) {
-      for (Int_t iP = 0; iP < fNPsiBins; iP++) {
-        StEventPool *pool = GetEventPool(iM, iZ, iP, iPt);
-        if (pool->EventMatchesBin(centVal, zVtxVal, psiVal, (pool->GetPtMin()+pool->GetPtMax())/2 ))
-          return pool;
-      }
-    }
-  }
-  return 0x0;
+  // Return appropriate pool for this centrality, z-vertex and psi value.
+  // bins are found by binary search on the edges given in InitEventPools
+  Int_t iM = FindBin(fMultBins, centVal);
+  Int_t iZ = FindBin(fZvtxBins, zVtxVal);
+  Int_t iP = FindBin(fPsiBins, psiVal);
+  if(iM < 0 || iZ < 0 || iP < 0) return 0x0;
+
+  return GetEventPool(iM, iZ, iP, iPt);
+}
+
+//_______________________________________________________________________________________________
+Int_t StEventPoolManager::FindBin(const std::vector<Double_t> &edges, Double_t val) const
+{
+  // bin i with edges[i] <= val < edges[i+1] (same as StEventPool::EventMatchesBin), -1 if outside
+  Int_t bin = std::upper_bound(edges.begin(), edges.end(), val) - edges.begin() - 1;
+  if(bin < 0 || bin >= (Int_t)edges.size() - 1) return -1;
+
+  return bin;
 }
 
 //_______________________________________________________________________________________________
@@ -26,6 +26,44 @@
 // namespaces
 using std::deque;
 
+// Track columns of one event to be added to a pool (structure of arrays).
+// Owned by the analysis maker and refilled every event: Clear() keeps the
+// allocated capacity, so filling a pool does not allocate per track.
+class StEventPoolTracks
+{
+ public:
+  StEventPoolTracks() {;}
+  ~StEventPoolTracks() {;}
+
+  void        Clear()                  { fPt.clear(); fEta.clear(); fPhi.clear(); fCharge.clear(); fWeight.clear(); fTrig.clear(); fEff.clear(); }
+  void        Reserve(Int_t n)         { fPt.reserve(n); fEta.reserve(n); fPhi.reserve(n); fCharge.reserve(n); fWeight.reserve(n); fTrig.reserve(n); fEff.reserve(n); }
+  Int_t       GetEntries()       const { return (Int_t)fPt.size(); }
+  void        AddTrack(Float_t pt, Float_t eta, Float_t phi, Float_t charge, Float_t weight = 1., Float_t trig = 0., Float_t eff = -1.)
+                { fPt.push_back(pt); fEta.push_back(eta); fPhi.push_back(phi); fCharge.push_back(charge); fWeight.push_back(weight); fTrig.push_back(trig); fEff.push_back(eff); }
+
+  std::vector<Float_t> fPt;            // track pt
+  std::vector<Float_t> fEta;           // track eta
+  std::vector<Float_t> fPhi;           // track phi
+  std::vector<Float_t> fCharge;        // track charge
+  std::vector<Float_t> fWeight;        // event re-weight of the mixed event
+  std::vector<Float_t> fTrig;          // trigger of the mixed event
+  std::vector<Float_t> fEff;           // tracking efficiency in the mixed event, -1 if not computed
+};
+
+// Read-only view of one pooled event: contiguous columns inside the pool arena,
+// valid until the pool is next updated or cleared
+struct StEventPoolTrackView
+{
+  Int_t          n;                    // number of tracks
+  const Float_t *pt;
+  const Float_t *eta;
+  const Float_t *phi;
+  const Float_t *charge;
+  const Float_t *weight;
+  const Float_t *trig;
+  const Float_t *eff;
+};
+
 class StEventPool : public TObject
 {
  public:
@@ -54,7 +92,13 @@ class StEventPool : public TObject
     fSaveFlag(0),
     fNTimes(0),
     fTargetFraction(1),
-    fTargetEvents(0)  {;} // default constructor needed for correct saving
+    fTargetEvents(0),
+    fArena(),
+    fArenaCapacity(0),
+    fArenaTail(0),
+    fEventOffset(0),
+    fNArenaEvictions(0),
+    fNTracksInPool(0)  {;} // default constructor needed for correct saving
 
  // 'explicit' added below to constructor to remove cppcheck warning - double check this one in particular FIXME TODO
  explicit StEventPool(Int_t d) 
@@ -82,7 +126,13 @@ class StEventPool : public TObject
     fSaveFlag(0),
     fNTimes(0),
     fTargetFraction(1),
-    fTargetEvents(0)  {;}
+    fTargetEvents(0),
+    fArena(),
+    fArenaCapacity(0),
+    fArenaTail(0),
+    fEventOffset(0),
+    fNArenaEvictions(0),
+    fNTracksInPool(0)  {;}
   
 
  StEventPool(Int_t d, Double_t multMin, Double_t multMax, 
@@ -113,27 +163,34 @@ class StEventPool : public TObject
     fSaveFlag(0),
     fNTimes(0),
     fTargetFraction(1),
-    fTargetEvents(0) {;}
+    fTargetEvents(0),
+    fArena(),
+    fArenaCapacity(0),
+    fArenaTail(0),
+    fEventOffset(0),
+    fNArenaEvictions(0),
+    fNTracksInPool(0) {;}
   
-  ~StEventPool() {;}
+  ~StEventPool() { Clear(); }
   
   Bool_t      EventMatchesBin(Int_t mult,    Double_t zvtx, Double_t psi=0., Double_t pt=0.) const;
   Bool_t      EventMatchesBin(Double_t mult, Double_t zvtx, Double_t psi=0., Double_t pt=0.) const;
   Bool_t      IsReady()                    const { return IsReady(NTracksInPool(), GetCurrentNEvents()); }
   Bool_t      IsFirstReady()               const { return fFirstFilled;   }
   Int_t       GetNTimes()                  const { return fNTimes;        }
-  Int_t       GetCurrentNEvents()          const { return fEvents.size(); }
+  Int_t       GetCurrentNEvents()          const { return fNTracksInEvent.size(); }
   Int_t       GlobalEventIndex(Int_t j)    const;
   TObject    *GetRandomTrack()             const;
   TObjArray  *GetRandomEvent()             const;
   TObjArray  *GetEvent(Int_t i)            const;
+  StEventPoolTrackView GetEventTracks(Int_t i) const;
   Int_t       MultBinIndex()               const { return fMultBinIndex; }
   Int_t       NTracksInEvent(Int_t iEvent) const;
   Int_t       NTracksInCurrentEvent()      const { return fNTracksInEvent.back(); }
   void        PrintInfo()                  const;
   Int_t       PsiBinIndex()                const { return fPsiBinIndex; }
   Int_t       PtBinIndex()                 const { return fPtBinIndex; }
-  Int_t       NTracksInPool()              const;
+  Int_t       NTracksInPool()              const { return fNTracksInPool; }
   Bool_t      WasUpdated()                 const { return fWasUpdated; }
   Int_t       ZvtxBinIndex()               const { return fZvtxBinIndex; }
   void        SetDebug(Bool_t b)                 { fDebug = b; }
@@ -162,7 +219,15 @@ class StEventPool : public TObject
   Double_t    GetZvtxMax() { return fZvtxMax; }
 
   Int_t       UpdatePool(TObjArray *trk);
+  Int_t       UpdatePool(const StEventPoolTracks *trk);
+  Int_t       UpdatePool(const StEventPoolTrackView &trk);
   Long64_t    Merge(TCollection *hlist);
+
+  // track arena of the pool: tracks per column (0: default, see AllocateArena)
+  void        SetArenaCapacity(Int_t nTracks)    { fArenaCapacity = nTracks; }
+  Int_t       GetArenaCapacity()           const { return fArenaCapacity; }
+  Int_t       GetNArenaEvictions()         const { return fNArenaEvictions; }
+  ULong64_t   GetMemoryUsage()             const;
 //  deque<TObjArray*> GetEvents() { return fEvents; }
 
 //  void        Clear();
@@ -170,6 +235,17 @@ class StEventPool : public TObject
 
 protected:
   Bool_t      IsReady(Int_t tracks, Int_t events) const { return (tracks >= fTargetFraction * fTargetTrackDepth) || ((fTargetEvents > 0) && (events >= fTargetEvents)); }
+  Bool_t      RemoveFirstEventCheck(Int_t nTrk, Int_t mult) const;
+  void        RemoveFirstEvent();
+  void        AllocateArena(Int_t nTracks);
+  Int_t       ArenaSlot(Int_t nTracks) const;
+  Float_t    *ArenaColumn(Int_t col)           { return &fArena[(ULong64_t)col*fArenaCapacity]; }
+  const Float_t *ArenaColumn(Int_t col)  const { return &fArena[(ULong64_t)col*fArenaCapacity]; }
+  Int_t       CompactArena(std::vector<Float_t> &arena, deque<int> &offsets) const; // live tracks only (for writing)
+  void        ExpandArena();                                                         // compact arena read back -> ring buffer
+  Bool_t      ConvertEvents();                                                       // TObjArray events of StFemtoTrack -> arena
+
+  enum { kNArenaColumns = 7, kArenaEventReserve = 2000 };
   
   deque<TObjArray*>     fEvents;              // Holds TObjArrays of MyTracklets
   deque<int>            fNTracksInEvent;      // Tracks in event
@@ -193,7 +269,15 @@ protected:
   Float_t               fTargetFraction;      // fraction of fTargetTrackDepth at which pool is ready (default: 1.0)
   Int_t                 fTargetEvents;        // if non-zero: number of filled events after which pool is ready regardless of fTargetTrackDepth (default: 0)
 
-  ClassDef(StEventPool,2) // Event pool class
+  // ring buffer of track columns: pt, eta, phi, charge, weight, trig, eff - each fArenaCapacity long
+  std::vector<Float_t>  fArena;               // track arena, allocated once on first update (saved with pool: live tracks only)
+  Int_t                 fArenaCapacity;       // tracks per column
+  Int_t                 fArenaTail;           // next free track slot in arena
+  deque<int>            fEventOffset;         // first track of each pooled event in arena
+  Int_t                 fNArenaEvictions;     //! events removed early because arena was full
+  Int_t                 fNTracksInPool;       // running sum of fNTracksInEvent
+
+  ClassDef(StEventPool,6) // Event pool class - custom Streamer
 };
 
 class StEventPoolManager : public TObject
@@ -246,6 +330,9 @@ public:
   void        SetTargetTrackDepth(Int_t d) { fTargetTrackDepth = d;} // Same as for G.E.P. class
   Int_t       UpdatePools(TObjArray *trk);
   void        SetDebug(Bool_t b) { fDebug = b; }
+  void        SetArenaCapacity(Int_t nTracks);
+  ULong64_t   GetMemoryUsage() const;
+  void        PrintMemoryUsage() const;
   void        SetTargetValues(Int_t trackDepth, Float_t fraction, Int_t events);
   Int_t       GetNumberOfAllBins() {return fNPtBins*fNMultBins*fNZvtxBins*fNPsiBins;}
   Int_t       GetNumberOfPtBins() {return fNPtBins;}
@@ -275,8 +362,9 @@ public:
 
   Int_t       GetBinIndex(Int_t iMult, Int_t iZvtx, Int_t iPsi, Int_t iPt) const {return fNZvtxBins*fNPsiBins*fNPtBins*iMult + fNPsiBins*fNPtBins*iZvtx + fNPtBins*iPsi + iPt;}
   Double_t   *GetBinning(const char *configuration, const char *tag, Int_t& nBins) const;
+  Int_t       FindBin(const std::vector<Double_t> &edges, Double_t val) const;
 
-  ClassDef(StEventPoolManager,2)
+  ClassDef(StEventPoolManager,3)
 };
 
 #endif
@@ -0,0 +1,283 @@
+// ################################################################
+// Author:  Joel Mazer for the STAR Collaboration
+// Affiliation: Rutgers University
+//
+// standard event selection: bad run, max track pt, max tower Et,
+// z-vertex and centrality cuts evaluated once per event, rejected
+// events skip the rest of the chain
+//
+// ################################################################
+
+#include "StEventSelectionMaker.h"
+#include "StRoot/StarRoot/StMemStat.h"
+
+// ROOT includes
+#include "TH1F.h"
+#include "TFile.h"
+#include "TVector3.h"
+
+// STAR includes
+#include "StRoot/StPicoEvent/StPicoDst.h"
+#include "StRoot/StPicoDstMaker/StPicoDstMaker.h"
+#include "StMaker.h"
+#include "StRoot/StPicoEvent/StPicoEvent.h"
+#include "StRoot/StPicoEvent/StPicoTrack.h"
+
+// jet-framework includes
+#include "StJetFrameworkPicoBase.h"
+#include "StCentMaker.h"
+#include "StRunContext.h"
+#include "StTrackCacheMaker.h"
+
+ClassImp(StEventSelectionMaker)
+
+// max track pt is found without a pt cut
+const Double_t StEventSelectionMaker::kMaxTrackPtCutMin = 0.0;
+const Double_t StEventSelectionMaker::kMaxTrackPtCutMax = 9999.;
+
+//______________________________________________________________________________
+StEventSelectionMaker::StEventSelectionMaker(const char* name, StPicoDstMaker *picoMaker, const char* outName = "", bool mDoComments = kFALSE)
+  : StJetFrameworkPicoBase(name)
+{
+  fDebugLevel = 0;
+  mPicoDstMaker = 0x0;
+  mPicoDst = 0x0;
+  mPicoEvent = 0x0;
+  mBaseMaker = 0x0;
+  mOutName = outName;
+  fCentMakerName = "CentMaker";
+  fCachedRunId = -99;
+  fCachedEventId = -99;
+  fSelected = kFALSE;
+  fFailedCut = kAllEvents;
+  fEvtMaxTrackPt = -99.;
+  fEvtMaxTowerEt = -99.;
+  fEvtZVtx = -999.;
+  fEvtRunNo = -999;
+  fEvtRef16 = -99;
+  fEvtCent16 = -99;
+  for(int i = 0; i < kNEventCuts; i++) fNPassed[i] = 0;
+  hEventSelection = 0x0;
+  doComments = mDoComments;
+  doSkipRejectedEvents = kTRUE;
+}
+
+//_____________________________________________________________________________
+StEventSelectionMaker::~StEventSelectionMaker()
+{ /*  */
+  // destructor
+  if(hEventSelection) delete hEventSelection;
+}
+
+//_____________________________________________________________________________
+Int_t StEventSelectionMaker::Init() {
+  // events passing each cut
+  hEventSelection = new TH1F("hEventSelection", "events passing cut", kNEventCuts, -0.5, kNEventCuts - 0.5);
+  const char *cutLabels[kNEventCuts] = {"all", "bad run", "max track pt", "max tower Et", "z-vertex", "cent unset", "cent selection"};
+  for(int i = 0; i < kNEventCuts; i++) hEventSelection->GetXaxis()->SetBinLabel(i + 1, cutLabels[i]);
+
+  return kStOK;
+}
+//
+// Function: print counters, write histogram
+//_____________________________________________________________________________
+Int_t StEventSelectionMaker::Finish() {
+  cout << "StEventSelectionMaker::Finish()\n";
+
+  // events passing each cut
+  for(int i = 0; i < kNEventCuts; i++) {
+    cout<<"  "<<hEventSelection->GetXaxis()->GetBinLabel(i + 1)<<": "<<fNPassed[i]<<endl;
+  }
+
+  //  Write histos to file and close it.
+  if(mOutName!="") {
+    TFile *fout = new TFile(mOutName.Data(), "UPDATE");
+    fout->cd();
+    fout->mkdir(GetName());
+    fout->cd(GetName());
+    hEventSelection->Write();
+
+    fout->cd();
+    fout->Write();
+    fout->Close();
+  }
+
+  cout<<"End of StEventSelectionMaker::Finish"<<endl;
+  StMemStat::PrintMem("End of Finish...");
+
+  return kStOK;
+}
+//
+// OTHER functions are written below
+//_____________________________________________________________________________
+void StEventSelectionMaker::Clear(Option_t *opt) {
+  // invalidate verdict
+  fCachedRunId = -99;
+  fCachedEventId = -99;
+  fSelected = kFALSE;
+}
+//
+// Function: set verdict for rejected event
+//_____________________________________________________________________________
+Int_t StEventSelectionMaker::Reject(Int_t cut) {
+  fSelected = kFALSE;
+  fFailedCut = cut;
+
+  if(fDebugLevel > 0) cout<<"StEventSelectionMaker: event rejected by cut "<<hEventSelection->GetXaxis()->GetBinLabel(cut + 1)<<endl;
+
+  return (doSkipRejectedEvents) ? kStSkip : kStOK;
+}
+//
+// Function: pt of hardest track passing the track quality cuts of this maker
+// - no pt range: tracks above the track pt max cut are what the max track pt event cut rejects
+//_____________________________________________________________________________
+Double_t StEventSelectionMaker::ComputeMaxTrackPt() {
+  double fMaxTrackPt = -99.;
+
+  // use shared track cache if available
+  StTrackCacheMaker *cache = GetTrackCache();
+  if(cache) {
+    for(int i = 0; i < cache->GetNumberOfTracks(); i++) {
+      if(!cache->PassCuts(i, kMaxTrackPtCutMin, kMaxTrackPtCutMax, fTrackEtaMinCut, fTrackEtaMaxCut, fTrackPhiMinCut, fTrackPhiMaxCut,
+                          fTrackDCAcut, fTracknHitsFit, fTracknHitsRatio)) { continue; }
+      if(cache->GetPt(i) > fMaxTrackPt) { fMaxTrackPt = cache->GetPt(i); }
+    }
+
+    return fMaxTrackPt;
+  }
+
+  // loop over all tracks
+  int nTrack = mPicoDst->numberOfTracks();
+  for(int i = 0; i < nTrack; i++) {
+    // get track pointer
+    StPicoTrack *track = static_cast<StPicoTrack*>(mPicoDst->track(i));
+    if(!track) { continue; }
+
+    // quality cuts, no pt range
+    if(!(AcceptTrack(track, Bfield, mVertex, kMaxTrackPtCutMin, kMaxTrackPtCutMax))) { continue; }
+
+    // get momentum vector of track - global or primary track
+    TVector3 mTrkMom;
+    if(doUsePrimTracks) {
+      mTrkMom = track->pMom();                // get primary track vector
+    } else {
+      mTrkMom = track->gMom(mVertex, Bfield); // get global track vector
+    }
+
+    // get max track
+    double pt = mTrkMom.Perp();
+    if(pt > fMaxTrackPt) { fMaxTrackPt = pt; }
+  }
+
+  return fMaxTrackPt;
+}
+//
+// Function: cached max track pt was found with these track cuts (track type, pt range and quality cuts)
+//_____________________________________________________________________________
+Bool_t StEventSelectionMaker::HasMaxTrackPtCuts(Bool_t usePrim, Double_t ptMin, Double_t ptMax, Double_t etaMin, Double_t etaMax,
+                                                Double_t phiMin, Double_t phiMax, Double_t dcaMax, Int_t nHitsFitMin, Double_t nHitsRatioMin) const {
+  return (usePrim == doUsePrimTracks && ptMin == kMaxTrackPtCutMin && ptMax == kMaxTrackPtCutMax &&
+          etaMin == fTrackEtaMinCut && etaMax == fTrackEtaMaxCut && phiMin == fTrackPhiMinCut && phiMax == fTrackPhiMaxCut &&
+          dcaMax == fTrackDCAcut && nHitsFitMin == fTracknHitsFit && nHitsRatioMin == fTracknHitsRatio);
+}
+//
+//  This method is called every event.
+//_____________________________________________________________________________
+Int_t StEventSelectionMaker::Make() {
+  fSelected = kFALSE;
+  fFailedCut = kAllEvents;
+  fCachedRunId = -99;
+  fCachedEventId = -99;
+
+  // get PicoDstMaker
+  mPicoDstMaker = static_cast<StPicoDstMaker*>(GetMaker("picoDst"));
+  if(!mPicoDstMaker) {
+    LOG_WARN << " No PicoDstMaker! Skip! " << endm;
+    return kStWarn;
+  }
+
+  // get PicoDst object from maker
+  mPicoDst = static_cast<StPicoDst*>(mPicoDstMaker->picoDst());
+  if(!mPicoDst) {
+    LOG_WARN << " No PicoDst! Skip! " << endm;
+    return kStWarn;
+  }
+
+  // get pointer to PicoEvent
+  mPicoEvent = static_cast<StPicoEvent*>(mPicoDst->event());
+  if(!mPicoEvent) {
+    LOG_WARN << " No PicoEvent! Skip! " << endm;
+    return kStWarn;
+  }
+
+  // get base class pointer
+  mBaseMaker = static_cast<StJetFrameworkPicoBase*>(GetMaker("baseClassMaker"));
+  if(!mBaseMaker) {
+    LOG_WARN << " No baseMaker! Skip! " << endm;
+    return kStWarn;
+  }
+
+  fNPassed[kAllEvents]++;
+  hEventSelection->Fill(kAllEvents);
+
+  // event B (magnetic) field and vertex 3-vector - used by the track cuts
+  Bfield = mPicoEvent->bField();
+  mVertex = mPicoEvent->primaryVertex();
+  zVtx = mVertex.z();
+
+  // event variables, computed once for all makers
+  // (this maker is not current yet, so the base class loops over tracks and towers)
+  const StRunContext *runContext = mBaseMaker->GetRunContext(mPicoEvent->runId(), fRunFlag);
+  fEvtRunNo = runContext->GetRunNo();
+  fEvtMaxTrackPt = ComputeMaxTrackPt();
+  fEvtMaxTowerEt = GetMaxTowerEt();
+  fEvtZVtx = zVtx;
+  fEvtRef16 = -99;
+  fEvtCent16 = -99;
+
+  // verdict below belongs to this event
+  fCachedRunId = mPicoEvent->runId();
+  fCachedEventId = mPicoEvent->eventId();
+
+  // bad run
+  if(doRejectBadRuns && !runContext->IsRunOK()) return Reject(kBadRun);
+  fNPassed[kBadRun]++;
+  hEventSelection->Fill(kBadRun);
+
+  // max track pt
+  if(fEvtMaxTrackPt > fMaxEventTrackPt) return Reject(kMaxTrackPt);
+  fNPassed[kMaxTrackPt]++;
+  hEventSelection->Fill(kMaxTrackPt);
+
+  // max tower Et
+  if(fEvtMaxTowerEt > fMaxEventTowerEt) return Reject(kMaxTowerEt);
+  fNPassed[kMaxTowerEt]++;
+  hEventSelection->Fill(kMaxTowerEt);
+
+  // z-vertex
+  if((zVtx < fEventZVtxMinCut) || (zVtx > fEventZVtxMaxCut)) return Reject(kZVertex);
+  fNPassed[kZVertex]++;
+  hEventSelection->Fill(kZVertex);
+
+  // centrality from CentMaker - no centrality cuts without it
+  mCentMaker = static_cast<StCentMaker*>(GetMaker(fCentMakerName));
+  if(mCentMaker) {
+    fEvtRef16 = mCentMaker->GetRef16();
+    fEvtCent16 = mCentMaker->GetCent16();
+  }
+
+  // unset centrality, > 80%
+  if(mCentMaker && fEvtCent16 == -1) return Reject(kCentUnset);
+  fNPassed[kCentUnset]++;
+  hEventSelection->Fill(kCentUnset);
+
+  // centrality selection for analysis, see StJetFrameworkPicoBase::fCentralityBinEnum
+  if(mCentMaker && fRequireCentSelection && !SelectAnalysisCentralityBin(fEvtRef16, fCentralitySelectionCut)) return Reject(kCentSelect);
+  fNPassed[kCentSelect]++;
+  hEventSelection->Fill(kCentSelect);
+
+  fSelected = kTRUE;
+  fFailedCut = kNEventCuts;
+
+  return kStOK;
+}
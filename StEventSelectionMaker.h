@@ -0,0 +1,124 @@
+#ifndef StEventSelectionMaker_h
+#define StEventSelectionMaker_h
+
+#include "StJetFrameworkPicoBase.h"
+class StJetFrameworkPicoBase;
+
+// ROOT classes
+class TH1F;
+
+// STAR classes
+class StPicoDst;
+class StPicoDstMaker;
+class StPicoEvent;
+
+/**
+ * @brief Standard event selection evaluated once per event for the whole chain
+ *
+ * Applies the standard event cuts in order: bad run, max track pt, max tower Et, z-vertex,
+ * unset centrality (> 80%) and the optional centrality selection. Rejected events return
+ * kStSkip, so the makers after this one are not called for them. The verdict and the event
+ * variables used by the cuts are cached for the downstream makers: GetMaxTrackPt() and
+ * GetMaxTowerEt() of the base class return the cached values instead of looping again.
+ * The max track pt is taken over the tracks passing the track quality cuts set on this maker
+ * without a pt range (a track pt max cut would hide the tracks the event cut is meant for);
+ * makers use it only if their own max track pt has the same cuts (HasMaxTrackPtCuts()).
+ * Events passing each cut are counted and printed (and written) in Finish().
+ *
+ * Add to the chain after the CentMaker (and TrackCacheMaker), the default name expected by
+ * consumers is "EventSelectionMaker".
+ */
+class StEventSelectionMaker : public StJetFrameworkPicoBase {
+  public:
+
+    // cuts in the order they are applied
+    enum fEventSelectionCutEnum {
+      kAllEvents   = 0,
+      kBadRun      = 1,
+      kMaxTrackPt  = 2,
+      kMaxTowerEt  = 3,
+      kZVertex     = 4,
+      kCentUnset   = 5,
+      kCentSelect  = 6,
+      kNEventCuts  = 7
+    };
+
+    // pt range of the max track pt: no pt cut
+    static const Double_t   kMaxTrackPtCutMin;
+    static const Double_t   kMaxTrackPtCutMax;
+
+    StEventSelectionMaker(const char *name, StPicoDstMaker *picoMaker, const char *outName, bool mDoComments);
+    virtual ~StEventSelectionMaker();
+
+    // class required functions
+    virtual Int_t Init();
+    virtual Int_t Make();
+    virtual void  Clear(Option_t *opt="");
+    virtual Int_t Finish();
+
+    // switches
+    virtual void            SetDebugLevel(Int_t l)             { fDebugLevel       = l; }
+    virtual void            SetRunFlag(Int_t f)                { fRunFlag          = f; }
+    virtual void            SetdoppAnalysis(Bool_t pp)         { doppAnalysis      = pp; }
+    virtual void            SetSkipRejectedEvents(Bool_t s)    { doSkipRejectedEvents = s; } // kStSkip for rejected events, else only the verdict is set
+    virtual void            SetCentMakerName(const char *cn)   { fCentMakerName    = cn; }
+
+    // event setters
+    virtual void            SetEventZVtxRange(Double_t zmi, Double_t zma) { fEventZVtxMinCut = zmi; fEventZVtxMaxCut = zma; }
+    virtual void            SetMaxEventTrackPt(Double_t mxpt)  { fMaxEventTrackPt = mxpt; }
+    virtual void            SetMaxEventTowerEt(Double_t mxEt)  { fMaxEventTowerEt = mxEt; }
+    virtual void            SetRejectBadRuns(Bool_t rj)        { doRejectBadRuns = rj; }
+    virtual void            SetCentralityBinCut(Int_t c)       { fCentralitySelectionCut = c; }
+    virtual void            SetRequireCentSelection(Bool_t t)  { fRequireCentSelection = t; }
+
+    // verdict and cached event variables - valid for the event given by IsCurrent()
+    Bool_t                  IsCurrent(Int_t runId, Int_t eventId) const { return (fCachedRunId == runId && fCachedEventId == eventId); }
+    Bool_t                  IsSelected() const                 { return fSelected; }
+    Int_t                   GetFailedCut() const               { return fFailedCut; }  // first failed cut, kNEventCuts if selected
+    Bool_t                  GetUsePrimaryTracks() const        { return doUsePrimTracks; }
+    Double_t                GetCachedMaxTrackPt() const        { return fEvtMaxTrackPt; }
+    Bool_t                  HasMaxTrackPtCuts(Bool_t usePrim, Double_t ptMin, Double_t ptMax, Double_t etaMin, Double_t etaMax,
+                                              Double_t phiMin, Double_t phiMax, Double_t dcaMax, Int_t nHitsFitMin, Double_t nHitsRatioMin) const; // cached max track pt has these track cuts
+    Double_t                GetCachedMaxTowerEt() const        { return fEvtMaxTowerEt; }
+    Double_t                GetZVtx() const                    { return fEvtZVtx; }
+    Int_t                   GetRunNo() const                   { return fEvtRunNo; }
+    Int_t                   GetRef16() const                   { return fEvtRef16; }
+    Int_t                   GetCent16() const                  { return fEvtCent16; }
+    Long64_t                GetNPassed(Int_t cut) const        { return (cut >= 0 && cut < kNEventCuts) ? fNPassed[cut] : 0; }
+
+  protected:
+    Int_t                   Reject(Int_t cut);             // set verdict for failed cut
+    Double_t                ComputeMaxTrackPt();           // max pt of tracks passing the quality cuts, no pt range
+
+    // cached event identifiers and verdict
+    Int_t                   fCachedRunId;                  // run ID of cached event
+    Int_t                   fCachedEventId;                // event ID of cached event
+    Bool_t                  fSelected;                     // event passed all cuts
+    Int_t                   fFailedCut;                    // first failed cut
+
+    // cached event variables
+    Double_t                fEvtMaxTrackPt;                // max track pt
+    Double_t                fEvtMaxTowerEt;                // max tower Et
+    Double_t                fEvtZVtx;                      // z-vertex
+    Int_t                   fEvtRunNo;                     // index of run in dataset run list
+    Int_t                   fEvtRef16;                     // 16 bin centrality, increasing % with bin
+    Int_t                   fEvtCent16;                    // 16 bin centrality from StRefMultCorr
+
+    // counters
+    Long64_t                fNPassed[kNEventCuts];         // events passing each cut (and all before)
+    TH1F                   *hEventSelection;//!            // same as histogram
+
+    // base class pointer object
+    StJetFrameworkPicoBase *mBaseMaker;
+
+    // maker names
+    TString                 fCentMakerName;
+
+  private:
+    // switches
+    bool                    doComments;
+    Bool_t                  doSkipRejectedEvents;
+
+    ClassDef(StEventSelectionMaker, 1)
+};
+#endif
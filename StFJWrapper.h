@@ -10,6 +10,7 @@
 #include <TLorentzVector.h>
 #include <vector>
 #include <TString.h>
+#include <TRandom3.h>
 
 // jet includes
 #include "FJ_includes.h"
@@ -29,11 +30,15 @@ class StFJWrapper
   virtual const char *ClassName()                            const { return "StFJWrapper";              }
   virtual void  Clear(const Option_t* /*opt*/ = "");
   virtual void  ClearMemory();
+  virtual void  ClearClusterSequences();
+  virtual void  ClearConfig();
   virtual void  CopySettingsFrom (const StFJWrapper& wrapper);
   virtual void  GetMedianAndSigma(Double_t& median, Double_t& sigma, Int_t remove = 0) const;
   fastjet::ClusterSequenceArea           *GetClusterSequence() const   { return fClustSeq;                 }
   fastjet::ClusterSequence               *GetClusterSequenceSA() const { return fClustSeqSA;               }
   fastjet::ClusterSequenceActiveAreaExplicitGhosts *GetClusterSequenceGhosts() const { return fClustSeqActGhosts; }
+  fastjet::ClusterSequenceAreaBase       *GetClusterSequenceAreaBase() const { return fClustSeqAreaBase;   } // Run(): fixed ghosts or standard area
+  const std::vector<fastjet::PseudoJet>&  GetFixedGhosts()     const { return fFixedGhosts;                }
   const std::vector<fastjet::PseudoJet>&  GetInputVectors()    const { return fInputVectors;               }
   const std::vector<fastjet::PseudoJet>&  GetInputGhosts()     const { return fInputGhosts;                }
   const std::vector<fastjet::PseudoJet>&  GetInclusiveJets()   const { return fInclusiveJets;              }
@@ -52,7 +57,13 @@ class StFJWrapper
   Bool_t                                  GetLegacyMode()            { return fLegacyMode; }
   Bool_t                                  GetDoFilterArea()          { return fDoFilterArea; }
   Double_t                                NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Int_t Option=0);
+  // C/A reclustering of the constituents of inclusive jet idx, made once per event and shared (e.g. by the jet utilities)
+  const fastjet::PseudoJet&               GetReclusteredJet(UInt_t idx);
   Double32_t                              NSubjettinessDerivativeSub(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Double_t JetR, fastjet::PseudoJet jet, Int_t Option=0);
+  // per-jet tau_1..nmax of inclusive jet idx (Algorithm 0 kt, 1 C/A, 2 anti-kt Radius axes), reclusters the jet constituents only
+  Int_t                                   JetNSubjettiness(UInt_t idx, Int_t Algorithm, Double_t tau[], Int_t nmax = 3, Double_t Beta = 1.0, Double_t Radius = 0.2, Double_t *openingAngle = 0) const;
+  // first-order shapes and GR of inclusive jet idx from one pass over its constituents, results are kept in the kernel
+  Int_t                                   JetShapes(UInt_t idx, StJetShapeKernel &kernel) const;
 #ifdef FASTJET_VERSION
 /*
   const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetMass()        const {return fGenSubtractorInfoJetMass        ; }
@@ -101,30 +112,39 @@ class StFJWrapper
   
   void SetName(const char *name)        { fName           = name;    }
   void SetTitle(const char *title)      { fTitle          = title;   }
-  void SetStrategy(const fastjet::Strategy &strat)                 { fStrategy = strat;  }
-  void SetAlgorithm(const fastjet::JetAlgorithm &algor)            { fAlgor    = algor;  }
-  void SetRecombScheme(const fastjet::RecombinationScheme &scheme) { fScheme   = scheme; }
-  void SetAreaType(const fastjet::AreaType &atype)                 { fAreaType = atype;  }
-  void SetNRepeats(Int_t nrepeat)       { fNGhostRepeats  = nrepeat; }
-  void SetGhostArea(Double_t gharea)    { fGhostArea      = gharea;  }
-  void SetMaxRap(Double_t maxrap)       { fMaxRap         = maxrap;  }
-  void SetR(Double_t r)                 { fR              = r;       }
-  void SetGridScatter(Double_t gridSc)  { fGridScatter    = gridSc;  }
-  void SetKtScatter(Double_t ktSc)      { fKtScatter      = ktSc;    }
-  void SetMeanGhostKt(Double_t meankt)  { fMeanGhostKt    = meankt;  }
-  void SetPluginAlgor(Int_t plugin)     { fPluginAlgor    = plugin;  }
+  // setters of the jet/area definition invalidate the configuration objects, rebuilt on the next Run()
+  void SetStrategy(const fastjet::Strategy &strat)                 { fStrategy = strat;  fConfigDirty = kTRUE; }
+  void SetAlgorithm(const fastjet::JetAlgorithm &algor)            { fAlgor    = algor;  fConfigDirty = kTRUE; }
+  void SetRecombScheme(const fastjet::RecombinationScheme &scheme) { fScheme   = scheme; fConfigDirty = kTRUE; }
+  void SetAreaType(const fastjet::AreaType &atype)                 { fAreaType = atype;  fConfigDirty = kTRUE; }
+  void SetNRepeats(Int_t nrepeat)       { fNGhostRepeats  = nrepeat; fConfigDirty = kTRUE; }
+  void SetGhostArea(Double_t gharea)    { fGhostArea      = gharea;  fConfigDirty = kTRUE; }
+  void SetMaxRap(Double_t maxrap)       { fMaxRap         = maxrap;  fConfigDirty = kTRUE; }
+  void SetR(Double_t r)                 { fR              = r;       fConfigDirty = kTRUE; }
+  void SetGridScatter(Double_t gridSc)  { fGridScatter    = gridSc;  fConfigDirty = kTRUE; }
+  void SetKtScatter(Double_t ktSc)      { fKtScatter      = ktSc;    fConfigDirty = kTRUE; }
+  void SetMeanGhostKt(Double_t meankt)  { fMeanGhostKt    = meankt;  fConfigDirty = kTRUE; }
+  void SetPluginAlgor(Int_t plugin)     { fPluginAlgor    = plugin;  fConfigDirty = kTRUE; }
+  // explicit ghosts generated once (fixed seed) and reused by Run() every event instead of the area definition
+  void SetUseFixedGhosts(Bool_t b, UInt_t seed = 12345) { fUseFixedGhosts = b; fFixedGhostSeed = seed; fConfigDirty = kTRUE; }
   void SetUseArea4Vector(Bool_t useA4v) { fUseArea4Vector = useA4v;  }
   void SetupAlgorithmfromOpt(const char *option);
   void SetupAreaTypefromOpt(const char *option);
   void SetupSchemefromOpt(const char *option);
   void SetupStrategyfromOpt(const char *option);
-  void SetLegacyMode (Bool_t mode)      { fLegacyMode ^= mode; }
+  void SetLegacyMode (Bool_t mode)      { fLegacyMode ^= mode; fConfigDirty = kTRUE; }
   void SetLegacyFJ();
   void SetUseExternalBkg(Bool_t b, Double_t rho, Double_t rhom) { fUseExternalBkg = b; fRho = rho; fRhom = rhom;}
   void SetRMaxAndStep(Double_t rmax, Double_t dr) {fRMax = rmax; fDRStep = dr; }
   void SetRhoRhom (Double_t rho, Double_t rhom) { fUseExternalBkg = kTRUE; fRho = rho; fRhom = rhom;} // if using rho,rhom then fUseExternalBkg is true
   void SetMinJetPt(Double_t MinPt) {fMinJetPt=MinPt;}
 
+  // allocation counters - after the first events only the cluster sequences should be allocated per event
+  ULong64_t GetNConfigAllocs() const     { return fNConfigAllocs;     } // jet/area definitions, range, estimator, groomer
+  ULong64_t GetNClusterSeqAllocs() const { return fNClusterSeqAllocs; } // FastJet cluster sequences
+  ULong64_t GetNEventAllocs() const      { return fNEventAllocs;      } // vector growth, per event subtractors
+  void      ResetAllocCounters()         { fNConfigAllocs = 0; fNClusterSeqAllocs = 0; fNEventAllocs = 0; }
+
  protected:
   TString                                fName;               //!
   TString                                fTitle;              //!
@@ -148,6 +168,8 @@ class StFJWrapper
   fastjet::ClusterSequenceArea          *fClustSeq;           //!
   fastjet::ClusterSequence              *fClustSeqSA;                //!
   fastjet::ClusterSequenceActiveAreaExplicitGhosts *fClustSeqActGhosts; //!
+  fastjet::ClusterSequenceActiveAreaExplicitGhosts *fClustSeqFixedGhosts; //! Run() with fixed ghosts
+  fastjet::ClusterSequenceAreaBase      *fClustSeqAreaBase;   //! cluster sequence of Run(), not owned
   fastjet::Strategy                      fStrategy;           //!
   fastjet::JetAlgorithm                  fAlgor;              //!
   fastjet::RecombinationScheme           fScheme;             //!
@@ -201,8 +223,28 @@ class StFJWrapper
   std::vector<double>                      fGRDenominator;    //!
   std::vector<double>                      fGRNumeratorSub;   //!
   std::vector<double>                      fGRDenominatorSub; //!
+  Bool_t                                   fConfigDirty;      //! configuration objects need to be rebuilt
+  Bool_t                                   fUseFixedGhosts;   //! reuse fFixedGhosts every event
+  UInt_t                                   fFixedGhostSeed;   //! seed of the fixed ghost scatter
+  Double_t                                 fFixedGhostArea;   //! area per fixed ghost
+  std::vector<fastjet::PseudoJet>          fFixedGhosts;      //! ghosts over |rap| < fMaxRap, full azimuth
+  ULong64_t                                fNConfigAllocs;    //! configuration objects allocated
+  ULong64_t                                fNClusterSeqAllocs; //! cluster sequences allocated
+  ULong64_t                                fNEventAllocs;     //! other per event allocations (vector growth, subtractors)
+  fastjet::JetDefinition                  *fReclustJetDef;    //! C/A definition of GetReclusteredJet()
+  std::vector<fastjet::ClusterSequence*>   fReclustSeqs;      //! C/A cluster sequence per inclusive jet, 0x0 if not reclustered yet
+  std::vector<fastjet::PseudoJet>          fReclustJets;      //! C/A reclustered jet per inclusive jet
+  std::vector<fastjet::PseudoJet>          fReclustInput;     //! constituents (no ghosts) of the jet to recluster
 
   virtual void   SubtractBackground(const Double_t median_pt = -1);
+  virtual Int_t  BuildConfig();
+  virtual void   BuildFixedGhosts();
+
+  // clear vector keeping its capacity, count growth beyond it
+  template <class T> void ResetVector(std::vector<T> &v, size_t n) {
+    v.clear();
+    if (v.capacity() < n) { v.reserve(n); fNEventAllocs++; }
+  }
 
  private:
   StFJWrapper();
@@ -242,6 +284,8 @@ StFJWrapper::StFJWrapper(const char *name, const char *title)
   , fClustSeq          (0)
   , fClustSeqSA        (0)
   , fClustSeqActGhosts (0)
+  , fClustSeqFixedGhosts (0)
+  , fClustSeqAreaBase  (0)
   , fStrategy          (fj::Best)
   , fAlgor             (fj::kt_algorithm)
   , fScheme            (fj::BIpt_scheme)
@@ -289,6 +333,18 @@ StFJWrapper::StFJWrapper(const char *name, const char *title)
   , fGRDenominator()
   , fGRNumeratorSub()
   , fGRDenominatorSub()
+  , fConfigDirty(kTRUE)
+  , fUseFixedGhosts(kFALSE)
+  , fFixedGhostSeed(12345)
+  , fFixedGhostArea(0)
+  , fFixedGhosts()
+  , fNConfigAllocs(0)
+  , fNClusterSeqAllocs(0)
+  , fNEventAllocs(0)
+  , fReclustJetDef(0)
+  , fReclustSeqs()
+  , fReclustJets()
+  , fReclustInput()
 {
   // Constructor.
 }
@@ -303,22 +359,44 @@ StFJWrapper::~StFJWrapper()
 //_________________________________________________________________________________________________
 void StFJWrapper::ClearMemory()
 {
-  // Destructor.
+  // Delete everything, the configuration is rebuilt on the next Run().
+  ClearClusterSequences();
+  ClearConfig();
+}
+
+//_________________________________________________________________________________________________
+void StFJWrapper::ClearClusterSequences()
+{
+  // Delete the cluster sequences of the last event.
+  if (fClustSeq)          { delete fClustSeq;          fClustSeq        = NULL; }
+  if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
+  if (fClustSeqActGhosts) { delete fClustSeqActGhosts; fClustSeqActGhosts = NULL; }
+  if (fClustSeqFixedGhosts) { delete fClustSeqFixedGhosts; fClustSeqFixedGhosts = NULL; }
+  fClustSeqAreaBase = NULL;
+  for (UInt_t i = 0; i < fReclustSeqs.size(); i++) { if (fReclustSeqs[i]) delete fReclustSeqs[i]; }
+  fReclustSeqs.clear();
+  fReclustJets.clear();
+}
+
+//_________________________________________________________________________________________________
+void StFJWrapper::ClearConfig()
+{
+  // Delete the configuration objects (definitions, range, estimator, groomer).
+  // Cluster sequences referring to them have to be deleted first.
   if (fAreaDef)           { delete fAreaDef;           fAreaDef         = NULL; }
   if (fVorAreaSpec)       { delete fVorAreaSpec;       fVorAreaSpec     = NULL; }
   if (fGhostedAreaSpec)   { delete fGhostedAreaSpec;   fGhostedAreaSpec = NULL; }
   if (fJetDef)            { delete fJetDef;            fJetDef          = NULL; }
   if (fPlugin)            { delete fPlugin;            fPlugin          = NULL; }
   if (fRange)             { delete fRange;             fRange           = NULL; }
-  if (fClustSeq)          { delete fClustSeq;          fClustSeq        = NULL; }
-  if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
-  if (fClustSeqActGhosts) { delete fClustSeqActGhosts; fClustSeqActGhosts = NULL; }
+  if (fReclustJetDef)     { delete fReclustJetDef;     fReclustJetDef   = NULL; }
   #ifdef FASTJET_VERSION
   if (fBkrdEstimator)          { delete fBkrdEstimator; fBkrdEstimator = NULL; }
 ////  if (fGenSubtractor)          { delete fGenSubtractor; fGenSubtractor = NULL; }
   if (fConstituentSubtractor)  { delete fConstituentSubtractor; fConstituentSubtractor = NULL; }
   if (fSoftDrop)          { delete fSoftDrop; fSoftDrop = NULL;}
   #endif
+  fConfigDirty = kTRUE;
 }
 
 //_________________________________________________________________________________________________
@@ -347,6 +425,7 @@ void StFJWrapper::CopySettingsFrom(const StFJWrapper& wrapper)
   fUseExternalBkg   = wrapper.fUseExternalBkg;
   fRho              = wrapper.fRho;
   fRhom             = wrapper.fRhom;
+  fConfigDirty      = kTRUE;
 }
 
 //_________________________________________________________________________________________________
@@ -355,13 +434,16 @@ void StFJWrapper::Clear(const Option_t */*opt*/)
   // Simply clear the input vectors.
   // Make sure done on every event if the instance is reused
   // Reset the median to zero.
+  // Vectors keep their capacity and the configuration objects are kept,
+  // only the cluster sequences of the last event are deleted.
 
   fInputVectors.clear();
   fInputGhosts.clear();
+  fInclusiveJets.clear();
+  fFilteredJets.clear();
   fMedUsedForBgSub = 0;
 
-  // for the moment brute force delete everything
-  ClearMemory();
+  ClearClusterSequences();
 }
 
 //_________________________________________________________________________________________________
@@ -385,6 +467,7 @@ void StFJWrapper::AddInputVector(Double_t px, Double_t py, Double_t pz, Double_t
   //}
 
   // add to the fj container of input vectors
+  if (fInputVectors.size() == fInputVectors.capacity()) fNEventAllocs++;
   fInputVectors.push_back(inVec);
 }
 
@@ -402,6 +485,7 @@ void StFJWrapper::AddInputVector(const fj::PseudoJet& vec, Int_t index)
   //}
 
   // add to the fj container of input vectors
+  if (fInputVectors.size() == fInputVectors.capacity()) fNEventAllocs++;
   fInputVectors.push_back(inVec);
 }
 
@@ -409,6 +493,10 @@ void StFJWrapper::AddInputVector(const fj::PseudoJet& vec, Int_t index)
 void StFJWrapper::AddInputVectors(const std::vector<fj::PseudoJet>& vecs, Int_t offsetIndex)
 {
   // Add the input from vector of pseudojets.
+  if (fInputVectors.size() + vecs.size() > fInputVectors.capacity()) {
+    fInputVectors.reserve(fInputVectors.size() + vecs.size());
+    fNEventAllocs++;
+  }
   for (UInt_t i = 0; i < vecs.size(); ++i) {
     fj::PseudoJet inVec = vecs[i];
     if (offsetIndex > -99999)
@@ -431,6 +519,7 @@ void StFJWrapper::AddInputGhost(Double_t px, Double_t py, Double_t pz, Double_t
   }
 
   // add to the fj container of input vectors
+  if (fInputGhosts.size() == fInputGhosts.capacity()) fNEventAllocs++;
   fInputGhosts.push_back(inVec);
   if (!fDoFilterArea) fDoFilterArea = kTRUE;
 }
@@ -441,7 +530,7 @@ Double_t StFJWrapper::GetJetArea(UInt_t idx) const
   // Get the jet area.
   Double_t retval = -1; // really wrong area..
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area(fInclusiveJets[idx]);
+    retval = fClustSeqAreaBase->area(fInclusiveJets[idx]);
   } else {
     __ERROR(Form("Wrong index: %d",idx));
   }
@@ -467,7 +556,7 @@ fastjet::PseudoJet StFJWrapper::GetJetAreaVector(UInt_t idx) const
   // Get the jet area as vector.
   fastjet::PseudoJet retval;
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area_4vector(fInclusiveJets[idx]);
+    retval = fClustSeqAreaBase->area_4vector(fInclusiveJets[idx]);
   } else {
     __ERROR(Form("Wrong index: %d",idx));
   }
@@ -518,7 +607,7 @@ StFJWrapper::GetJetConstituents(UInt_t idx) const
   std::vector<fastjet::PseudoJet> retval;
 
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->constituents(fInclusiveJets[idx]);
+    retval = fClustSeqAreaBase->constituents(fInclusiveJets[idx]);
   } else {
     __ERROR(Form("Wrong index: %d",idx));
   }
@@ -526,6 +615,48 @@ StFJWrapper::GetJetConstituents(UInt_t idx) const
   return retval;
 }
 
+//_________________________________________________________________________________________________
+const fj::PseudoJet& StFJWrapper::GetReclusteredJet(UInt_t idx)
+{
+  // C/A reclustering of the constituents of inclusive jet idx (ghosts, user index -1, removed).
+  // Made on the first call in the event and kept with its cluster sequence until the next Run() or Clear(),
+  // so SoftDrop, declustering and exclusive subjets of the jet share one reclustering.
+  // Returns an empty PseudoJet (no associated cluster sequence) for a wrong index or a jet of only ghosts.
+  static const fj::PseudoJet emptyJet;
+
+  if (!fClustSeqAreaBase || idx >= fInclusiveJets.size()) {
+    __ERROR(Form("Wrong index: %d",idx));
+    return emptyJet;
+  }
+
+  if (fReclustSeqs.size() < fInclusiveJets.size()) {
+    fReclustSeqs.resize(fInclusiveJets.size(), 0);
+    fReclustJets.resize(fInclusiveJets.size());
+  }
+  if (fReclustSeqs[idx]) return fReclustJets[idx];
+
+  // all constituents end up in one jet
+  if (!fReclustJetDef) {
+    fReclustJetDef = new fj::JetDefinition(fj::cambridge_algorithm, fj::JetDefinition::max_allowable_R);
+    fNConfigAllocs++;
+  }
+
+  std::vector<fj::PseudoJet> constituents = fClustSeqAreaBase->constituents(fInclusiveJets[idx]);
+  ResetVector(fReclustInput, constituents.size());
+  for (UInt_t ic = 0; ic < constituents.size(); ic++) {
+    if (constituents[ic].user_index() == -1) continue;
+    fReclustInput.push_back(constituents[ic]);
+  }
+
+  fReclustSeqs[idx] = new fj::ClusterSequence(fReclustInput, *fReclustJetDef);
+  fNClusterSeqAllocs++;
+
+  std::vector<fj::PseudoJet> jets = fReclustSeqs[idx]->inclusive_jets();
+  fReclustJets[idx] = jets.empty() ? fj::PseudoJet() : jets[0];
+
+  return fReclustJets[idx];
+}
+
 //_________________________________________________________________________________________________
 std::vector<fastjet::PseudoJet>
 StFJWrapper::GetFilteredJetConstituents(UInt_t idx) const
@@ -548,7 +679,7 @@ void StFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t rem
 {
   // Get the median and sigma from fastjet.
   // User can also do it on his own because the cluster sequence is exposed (via a getter)
-  if (!fClustSeq) {
+  if (!fClustSeqAreaBase) {
     __ERROR(Form("Run the jfinder first."));
     return;
   }
@@ -556,11 +687,11 @@ void StFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t rem
   Double_t mean_area = 0;
   try {
     if(0 == remove) {
-      fClustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
+      fClustSeqAreaBase->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
     }  else {
-      std::vector<fastjet::PseudoJet> input_jets = sorted_by_pt(fClustSeq->inclusive_jets());
+      std::vector<fastjet::PseudoJet> input_jets = sorted_by_pt(fClustSeqAreaBase->inclusive_jets());
       input_jets.erase(input_jets.begin(), input_jets.begin() + remove);
-      fClustSeq->get_median_rho_and_sigma(input_jets, *fRange, fUseArea4Vector, median, sigma, mean_area);
+      fClustSeqAreaBase->get_median_rho_and_sigma(input_jets, *fRange, fUseArea4Vector, median, sigma, mean_area);
       input_jets.clear();
     }
   } catch (fj::Error) {
@@ -571,9 +702,13 @@ void StFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t rem
 }
 
 //_________________________________________________________________________________________________
-Int_t StFJWrapper::Run()
+Int_t StFJWrapper::BuildConfig()
 {
-  // Run the actual jet finder.
+  // Build the jet definition, area definition, range and background estimator.
+  // Only done when a setter changed the configuration, they are reused for every event.
+  ClearClusterSequences();
+  ClearConfig();
+
   if (fAreaType == fj::voronoi_area) {
     // Rfact - check dependence - default is 1.
     // NOTE: hardcoded variable!
@@ -589,6 +724,11 @@ Int_t StFJWrapper::Run()
 
     fAreaDef = new fj::AreaDefinition(*fGhostedAreaSpec, fAreaType);
   }
+  fNConfigAllocs += 2;
+
+  // explicit ghosts of Run(), built once for this configuration
+  fFixedGhosts.clear();
+  if (fUseFixedGhosts && fAreaType != fj::voronoi_area) BuildFixedGhosts();
 
   // this is acceptable by fastjet:
 #ifndef FASTJET_VERSION
@@ -596,6 +736,7 @@ Int_t StFJWrapper::Run()
 #else
   fRange = new fj::Selector(fj::SelectorAbsRapMax(fMaxRap - 0.95 * fR));
 #endif
+  fNConfigAllocs++;
 
   if (fAlgor == fj::plugin_algorithm) {
     if (fPluginAlgor == 0) {
@@ -618,28 +759,78 @@ Int_t StFJWrapper::Run()
       fJetDef = new fastjet::JetDefinition(fPlugin);
     } else {
      __ERROR(Form("Unrecognized plugin number!"));
+     return -1;
     }
+    fNConfigAllocs += 2;
   } else {
     fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
-  }
-
-  try {
-    fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
-  } catch (fj::Error) {
-    __ERROR(Form("FJ Exception caught."));
-    return -1;
+    fNConfigAllocs++;
   }
 
   // FJ3 :: Define an JetMedianBackgroundEstimator just in case it will be used
 #ifdef FASTJET_VERSION
   fBkrdEstimator     = new fj::JetMedianBackgroundEstimator(fj::SelectorAbsRapMax(fMaxRap));
+  fNConfigAllocs++;
 #endif
 
   if (fLegacyMode) { SetLegacyFJ(); } // for FJ 2.x even if fLegacyMode is set, SetLegacyFJ is dummy
 
-  // inclusive jets:
-  fInclusiveJets.clear();
-  fInclusiveJets = fClustSeq->inclusive_jets(0.0);
+  fConfigDirty = kFALSE;
+  return 0;
+}
+
+//_________________________________________________________________________________________________
+void StFJWrapper::BuildFixedGhosts()
+{
+  // Ghost lattice over |rap| < fMaxRap and full azimuth with cells of the ghost area,
+  // scattered around the cell centres as by fastjet::GhostedAreaSpec, but with a fixed seed
+  // so the same ghosts are clustered every event. One repeat only, as for explicit ghosts.
+  Int_t nrap = TMath::Max(1, TMath::Nint(2. * fMaxRap / TMath::Sqrt(fGhostArea)));
+  Int_t nphi = TMath::Max(1, TMath::Nint(TMath::TwoPi() / TMath::Sqrt(fGhostArea)));
+  Double_t drap = 2. * fMaxRap / nrap;
+  Double_t dphi = TMath::TwoPi() / nphi;
+  fFixedGhostArea = drap * dphi;
+
+  TRandom3 rand(fFixedGhostSeed);
+  fFixedGhosts.reserve(nrap * nphi);
+  for (Int_t irap = 0; irap < nrap; irap++) {
+    for (Int_t iphi = 0; iphi < nphi; iphi++) {
+      Double_t rap = -fMaxRap + (irap + 0.5 + fGridScatter * (rand.Uniform() - 0.5)) * drap;
+      Double_t phi = (iphi + 0.5 + fGridScatter * (rand.Uniform() - 0.5)) * dphi;
+      Double_t pt  = fMeanGhostKt * (1. + fKtScatter * (rand.Uniform() - 0.5));
+      fFixedGhosts.push_back(fj::PtYPhiM(pt, rap, phi, 0.));
+      fFixedGhosts.back().set_user_index(-1);
+    }
+  }
+  fNConfigAllocs++;
+}
+
+//_________________________________________________________________________________________________
+Int_t StFJWrapper::Run()
+{
+  // Run the actual jet finder.
+  // Cluster sequence of the last event is deleted, configuration is rebuilt only if changed
+  ClearClusterSequences();
+  if (fConfigDirty && BuildConfig() != 0) return -1;
+
+  try {
+    if (!fFixedGhosts.empty()) {
+      fClustSeqFixedGhosts = new fj::ClusterSequenceActiveAreaExplicitGhosts(fInputVectors, *fJetDef, fFixedGhosts, fFixedGhostArea);
+      fClustSeqAreaBase = fClustSeqFixedGhosts;
+    } else {
+      fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
+      fClustSeqAreaBase = fClustSeq;
+    }
+    fNClusterSeqAllocs++;
+  } catch (fj::Error) {
+    __ERROR(Form("FJ Exception caught."));
+    return -1;
+  }
+
+  // inclusive jets: copied into the kept vector
+  const std::vector<fj::PseudoJet> &jets = fClustSeqAreaBase->inclusive_jets(0.0);
+  ResetVector(fInclusiveJets, jets.size());
+  fInclusiveJets.insert(fInclusiveJets.end(), jets.begin(), jets.end());
 
   return 0;
 }
@@ -650,7 +841,10 @@ Int_t StFJWrapper::Filter()
 //
 //  StFJWrapper::Filter
 //
-  fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
+  // jet definition is shared with Run()
+  if (fConfigDirty && BuildConfig() != 0) return -1;
+  if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
+  if (fClustSeqActGhosts) { delete fClustSeqActGhosts; fClustSeqActGhosts = NULL; }
 
   if (fDoFilterArea) {
     if (fInputGhosts.size()>0) {
@@ -659,26 +853,30 @@ Int_t StFJWrapper::Filter()
                                                                            *fJetDef,
                                                                             fInputGhosts,
                                                                             fGhostArea);
+        fNClusterSeqAllocs++;
       } catch (fj::Error) {
         __WARNING(Form("FJ Exception caught."));
         return -1;
       }
 
-      fFilteredJets.clear();
-      fFilteredJets =  fClustSeqActGhosts->inclusive_jets(0.0);
+      const std::vector<fj::PseudoJet> &jets = fClustSeqActGhosts->inclusive_jets(0.0);
+      ResetVector(fFilteredJets, jets.size());
+      fFilteredJets.insert(fFilteredJets.end(), jets.begin(), jets.end());
     } else {
       return -1;
     }
   } else {
     try {
       fClustSeqSA = new fastjet::ClusterSequence(fInputVectors, *fJetDef);
+      fNClusterSeqAllocs++;
     } catch (fj::Error) {
       __WARNING(Form("FJ Exception caught."));
       return -1;
     }
 
-    fFilteredJets.clear();
-    fFilteredJets = fClustSeqSA->inclusive_jets(0.0);
+    const std::vector<fj::PseudoJet> &jets = fClustSeqSA->inclusive_jets(0.0);
+    ResetVector(fFilteredJets, jets.size());
+    fFilteredJets.insert(fFilteredJets.end(), jets.begin(), jets.end());
   }
 
   return 0;
@@ -711,12 +909,12 @@ void StFJWrapper::SubtractBackground(Double_t median_pt)
   Double_t mean_area = 0;
 
   // clear the subtracted jet pt's vector<double>
-  fSubtractedJetsPt.clear();
+  ResetVector(fSubtractedJetsPt, fInclusiveJets.size());
 
   // check what was specified (default is -1)
   if (median_pt < 0) {
     try {
-      fClustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
+      fClustSeqAreaBase->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
     }
 
     catch (fj::Error) {
@@ -742,13 +940,13 @@ void StFJWrapper::SubtractBackground(Double_t median_pt)
   for (unsigned i = 0; i < fInclusiveJets.size(); i++) {
     if ( fUseArea4Vector ) {
       // subtract the background using the area4vector
-      fj::PseudoJet area4v = fClustSeq->area_4vector(fInclusiveJets[i]);
+      fj::PseudoJet area4v = fClustSeqAreaBase->area_4vector(fInclusiveJets[i]);
       fj::PseudoJet jet_sub = fInclusiveJets[i] - area4v * fMedUsedForBgSub;
       fSubtractedJetsPt.push_back(jet_sub.perp()); // here we put only the pt of the jet - note: this can be negative
     } else {
       // subtract the background using scalars
       // fj::PseudoJet jet_sub = fInclusiveJets[i] - area * fMedUsedForBgSub_;
-      Double_t area = fClustSeq->area(fInclusiveJets[i]);
+      Double_t area = fClustSeqAreaBase->area(fInclusiveJets[i]);
       // standard subtraction
       Double_t pt_sub = fInclusiveJets[i].perp() - fMedUsedForBgSub * area;
       fSubtractedJetsPt.push_back(pt_sub); // here we put only the pt of the jet - note: this can be negative
@@ -765,14 +963,15 @@ Int_t StFJWrapper::DoConstituentSubtraction() {
   // fConstituentSubtractor->set_max_deltaR(/* double max_deltaR */);
 
   // clear constituent subtracted jets
-  fConstituentSubtrJets.clear();
+  ResetVector(fConstituentSubtrJets, fInclusiveJets.size());
   for (unsigned i = 0; i < fInclusiveJets.size(); i++) {
     fj::PseudoJet subtracted_jet(0.,0.,0.,0.);
     if(fInclusiveJets[i].perp()>0.)
       subtracted_jet = (*fConstituentSubtractor)(fInclusiveJets[i]);
     fConstituentSubtrJets.push_back(subtracted_jet);
   }
-  if(fConstituentSubtractor) { delete fConstituentSubtractor; fConstituentSubtractor = NULL; }
+  // subtractor with external rho/rhom is made per event, with the background estimator it is kept
+  if(fConstituentSubtractor && fUseExternalBkg) { delete fConstituentSubtractor; fConstituentSubtractor = NULL; }
 
 #endif
   return 0;
@@ -785,7 +984,7 @@ Int_t StFJWrapper::DoSoftDrop() {
   CreateSoftDrop();
 
   // clear groomed jets
-  fGroomedJets.clear();
+  ResetVector(fGroomedJets, fInclusiveJets.size());
   //fastjet::Subtractor fjsub (fBkrdEstimator);
   //fSoftDrop->set_subtractor(&fjsub);
   //fSoftDrop->set_input_jet_is_subtracted(false); //??
@@ -798,7 +997,6 @@ Int_t StFJWrapper::DoSoftDrop() {
     }
     
   }
-  if(fSoftDrop) { delete fSoftDrop; fSoftDrop = NULL; }
 
 #endif
   return 0;
@@ -808,10 +1006,11 @@ Int_t StFJWrapper::DoSoftDrop() {
 Int_t StFJWrapper::CreateSoftDrop() {
   // Do grooming
   #ifdef FASTJET_VERSION
-  if (fSoftDrop) { delete fSoftDrop; } // protect against memory leaks
-  
+  if (fSoftDrop) return 0; // groomer is kept, fBeta and fZcut are fixed
+
   fSoftDrop   = new fj::contrib::SoftDrop(fBeta,fZcut);
-  
+  fNConfigAllocs++;
+
   #endif
   return 0;
 }
@@ -842,12 +1041,14 @@ Int_t StFJWrapper::CreateGenSub() {
 Int_t StFJWrapper::CreateConstituentSub() {
   // Do generic subtraction for jet mass
   #ifdef FASTJET_VERSION
-  if (fConstituentSubtractor) { delete fConstituentSubtractor; } // protect against memory leaks
+  // subtractor with the background estimator is kept until the configuration changes
+  if (fConstituentSubtractor && !fUseExternalBkg) return 0;
+  if (fConstituentSubtractor) { delete fConstituentSubtractor; fConstituentSubtractor = NULL; } // protect against memory leaks
 
   // see ConstituentSubtractor.hh signatures
   // ConstituentSubtractor(double rho, double rhom=0, double alpha=0, double maxDeltaR=-1)
-  if (fUseExternalBkg) { fConstituentSubtractor = new fj::contrib::ConstituentSubtractor(fRho,fRhom); }
-  else                 { fConstituentSubtractor = new fj::contrib::ConstituentSubtractor(fBkrdEstimator); }  // FIXME Nov15, 2018 commented back in
+  if (fUseExternalBkg) { fConstituentSubtractor = new fj::contrib::ConstituentSubtractor(fRho,fRhom); fNEventAllocs++; }
+  else                 { fConstituentSubtractor = new fj::contrib::ConstituentSubtractor(fBkrdEstimator); fNConfigAllocs++; }  // FIXME Nov15, 2018 commented back in
 
   #endif
   return 0;
@@ -868,6 +1069,8 @@ void StFJWrapper::SetupAlgorithmfromOpt(const char *option)
   if (!opt.compare("ee_kt"))             fAlgor    = fj::ee_kt_algorithm;
   if (!opt.compare("ee_genkt"))          fAlgor    = fj::ee_genkt_algorithm;
   if (!opt.compare("plugin"))            fAlgor    = fj::plugin_algorithm;
+
+  fConfigDirty = kTRUE;
 }
 
 //_________________________________________________________________________________________________
@@ -882,6 +1085,8 @@ void StFJWrapper::SetupAreaTypefromOpt(const char *option)
   if (!opt.compare("one_ghost_passive"))           fAreaType = fj::one_ghost_passive_area;
   if (!opt.compare("passive"))                     fAreaType = fj::passive_area;
   if (!opt.compare("voronoi"))                     fAreaType = fj::voronoi_area;
+
+  fConfigDirty = kTRUE;
 }
 
 //_________________________________________________________________________________________________
@@ -899,6 +1104,8 @@ void StFJWrapper::SetupSchemefromOpt(const char *option)
   if (!opt.compare("pt2"))    fScheme   = fj::pt2_scheme;
   if (!opt.compare("Et"))     fScheme   = fj::Et_scheme;
   if (!opt.compare("Et2"))    fScheme   = fj::Et2_scheme;
+
+  fConfigDirty = kTRUE;
 }
 
 //_________________________________________________________________________________________________
@@ -920,23 +1127,29 @@ void StFJWrapper::SetupStrategyfromOpt(const char *option)
   if (!opt.compare("NlnNCam2pi2R"))    fStrategy = fj::NlnNCam2pi2R;
   if (!opt.compare("NlnNCam"))         fStrategy = fj::NlnNCam;
   if (!opt.compare("plugin"))          fStrategy = fj::plugin_strategy;
+
+  fConfigDirty = kTRUE;
 }
 
 //_______________________________________________________________________________________________ 
 Double_t StFJWrapper::NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Int_t Option){
   //Option 0=Nsubjettiness result, 1=opening angle between axes in Eta-Phi plane, 2=Distance between axes in Eta-Phi plane
   
-  fJetDef = new fj::JetDefinition(fAlgor, fR*100, fScheme, fStrategy ); //the *2 is becasue of a handful of jets that end up missing a track for some reason.
+  // local jet definition - the cached fJetDef of Run() is kept
+  fj::JetDefinition jetDefNSub(fAlgor, fR*100, fScheme, fStrategy ); //the *2 is becasue of a handful of jets that end up missing a track for some reason.
 
+  if (fClustSeqSA) { delete fClustSeqSA; fClustSeqSA = NULL; }
   try {
-    fClustSeqSA = new fastjet::ClusterSequence(fInputVectors, *fJetDef);
+    fClustSeqSA = new fastjet::ClusterSequence(fInputVectors, jetDefNSub);
+    fNClusterSeqAllocs++;
     // ClustSeqSA = new fastjet::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
   } catch (fj::Error) {
     __WARNING(Form("FJ Exception caught."));
     return -1;
   }
-  fFilteredJets.clear();
-  fFilteredJets = fClustSeqSA->inclusive_jets(fMinJetPt-0.1); //becasue this is < not <=
+  const std::vector<fj::PseudoJet> &jets = fClustSeqSA->inclusive_jets(fMinJetPt-0.1); //becasue this is < not <=
+  ResetVector(fFilteredJets, jets.size());
+  fFilteredJets.insert(fFilteredJets.end(), jets.begin(), jets.end());
   Double_t Result=-1;
   std::vector<fastjet::PseudoJet> SubJet_Axes;
   fj::PseudoJet SubJet1_Axis;
@@ -1022,6 +1235,55 @@ Double_t StFJWrapper::NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius, D
   else return -2;
 }
 
+//_______________________________________________________________________________________________
+Int_t StFJWrapper::JetNSubjettiness(UInt_t idx, Int_t Algorithm, Double_t tau[], Int_t nmax, Double_t Beta, Double_t Radius, Double_t *openingAngle) const
+{
+  // N-subjettiness of one jet (StJetNsubjettiness): unlike NSubjettiness() the event is not reclustered and
+  // no cluster sequence of the wrapper is changed, so this can run for several jets in parallel.
+  // Ghosts are removed, normalization radius is the jet radius. Returns -1 for a wrong index.
+  if (!fClustSeqAreaBase || idx >= fInclusiveJets.size()) {
+    __ERROR(Form("Wrong index: %d",idx));
+    return -1;
+  }
+
+  std::vector<fj::PseudoJet> constituents = fClustSeqAreaBase->constituents(fInclusiveJets[idx]);
+  std::vector<fj::PseudoJet> particles;
+  particles.reserve(constituents.size());
+  for (UInt_t ic = 0; ic < constituents.size(); ic++) {
+    if (constituents[ic].user_index() == -1) continue;
+    particles.push_back(constituents[ic]);
+  }
+
+  StJetNsubjettiness nSub(Algorithm, Beta, fR, Radius);
+  nSub.Compute(fj::join(particles), tau, nmax, openingAngle);
+
+  return 0;
+}
+
+//_______________________________________________________________________________________________
+Int_t StFJWrapper::JetShapes(UInt_t idx, StJetShapeKernel &kernel) const
+{
+  // Jet shapes of one jet (StJetShapeKernel): angularity, pTD, circularity, sigma2, LeSub and the
+  // GR numerator/denominator for all radii from one pass. Ghosts are removed, so shapes of jets with
+  // area are the same as without. Returns -1 for a wrong index.
+  if (!fClustSeqAreaBase || idx >= fInclusiveJets.size()) {
+    __ERROR(Form("Wrong index: %d",idx));
+    return -1;
+  }
+
+  std::vector<fj::PseudoJet> constituents = fClustSeqAreaBase->constituents(fInclusiveJets[idx]);
+  std::vector<fj::PseudoJet> particles;
+  particles.reserve(constituents.size());
+  for (UInt_t ic = 0; ic < constituents.size(); ic++) {
+    if (constituents[ic].user_index() == -1) continue;
+    particles.push_back(constituents[ic]);
+  }
+
+  kernel.Process(fj::join(particles));
+
+  return 0;
+}
+
 //_______________________________________________________________________________________________
 Double32_t StFJWrapper::NSubjettinessDerivativeSub(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Double_t JetR, fastjet::PseudoJet jet, Int_t Option){ //For derivative subtraction
 
@@ -21,6 +21,7 @@
 
 // jet-framework includes
 #include "StJet.h"
+#include "StJetConstituentTable.h"
 #include "StVParticle.h"
 
 /// \cond CLASSIMP
@@ -59,6 +60,10 @@ StJet::StJet() :
   fHasGhost(kFALSE),
   fGhosts(),
   fJetConstit(),
+  fConstitTable(0),
+  fConstitBegin(0),
+  fConstitN(0),
+  fConstitNTracks(0),
   fJetShapeProperties(0)
 {
   fClosestJets[0] = 0;
@@ -104,6 +109,10 @@ StJet::StJet(Double_t px, Double_t py, Double_t pz) :
   fHasGhost(kFALSE),
   fGhosts(),
   fJetConstit(),
+  fConstitTable(0),
+  fConstitBegin(0),
+  fConstitN(0),
+  fConstitNTracks(0),
   fJetShapeProperties(0)
 {
   if (fPt != 0) {
@@ -154,6 +163,10 @@ StJet::StJet(Double_t pt, Double_t eta, Double_t phi, Double_t m) :
   fHasGhost(kFALSE),
   fGhosts(),
   fJetConstit(),
+  fConstitTable(0),
+  fConstitBegin(0),
+  fConstitN(0),
+  fConstitNTracks(0),
   fJetShapeProperties(0)
 {
   fPhi = TVector2::Phi_0_2pi(fPhi);
@@ -198,6 +211,10 @@ StJet::StJet(const StJet& jet) :
   fHasGhost(jet.fHasGhost),
   fGhosts(jet.fGhosts),
   fJetConstit(jet.fJetConstit),
+  fConstitTable(jet.fConstitTable),
+  fConstitBegin(jet.fConstitBegin),
+  fConstitN(jet.fConstitN),
+  fConstitNTracks(jet.fConstitNTracks),
   fJetShapeProperties(0)
 {
   // Copy constructor.
@@ -259,6 +276,10 @@ StJet& StJet::operator=(const StJet& jet)
     fHasGhost           = jet.fHasGhost;
     fGhosts             = jet.fGhosts;
     fJetConstit         = jet.fJetConstit;
+    fConstitTable       = jet.fConstitTable;
+    fConstitBegin       = jet.fConstitBegin;
+    fConstitN           = jet.fConstitN;
+    fConstitNTracks     = jet.fConstitNTracks;
     if (jet.fJetShapeProperties) {
       fJetShapeProperties = new StJetShapeProperties(*(jet.fJetShapeProperties));
     }
@@ -351,7 +372,7 @@ TLorentzVector StJet::SubtractRhoVect(Double_t rho, Bool_t save)
 
 /**
  *  Sort constituent by index (increasing).
- *
+ *  Only for jets without a constituent table span.
  */
 void StJet::SortConstituents()
 {
@@ -515,8 +536,8 @@ void StJet::ResetMatching()
 // this returns 1 less than the track ID since it returns the place in the Array
 Int_t StJet::ContainsTrack(Int_t it) const
 {
-  for (Int_t i = 0; i < fTrackIDs.GetSize(); i++) {
-    if (it == fTrackIDs[i]) return i;
+  for (Int_t i = 0; i < GetNumberOfTracks(); i++) {
+    if (it == TrackAt(i)) return i;
   }
   return -1;
 }
@@ -605,6 +626,77 @@ void StJet::Clear(Option_t */*option*/)
   fGhosts.clear();
   fHasGhost = kFALSE;
   fJetConstit.clear();
+  fConstitTable = 0;
+  fConstitBegin = 0;
+  fConstitN = 0;
+  fConstitNTracks = 0;
+}
+
+/**
+ * Jet constituents: set with SetJetConstituents, or made from the constituent table span
+ * on the first request and kept afterwards
+ * @return Vector of the jet constituents
+ */
+const std::vector<fastjet::PseudoJet>& StJet::GetJetConstituents() const
+{
+  if (fJetConstit.empty() && fConstitTable && fConstitN > 0) {
+    fJetConstit.reserve(fConstitN);
+    for (Int_t i = 0; i < fConstitN; i++) {
+      fJetConstit.push_back(fConstitTable->GetPseudoJet(fConstitTable->GetJetEntry(fConstitBegin + i)));
+    }
+  }
+
+  return fJetConstit;
+}
+
+/**
+ * Set the span of the jet constituents in the event constituent table
+ * @param t Event constituent table (not owned)
+ * @param begin First entry of the jet (StJetConstituentTable::GetJetEntry)
+ * @param n Number of jet constituents, tracks first
+ */
+void StJet::SetConstituentSpan(const StJetConstituentTable *t, Int_t begin, Int_t n)
+{
+  fConstitTable = t;
+  fConstitBegin = begin;
+  fConstitN = n;
+  fConstitNTracks = 0;
+  if (!t) return;
+
+  while (fConstitNTracks < n && t->IsTrack(t->GetJetEntry(begin + fConstitNTracks))) fConstitNTracks++;
+}
+
+/**
+ * Index of a track constituent
+ * @param idx Position of the track among the jet track constituents
+ * @return Index of the track in the PicoDst track array
+ */
+Int_t StJet::TrackAt(Int_t idx) const
+{
+  if (fConstitTable) return fConstitTable->GetIndex(fConstitTable->GetJetEntry(fConstitBegin + idx));
+  return fTrackIDs.At(idx);
+}
+
+/**
+ * Index of a tower constituent
+ * @param idx Position of the tower among the jet tower constituents
+ * @return Index of the tower in the PicoDst BTowHit array (tower ID - 1)
+ */
+Int_t StJet::TowerAt(Int_t idx) const
+{
+  if (fConstitTable) return fConstitTable->GetIndex(fConstitTable->GetJetEntry(fConstitBegin + fConstitNTracks + idx));
+  return fTowerIDs.At(idx);
+}
+
+/**
+ * Entry of a jet constituent in the constituent table
+ * @param idx Position of the constituent in the jet
+ * @return Entry in the constituent table, -1 if there is no constituent table span
+ */
+Int_t StJet::ConstituentEntryAt(Int_t idx) const
+{
+  if (!fConstitTable || idx < 0 || idx >= fConstitN) return -1;
+  return fConstitTable->GetJetEntry(fConstitBegin + idx);
 }
 
 /**
@@ -627,8 +719,8 @@ Int_t StJet::ContainsTrack(StVParticle *track, TClonesArray *tracks) const // FI
 // this returns 1 less than the cluster/towers ID since it returns the place in the Array
 Int_t StJet::ContainsCluster(Int_t ic) const
 {
-  for (Int_t i = 0; i < fTowerIDs.GetSize(); i++) {
-    if (ic == fTowerIDs[i]) return i;
+  for (Int_t i = 0; i < GetNumberOfTowers(); i++) {
+    if (ic == TowerAt(i)) return i;
   }
   return -1;
 }
@@ -641,8 +733,8 @@ Int_t StJet::ContainsCluster(Int_t ic) const
 // this returns 1 less than the towers ID since it returns the place in the Array
 Int_t StJet::ContainsTower(Int_t ic) const
 {
-  for (Int_t i = 0; i < fTowerIDs.GetSize(); i++) {
-    if (ic == fTowerIDs[i]) return i;
+  for (Int_t i = 0; i < GetNumberOfTowers(); i++) {
+    if (ic == TowerAt(i)) return i;
   }
   return -1;
 }
@@ -24,6 +24,8 @@
 
 #include "StJetShapeProperties.h"
 
+class StJetConstituentTable;
+
 using std::vector;
 namespace fastjet {
   class PseudoJet;
@@ -94,12 +96,12 @@ class StJet : public StVParticle
   Double_t          AreaEta()                    const { return fAreaEta                 ; }
   Double_t          AreaPhi()                    const { return fAreaPhi                 ; }
   Double_t          AreaE()                      const { return fAreaE                   ; }
-  Int_t             ClusterAt(Int_t idx)         const { return fTowerIDs.At(idx)        ; }  // this stores ID of tower constituents - can deprecate
-  Int_t             TowerAt(Int_t idx)           const { return fTowerIDs.At(idx)        ; }  // this stores ID of tower constituents
-  Int_t             TrackAt(Int_t idx)           const { return fTrackIDs.At(idx)        ; }  // this stores ID of track constituents
-  UShort_t          GetNumberOfClusters()        const { return fTowerIDs.GetSize()      ; }  // # of tower constituents - can deprecate
-  UShort_t          GetNumberOfTowers()          const { return fTowerIDs.GetSize()      ; }  // # of tower constituents 
-  UShort_t          GetNumberOfTracks()          const { return fTrackIDs.GetSize()      ; }  // # of track constituents
+  Int_t             ClusterAt(Int_t idx)         const { return TowerAt(idx)             ; }  // this stores ID of tower constituents - can deprecate
+  Int_t             TowerAt(Int_t idx)           const;                                       // index of tower constituent (ID - 1)
+  Int_t             TrackAt(Int_t idx)           const;                                       // index of track constituent
+  UShort_t          GetNumberOfClusters()        const { return GetNumberOfTowers()      ; }  // # of tower constituents - can deprecate
+  UShort_t          GetNumberOfTowers()          const { return (fConstitTable) ? fConstitN - fConstitNTracks : fTowerIDs.GetSize(); }  // # of tower constituents
+  UShort_t          GetNumberOfTracks()          const { return (fConstitTable) ? fConstitNTracks : fTrackIDs.GetSize(); }             // # of track constituents
   UShort_t          GetNumberOfConstituents()    const { return GetNumberOfTowers()+GetNumberOfTracks(); } // towers + tracks
   Bool_t            IsMC()                       const { return (Bool_t)(MCPt() > 0)     ; }
   Bool_t            IsSortable()                 const { return kTRUE                    ; }
@@ -194,7 +196,14 @@ class StJet : public StVParticle
 //TEST =========================
   void SetJetConstituents(std::vector<fastjet::PseudoJet> n)        { fJetConstit = n;                         }
   //const std::vector<fastjet::PseudoJet>&  GetInputVectors()    const { return fInputVectors;               }
-  const std::vector<fastjet::PseudoJet>& GetJetConstituents()  const { return fJetConstit; }
+  const std::vector<fastjet::PseudoJet>& GetJetConstituents()  const; // made from the constituent table on first request
+
+  // Constituent span in the event constituent table (valid for the current event)
+  // jets with a span take their track and tower indices from the table instead of fTrackIDs/fTowerIDs
+  void SetConstituentSpan(const StJetConstituentTable *t, Int_t begin, Int_t n);
+  const StJetConstituentTable *GetConstituentTable()   const { return fConstitTable; }
+  Int_t             GetConstituentSpanSize()           const { return fConstitN;     }
+  Int_t             ConstituentEntryAt(Int_t idx)      const; // entry of the idx-th constituent in the table
 
   // Debug printouts
   void Print(Option_t* /*opt*/ = "") const;
@@ -251,7 +260,11 @@ class StJet : public StVParticle
   Bool_t            fHasGhost;            //!<! Whether ghost particle are included within the constituents
   std::vector<TLorentzVector> fGhosts;    //!<! Vector containing the ghost particles
 
-  std::vector<fastjet::PseudoJet> fJetConstit; //!<! Vector containing the jet constituents
+  mutable std::vector<fastjet::PseudoJet> fJetConstit; //!<! Vector containing the jet constituents (set, or made from the constituent table)
+  const StJetConstituentTable *fConstitTable; //!<! Event constituent table (not owned)
+  Int_t             fConstitBegin;        //!<! First entry of the jet in the constituent table
+  Int_t             fConstitN;            //!<! Number of jet constituents in the constituent table
+  Int_t             fConstitNTracks;      //!<! Number of track constituents (tracks come first in the span)
 
   StJetShapeProperties *fJetShapeProperties; //!<! Pointer to the jet shape properties
 
@@ -266,7 +279,7 @@ class StJet : public StVParticle
   };
 
   /// \cond CLASSIMP
-  ClassDef(StJet,3);
+  ClassDef(StJet,4);
   /// \endcond
 };
 
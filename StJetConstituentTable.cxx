@@ -0,0 +1,134 @@
+//******************************************************************************
+//
+// StJetConstituentTable.cxx
+//
+// Authors: Joel Mazer
+//
+// Event-level table of jet constituents referenced by index spans of the jets
+//
+//******************************************************************************
+
+#include "StJetConstituentTable.h"
+
+// ROOT includes
+#include "TMath.h"
+
+ClassImp(StJetConstituentTable)
+
+//_______________________________________________________________________________________________
+StJetConstituentTable::StJetConstituentTable() : TObject()
+{
+  // entries for a central Au+Au event, tower lookup for all BEMC towers
+  fPt.reserve(2000);
+  fEta.reserve(2000);
+  fPhi.reserve(2000);
+  fE.reserve(2000);
+  fType.reserve(2000);
+  fIndex.reserve(2000);
+  fJetEntries.reserve(4000);
+  fTowerEntry.assign(4800, -1);
+}
+//_______________________________________________________________________________________________
+StJetConstituentTable::~StJetConstituentTable()
+{
+}
+//
+// Function: clear entries of the last event
+//_______________________________________________________________________________________________
+void StJetConstituentTable::Reset()
+{
+  // only reset the lookup of the entries set last event
+  for(UInt_t i = 0; i < fIndex.size(); i++) {
+    if(fType[i] == kTrack) fTrackEntry[fIndex[i]] = -1;
+    else                   fTowerEntry[fIndex[i]] = -1;
+  }
+
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fE.clear();
+  fType.clear();
+  fIndex.clear();
+  fJetEntries.clear();
+}
+//
+// Function: add an entry for each input vector (tracks 0+, towers < -1, ghosts = -1 are skipped)
+//_______________________________________________________________________________________________
+void StJetConstituentTable::Fill(const std::vector<fastjet::PseudoJet> &vectors)
+{
+  for(UInt_t i = 0; i < vectors.size(); i++) {
+    const fastjet::PseudoJet &v = vectors[i];
+    Int_t uid = v.user_index();
+    if(uid == -1) continue;
+
+    Int_t entry = (Int_t)fPt.size();
+    if(uid >= 0) {
+      if(uid >= (Int_t)fTrackEntry.size()) fTrackEntry.resize(uid + 1, -1);
+      fTrackEntry[uid] = entry;
+      fType.push_back(kTrack);
+      fIndex.push_back(uid);
+    } else {
+      Int_t towIndex = -(uid + 2);
+      if(towIndex >= (Int_t)fTowerEntry.size()) fTowerEntry.resize(towIndex + 1, -1);
+      fTowerEntry[towIndex] = entry;
+      fType.push_back(kTower);
+      fIndex.push_back(towIndex);
+    }
+
+    fPt.push_back(v.perp());
+    fEta.push_back(v.eta());
+    fPhi.push_back(v.phi());
+    fE.push_back(v.E());
+  }
+}
+//
+// Function: append the entries of a jet's constituents, returns the begin of its span
+// the span size is GetNJetEntries() - begin, tracks come before towers, ghosts are not stored
+//_______________________________________________________________________________________________
+Int_t StJetConstituentTable::AddJet(const std::vector<fastjet::PseudoJet> &constituents)
+{
+  Int_t begin = (Int_t)fJetEntries.size();
+
+  // tracks
+  for(UInt_t ic = 0; ic < constituents.size(); ++ic) {
+    Int_t uid = constituents[ic].user_index();
+    if(uid < 0) continue;
+    Int_t entry = FindEntry(uid);
+    if(entry < 0) continue;
+    fJetEntries.push_back(entry);
+  }
+
+  // towers
+  for(UInt_t ic = 0; ic < constituents.size(); ++ic) {
+    Int_t uid = constituents[ic].user_index();
+    if(uid > -2) continue;
+    Int_t entry = FindEntry(uid);
+    if(entry < 0) continue;
+    fJetEntries.push_back(entry);
+  }
+
+  return begin;
+}
+//
+// Function: entry of a FastJet user index
+//_______________________________________________________________________________________________
+Int_t StJetConstituentTable::FindEntry(Int_t uid) const
+{
+  if(uid >= 0) return (uid < (Int_t)fTrackEntry.size()) ? fTrackEntry[uid] : -1;
+  if(uid == -1) return -1;
+
+  Int_t towIndex = -(uid + 2);
+  return (towIndex < (Int_t)fTowerEntry.size()) ? fTowerEntry[towIndex] : -1;
+}
+//
+// Function: PseudoJet of an entry, with user index
+//_______________________________________________________________________________________________
+fastjet::PseudoJet StJetConstituentTable::GetPseudoJet(Int_t i) const
+{
+  Double_t pt = fPt[i];
+  Double_t phi = fPhi[i];
+  fastjet::PseudoJet v(pt * TMath::Cos(phi), pt * TMath::Sin(phi), pt * TMath::SinH(fEta[i]), fE[i]);
+  v.set_user_index(GetUserIndex(i));
+
+  return v;
+}
@@ -0,0 +1,76 @@
+//******************************************************************************
+//
+// StJetConstituentTable.h
+//
+// Authors: Joel Mazer
+//
+// Event-level table of jet constituents: one entry per jet input vector with
+// float kinematics (pt, eta, phi, E), type (track, tower) and index in the
+// PicoDst track or BTowHit array. Jets store a span of entries (StJet::
+// SetConstituentSpan) instead of a copy of their constituent PseudoJets, which
+// are only made on request (StJet::GetJetConstituents). The table is owned by
+// the jet maker and valid for the current event
+//
+//******************************************************************************
+
+#ifndef StJetConstituentTable_H
+#define StJetConstituentTable_H
+
+// ROOT includes
+#include "TObject.h"
+#include <vector>
+
+// FastJet includes
+#include "FJ_includes.h"
+
+class StJetConstituentTable : public TObject
+{
+   public:
+    // constituent type
+    enum EConstituentType_t {
+      kTrack,
+      kTower
+    };
+
+             StJetConstituentTable();
+    virtual  ~StJetConstituentTable();
+
+    // per event: Reset(), Fill() with the jet input vectors, AddJet() for each jet - memory stays allocated
+    void              Reset();
+    void              Fill(const std::vector<fastjet::PseudoJet> &vectors);
+    Int_t             AddJet(const std::vector<fastjet::PseudoJet> &constituents);
+
+    // entries
+    Int_t             GetNEntries() const                 { return (Int_t)fPt.size(); }
+    Float_t           GetPt(Int_t i) const                { return fPt[i];    }
+    Float_t           GetEta(Int_t i) const               { return fEta[i];   }
+    Float_t           GetPhi(Int_t i) const               { return fPhi[i];   }       // (0, 2pi)
+    Float_t           GetE(Int_t i) const                 { return fE[i];     }
+    Int_t             GetType(Int_t i) const              { return fType[i];  }
+    Bool_t            IsTrack(Int_t i) const              { return (fType[i] == kTrack); }
+    Bool_t            IsTower(Int_t i) const              { return (fType[i] == kTower); }
+    Int_t             GetIndex(Int_t i) const             { return fIndex[i]; }       // track index or tower index (tower ID - 1)
+    Int_t             GetUserIndex(Int_t i) const         { return (fType[i] == kTrack) ? fIndex[i] : -(fIndex[i] + 2); }
+    fastjet::PseudoJet GetPseudoJet(Int_t i) const;
+
+    // entries of the jets: the k-th constituent of a jet with span (begin, n) is GetJetEntry(begin + k), tracks first
+    Int_t             GetNJetEntries() const              { return (Int_t)fJetEntries.size(); }
+    Int_t             GetJetEntry(Int_t k) const          { return fJetEntries[k]; }
+
+    // entry of a FastJet user index (tracks 0+, towers < -1), -1 if not an input of this event
+    Int_t             FindEntry(Int_t uid) const;
+
+   private:
+    std::vector<Float_t> fPt;                       //! constituent pt
+    std::vector<Float_t> fEta;                      //! constituent eta
+    std::vector<Float_t> fPhi;                      //! constituent phi
+    std::vector<Float_t> fE;                        //! constituent energy
+    std::vector<UChar_t> fType;                     //! constituent type
+    std::vector<Int_t>   fIndex;                    //! track or tower index
+    std::vector<Int_t>   fJetEntries;               //! entries of the jet constituents, jet after jet
+    std::vector<Int_t>   fTrackEntry;               //! entry of track index, -1 if not an input
+    std::vector<Int_t>   fTowerEntry;               //! entry of tower index, -1 if not an input
+
+    ClassDef(StJetConstituentTable, 1)
+};
+#endif
@@ -19,6 +19,7 @@
 #include "TVector3.h"
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 
 // STAR includes
 #include "StRoot/StPicoEvent/StPicoDst.h"
@@ -35,6 +36,12 @@
 #include "StRho.h"
 #include "StJetMakerTask.h"
 #include "StEventPlaneMaker.h"
+#include "StTrackCacheMaker.h"
+#include "StTrackEtaPhiGrid.h"
+#include "StEventSelectionMaker.h"
+#include "StTrackEfficiencyTable.h"
+#include "StRunContext.h"
+#include "StBemcTowerGeometry.h"
 #include "runlistP12id.h" // Run12 pp
 #include "runlistP16ij.h"
 #include "runlistRun14AuAu_P18ih.h" // new Run14 AuAu
@@ -111,6 +118,11 @@ StJetFrameworkPicoBase::StJetFrameworkPicoBase() :
   RhoMaker2(0x0),
   EventPlaneMaker(0x0),
   mCentMaker(0x0),
+  mTrackCache(0x0),
+  fTrackGrid(0x0),
+  fEfficiencyTable(0x0),
+  fRunContexts(),
+  fTowerGeom(0x0),
   mEmcPosition(0x0),
   grefmultCorr(0x0),
   refmultCorr(0x0),
@@ -119,10 +131,13 @@ StJetFrameworkPicoBase::StJetFrameworkPicoBase() :
   mOutNameEP(""),
   mOutNameQA(""),
   fJetMakerName(""),
+  fJetArrayName(""),
   fJetBGMakerName(""),
   fRhoMakerName(""),
   fRhoSparseMakerName(""),
   fEventPlaneMakerName(""),
+  fTrackCacheMakerName("TrackCacheMaker"),
+  fEventSelectionMakerName("EventSelectionMaker"),
   fRho(0x0),
   fRho1(0x0),
   fRho2(0x0),
@@ -130,7 +145,9 @@ StJetFrameworkPicoBase::StJetFrameworkPicoBase() :
   fAddToHistogramsName(""),
   mEventCounter(0),
   mAllPVEventCounter(0),
-  mInputEventCounter(0)
+  mInputEventCounter(0),
+  fHaveBadTowerList(kFALSE),
+  fHaveDeadTowerList(kFALSE)
 {
 
 }
@@ -193,6 +210,11 @@ StJetFrameworkPicoBase::StJetFrameworkPicoBase(const char *name) :
   RhoMaker2(0x0),
   EventPlaneMaker(0x0),
   mCentMaker(0x0),
+  mTrackCache(0x0),
+  fTrackGrid(0x0),
+  fEfficiencyTable(0x0),
+  fRunContexts(),
+  fTowerGeom(0x0),
   mEmcPosition(0x0),
   grefmultCorr(0x0),
   refmultCorr(0x0),
@@ -201,10 +223,13 @@ StJetFrameworkPicoBase::StJetFrameworkPicoBase(const char *name) :
   mOutNameEP(""),
   mOutNameQA(""),
   fJetMakerName(""),
+  fJetArrayName(""),
   fJetBGMakerName(""),
   fRhoMakerName(""),
   fRhoSparseMakerName(""),
   fEventPlaneMakerName(""),
+  fTrackCacheMakerName("TrackCacheMaker"),
+  fEventSelectionMakerName("EventSelectionMaker"),
   fRho(0x0),
   fRho1(0x0),
   fRho2(0x0),
@@ -212,7 +237,9 @@ StJetFrameworkPicoBase::StJetFrameworkPicoBase(const char *name) :
   fAddToHistogramsName(""),
   mEventCounter(0),
   mAllPVEventCounter(0),
-  mInputEventCounter(0)
+  mInputEventCounter(0),
+  fHaveBadTowerList(kFALSE),
+  fHaveDeadTowerList(kFALSE)
 {
 
 }
@@ -221,6 +248,10 @@ StJetFrameworkPicoBase::StJetFrameworkPicoBase(const char *name) :
 StJetFrameworkPicoBase::~StJetFrameworkPicoBase()
 { /*  */
   // destructor
+  if(fEfficiencyTable) delete fEfficiencyTable;
+  for(std::map<Int_t, StRunContext*>::iterator it = fRunContexts.begin(); it != fRunContexts.end(); ++it) delete it->second;
+  if(fTrackGrid) delete fTrackGrid;
+  if(fTowerGeom) delete fTowerGeom;
 }
 //
 //___________________________________________________________________________________
@@ -626,6 +657,33 @@ Double_t StJetFrameworkPicoBase::RelativeEPJET(Double_t jetAng, Double_t EPAng)
   return dphi;   // dphi in [0, Pi/2]
 }
 //
+// Function: event plane shift correction for all harmonics in one pass
+//   delta = sum_k cosCoef[k-1]*cos(order*k*psi) + sinCoef[k-1]*sin(order*k*psi),  k = 1..nHarm
+// - cos/sin of higher harmonics from the complex multiplication recurrence: one cos/sin call
+// - coefficient rows are contiguous (i.e. shift_A[ref9][region_vz]), the sum is a plain vectorizable loop
+//_________________________________________________________________________
+Double_t StJetFrameworkPicoBase::ShiftCorrection(Double_t psi, const Double_t *cosCoef, const Double_t *sinCoef, Int_t nHarm, Int_t order)
+{
+  if(!cosCoef || !sinCoef || nHarm < 1) return 0.;
+  if(nHarm > kMaxShiftHarmonics) nHarm = kMaxShiftHarmonics;
+
+  // (cos + i sin)(k*x) = (cos + i sin)((k-1)*x) * (cos + i sin)(x)
+  double c[kMaxShiftHarmonics], s[kMaxShiftHarmonics];
+  const double c1 = cos(order*psi), s1 = sin(order*psi);
+  c[0] = c1; s[0] = s1;
+  for(int k = 1; k < nHarm; k++) {
+    c[k] = c[k-1]*c1 - s[k-1]*s1;
+    s[k] = s[k-1]*c1 + c[k-1]*s1;
+  }
+
+  double delta = 0.;
+  for(int k = 0; k < nHarm; k++) {
+    delta += cosCoef[k]*c[k] + sinCoef[k]*s[k];
+  }
+
+  return delta;
+}
+//
 /*
 //
 // Function: clones a track list by using StPicoTrack which uses much less memory (used for event mixing)
@@ -669,6 +727,12 @@ TClonesArray *StJetFrameworkPicoBase::CloneAndReduceTrackList(TClonesArray *trac
 // members will be used here
 //________________________________________________________________________
 Bool_t StJetFrameworkPicoBase::AcceptTrack(StPicoTrack *trk, Float_t B, TVector3 Vert) {
+  return AcceptTrack(trk, B, Vert, fTrackPtMinCut, fTrackPtMaxCut);
+}
+//
+// Function: track quality cuts with the pt range given - e.g. no pt max for the max track pt of the event
+//________________________________________________________________________
+Bool_t StJetFrameworkPicoBase::AcceptTrack(StPicoTrack *trk, Float_t B, TVector3 Vert, Double_t ptMin, Double_t ptMax) {
   // constants: assume neutral pion mass
   //double pi0mass = Pico::mMass[0]; // GeV
   double pi = 1.0*TMath::Pi();
@@ -696,8 +760,8 @@ Bool_t StJetFrameworkPicoBase::AcceptTrack(StPicoTrack *trk, Float_t B, TVector3
   double nHitsRatio = 1.0*nHitsFit/nHitsMax;
 
   // track acceptance cuts now - after getting 3vector - hardcoded
-  if(pt < fTrackPtMinCut) return kFALSE;
-  if(pt > fTrackPtMaxCut) return kFALSE; // 20.0 STAR, (increased to 30.0) 100.0 ALICE
+  if(pt < ptMin) return kFALSE;
+  if(pt > ptMax) return kFALSE; // 20.0 STAR, (increased to 30.0) 100.0 ALICE
   if((eta < fTrackEtaMinCut) || (eta > fTrackEtaMaxCut)) return kFALSE;
   if(phi < 0.0)    phi += 2.0*pi;
   if(phi > 2.0*pi) phi -= 2.0*pi;
@@ -713,6 +777,110 @@ Bool_t StJetFrameworkPicoBase::AcceptTrack(StPicoTrack *trk, Float_t B, TVector3
   // passed all above cuts - keep track
   return kTRUE;
 }
+//
+// Function: track quality cuts applied to a track from the shared track cache
+// - same cuts as above, without re-computing the track momentum
+//________________________________________________________________________
+Bool_t StJetFrameworkPicoBase::AcceptTrack(StTrackCacheMaker *cache, Int_t itrk) {
+  return cache->PassCuts(itrk, fTrackPtMinCut, fTrackPtMaxCut, fTrackEtaMinCut, fTrackEtaMaxCut,
+                         fTrackPhiMinCut, fTrackPhiMaxCut, fTrackDCAcut, fTracknHitsFit, fTracknHitsRatio);
+}
+//
+// Function: get the shared track cache (StTrackCacheMaker)
+// returns 0x0 if it is not in the chain, was not filled for the current event,
+// or was filled with a different track type (primary/global) than this maker uses
+//________________________________________________________________________
+StTrackCacheMaker *StJetFrameworkPicoBase::GetTrackCache() {
+  // sets global pointer so it can be used for the rest of the event
+  StTrackCacheMaker *cache = static_cast<StTrackCacheMaker*>(GetMaker(fTrackCacheMakerName));
+  mTrackCache = 0x0;
+  if(!cache || !mPicoEvent) return 0x0;
+  if(!cache->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) return 0x0;
+  if(cache->GetUsePrimaryTracks() != doUsePrimTracks) return 0x0;
+
+  mTrackCache = cache;
+  return mTrackCache;
+}
+//
+// Function: get the eta-phi grid of tracks accepted with this makers track cuts
+// filled on first use in an event (from the shared track cache if available) and reused for
+// all cone, annulus and strip queries of the event - needs mPicoDst, Bfield and mVertex set
+//________________________________________________________________________
+StTrackEtaPhiGrid *StJetFrameworkPicoBase::GetTrackGrid() {
+  if(!mPicoDst || !mPicoEvent) return 0x0;
+  if(!fTrackGrid) fTrackGrid = new StTrackEtaPhiGrid();
+
+  // already filled for this event
+  int runId = mPicoEvent->runId();
+  int eventId = mPicoEvent->eventId();
+  if(fTrackGrid->IsCurrent(runId, eventId)) return fTrackGrid;
+
+  fTrackGrid->Clear();
+  int nTracks = mPicoDst->numberOfTracks();
+  for(int i = 0; i < nTracks; i++) {
+    if(mTrackCache) {
+      if(!AcceptTrack(mTrackCache, i)) { continue; }
+      fTrackGrid->AddTrack(i, mTrackCache->GetPt(i), mTrackCache->GetEta(i), mTrackCache->GetPhi(i));
+    } else {
+      // get track pointer
+      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(i));
+      if(!trk) { continue; }
+
+      // acceptance and kinematic quality cuts
+      if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
+
+      // get momentum vector of track - global or primary track
+      TVector3 mTrkMom;
+      if(doUsePrimTracks) {
+        mTrkMom = trk->pMom();                 // get primary track vector
+      } else {
+        mTrkMom = trk->gMom(mVertex, Bfield);  // get global track vector
+      }
+
+      fTrackGrid->AddTrack(i, mTrkMom.Perp(), mTrkMom.PseudoRapidity(), mTrkMom.Phi());
+    }
+  }
+  fTrackGrid->Build();
+  fTrackGrid->SetEvent(runId, eventId);
+
+  return fTrackGrid;
+}
+//
+// Function: get the shared event selection (StEventSelectionMaker)
+// returns 0x0 if it is not in the chain, did not run for the current event,
+// or used a different track type (primary/global) than this maker uses
+//________________________________________________________________________
+StEventSelectionMaker *StJetFrameworkPicoBase::GetEventSelection() {
+  StEventSelectionMaker *sel = static_cast<StEventSelectionMaker*>(GetMaker(fEventSelectionMakerName));
+  if(!sel || !mPicoEvent) return 0x0;
+  if(!sel->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) return 0x0;
+  if(sel->GetUsePrimaryTracks() != doUsePrimTracks) return 0x0;
+
+  return sel;
+}
+//
+// Function: get the jet array selected with SetJetArrayName() from a jet maker
+// the primary array when no name is set, 0x0 if the jet maker has no array of that name
+//________________________________________________________________________
+TClonesArray *StJetFrameworkPicoBase::GetJetArray(StJetMakerTask *jetMaker) const {
+  if(!jetMaker) return 0x0;
+  if(fJetArrayName.IsNull()) return jetMaker->GetJets();
+
+  return jetMaker->GetJets(fJetArrayName.Data());
+}
+//
+// Function: get the event plane maker for a pt assoc bin
+// one maker per bin is named <name><bin>, a single maker running all bins is named <name>
+//________________________________________________________________________
+StEventPlaneMaker *StJetFrameworkPicoBase::GetEventPlaneMaker(TString fEPMakerNametemp, Int_t ptbin) {
+  StEventPlaneMaker *epMaker = static_cast<StEventPlaneMaker*>(GetMaker(Form("%s%i", fEPMakerNametemp.Data(), ptbin)));
+  if(epMaker) return epMaker;
+
+  epMaker = static_cast<StEventPlaneMaker*>(GetMaker(fEPMakerNametemp.Data()));
+  if(epMaker && epMaker->GetdoEPTPCAllPtAssocBins()) return epMaker;
+
+  return 0x0;
+}
 /*
 //
 // Tower Quality Cuts
@@ -872,7 +1040,7 @@ StJet *StJetFrameworkPicoBase::GetLeadingJet(TString fJetMakerNametemp, StRhoPar
   }
 
   // if we have JetMaker, get jet collection associated with it
-  fJets = static_cast<TClonesArray*>(JetMaker->GetJets());
+  fJets = GetJetArray(JetMaker);
   if(!fJets) {
     LOG_WARN << Form(" No fJets object! Skip! ") << endm;
     return 0x0;
@@ -934,7 +1102,7 @@ StJet *StJetFrameworkPicoBase::GetSubLeadingJet(TString fJetMakerNametemp, StRho
   }
 
   // if we have JetMaker, get jet collection associated with it
-  fJets = static_cast<TClonesArray*>(JetMaker->GetJets());
+  fJets = GetJetArray(JetMaker);
   if(!fJets) {
     LOG_WARN << Form(" No fJets object! Skip! ") << endm;
     return 0x0;
@@ -1146,253 +1314,218 @@ Bool_t StJetFrameworkPicoBase::DoComparison(int myarr[], int elems) {
   return match;
 }
 //
-// Function: check if event fired min-bias (MB) trigger
+// trigger ID tables: one list per run flag and MB type / EMC trigger type
+// bit of the list in the event trigger mask, see GetTriggerMask()
 //_________________________________________________________________________
-Bool_t StJetFrameworkPicoBase::CheckForMB(Int_t RunFlag, Int_t type) {
+namespace {
   // Run11 triggers: pp
-  int arrMB_Run11[] = {320000, 320001, 320011, 320021, 330021};
+  const int arrMB_Run11[] = {320000, 320001, 320011, 320021, 330021};
 
   // Run12 (200 GeV pp) triggers: 1) VPDMB, 370011-main
-  int arrMB_Run12[] = {370011};
-  int arrMB_Run12extra[] = {370001, 370011};
+  const int arrMB_Run12[] = {370011};
+  const int arrMB_Run12extra[] = {370001, 370011};
   // 370501:  BHT0*VPDMB
   // 370511:  BHT1*VPDMB
 
   // Run13 triggers: pp
-  int arrMB_Run13[] = {430001, 430011, 430021, 430031};
+  const int arrMB_Run13[] = {430001, 430011, 430021, 430031};
 
   // Run14 triggers: 200 GeV AuAu
-  int arrMB_Run14[] = {450014};
-  int arrMB30_Run14[] = {450010, 450020};
-  int arrMB5_Run14[] = {450005, 450008, 450009, 450014, 450015, 450018, 450024, 450025, 450050, 450060};
+  const int arrMB_Run14[] = {450014};
+  const int arrMB30_Run14[] = {450010, 450020};
+  const int arrMB5_Run14[] = {450005, 450008, 450009, 450014, 450015, 450018, 450024, 450025, 450050, 450060};
   // additional 30: 450201, 450202, 450211, 450212
   // 1: VPDMB-5   Run:            15075055 - 15076099
   // 1: VPDMB-5-p-nobsmd-hlt Run: 15081020 - 15090048
   // 4: VPDMB-5-p-nobsmd-hlt Run: 15090049 - 15167007
 
   // Run16 triggers: 200 GeV AuAu
-  int arrMB_Run16[] = {520021};
-  int arrMB5_Run16[] = {520001, 520002, 520003, 520011, 520012, 520013, 520021, 520022, 520023, 520031, 520033, 520041, 520042, 520043, 520051, 520822, 520832, 520842, 570702};
-  int arrMB10_Run16[] = {520007, 520017, 520027, 520037, 520201, 520211, 520221, 520231, 520241, 520251, 520261, 520601, 520611, 520621, 520631, 520641};
+  const int arrMB_Run16[] = {520021};
+  const int arrMB5_Run16[] = {520001, 520002, 520003, 520011, 520012, 520013, 520021, 520022, 520023, 520031, 520033, 520041, 520042, 520043, 520051, 520822, 520832, 520842, 570702};
+  const int arrMB10_Run16[] = {520007, 520017, 520027, 520037, 520201, 520211, 520221, 520231, 520241, 520251, 520261, 520601, 520611, 520621, 520631, 520641};
 
   // Run17 triggers: 510 GeV pp
-  int arrMB30_Run17[] = {570001, 590001};
-  int arrMB100_Run17[] = {590002};
-  int arrMBnovtx_Run17[] = {570004};
-
-  // run flag selection to check for MB firing
-  switch(RunFlag) {
-    case StJetFrameworkPicoBase::Run11_pp500 : // Run11 pp
-        switch(type) {
-          case StJetFrameworkPicoBase::kVPDMB :
-              if((DoComparison(arrMB_Run11, sizeof(arrMB_Run11)/sizeof(*arrMB_Run11)))) { return kTRUE; }
-              break;
-          default :
-              if((DoComparison(arrMB_Run11, sizeof(arrMB_Run11)/sizeof(*arrMB_Run11)))) { return kTRUE; }
-        }
-        break;
-
-    case StJetFrameworkPicoBase::Run12_pp200 : // Run12 pp (200 GeV)
-        switch(type) {
-          case StJetFrameworkPicoBase::kRun12main :  // update if needed
-              if((DoComparison(arrMB_Run12, sizeof(arrMB_Run12)/sizeof(*arrMB_Run12)))) { return kTRUE; }
-              break;
-          case StJetFrameworkPicoBase::kVPDMB :
-              if((DoComparison(arrMB_Run12extra, sizeof(arrMB_Run12extra)/sizeof(*arrMB_Run12extra)))) { return kTRUE; }
-              break;
-          default :
-              if((DoComparison(arrMB_Run12, sizeof(arrMB_Run12)/sizeof(*arrMB_Run12)))) { return kTRUE; }
-        }
-        break;
-
-    case StJetFrameworkPicoBase::Run13_pp510 : // Run13 pp
-        switch(type) {
-          case StJetFrameworkPicoBase::kVPDMB :
-              if((DoComparison(arrMB_Run13, sizeof(arrMB_Run13)/sizeof(*arrMB_Run13)))) { return kTRUE; }
-              break;
-          default :
-              if((DoComparison(arrMB_Run13, sizeof(arrMB_Run13)/sizeof(*arrMB_Run13)))) { return kTRUE; }
-        }
-        break;
-
-    case StJetFrameworkPicoBase::Run14_AuAu200 : // Run14 AuAu (200 GeV)
-        switch(type) {
-          case kRun14main :
-              if((DoComparison(arrMB_Run14, sizeof(arrMB_Run14)/sizeof(*arrMB_Run14)))) { return kTRUE; }
-              break;
-          case kVPDMB5 :
-              if((DoComparison(arrMB5_Run14, sizeof(arrMB5_Run14)/sizeof(*arrMB5_Run14)))) { return kTRUE; }
-              break;
-          case kVPDMB30 :
-              if((DoComparison(arrMB30_Run14, sizeof(arrMB30_Run14)/sizeof(*arrMB30_Run14)))) { return kTRUE; }
-              break;
-          default : // kRun14Main or kVPDMB
-              if((DoComparison(arrMB_Run14, sizeof(arrMB_Run14)/sizeof(*arrMB_Run14)))) { return kTRUE; }
-        }
-        break;
-
-    case StJetFrameworkPicoBase::Run14_AuAu200_MB : // Run14 AuAu (200 GeV) - HFT dataset (MB trigger)
-        switch(type) {
-          case kRun14main :
-              if((DoComparison(arrMB_Run14, sizeof(arrMB_Run14)/sizeof(*arrMB_Run14)))) { return kTRUE; }
-              break;
-          case kVPDMB5 :
-              if((DoComparison(arrMB5_Run14, sizeof(arrMB5_Run14)/sizeof(*arrMB5_Run14)))) { return kTRUE; }
-              break;
-          case kVPDMB30 :
-              if((DoComparison(arrMB30_Run14, sizeof(arrMB30_Run14)/sizeof(*arrMB30_Run14)))) { return kTRUE; }
-              break;
-          default : // kRun14Main or kVPDMB
-              if((DoComparison(arrMB_Run14, sizeof(arrMB_Run14)/sizeof(*arrMB_Run14)))) { return kTRUE; }
-        }
-        break;
+  const int arrMB30_Run17[] = {570001, 590001};
+  const int arrMB100_Run17[] = {590002};
+  const int arrMBnovtx_Run17[] = {570004};
 
-    case StJetFrameworkPicoBase::Run16_AuAu200 : // Run16 AuAu (200 GeV)
-        switch(type) {
-          case kRun16main :
-              if((DoComparison(arrMB_Run16, sizeof(arrMB_Run16)/sizeof(*arrMB_Run16)))) { return kTRUE; }
-              break;
-          case kVPDMB5 :
-              if((DoComparison(arrMB5_Run16, sizeof(arrMB5_Run16)/sizeof(*arrMB5_Run16)))) { return kTRUE; }
-              break;
-          case kVPDMB10 :
-              if((DoComparison(arrMB10_Run16, sizeof(arrMB10_Run16)/sizeof(*arrMB10_Run16)))) { return kTRUE; }
-              break;
-          default :
-              if((DoComparison(arrMB_Run16, sizeof(arrMB_Run16)/sizeof(*arrMB_Run16)))) { return kTRUE; }
-        }
-        break;
-
-    case StJetFrameworkPicoBase::Run17_pp510 : // Run17 pp (510 GeV)
-        switch(type) {
-          case StJetFrameworkPicoBase::kVPDMB30 :
-              if((DoComparison(arrMB30_Run17, sizeof(arrMB30_Run17)/sizeof(*arrMB30_Run17)))) { return kTRUE; }
-              break;
-          case StJetFrameworkPicoBase::kVPDMB100 :
-              if((DoComparison(arrMB100_Run17, sizeof(arrMB100_Run17)/sizeof(*arrMB100_Run17)))) { return kTRUE; }
-              break;
-          case StJetFrameworkPicoBase::kVPDMBnovtx :
-              if((DoComparison(arrMBnovtx_Run17, sizeof(arrMBnovtx_Run17)/sizeof(*arrMBnovtx_Run17)))) { return kTRUE; }
-              break;
-          default :
-              if((DoComparison(arrMB30_Run17, sizeof(arrMB30_Run17)/sizeof(*arrMB30_Run17)))) { return kTRUE; }
-        }
-        break;
-
-  } // RunFlag switch
-
-  // return status
-  return kFALSE;
-} // MB function
-//
-// check to see if the event was EMC triggered for High Towers
-//____________________________________________________________________________
-Bool_t StJetFrameworkPicoBase::CheckForHT(Int_t RunFlag, Int_t type) {
   // Run12 (200 GeV pp) triggers:
-  int arrHT1_Run12[] = {370511, 370546};
-  int arrHT2_Run12[] = {370521, 370522, 370531, 370980};
-  int arrHT3_Run12[] = {380206, 380216}; // NO HT3 triggers in this dataset
+  const int arrHT1_Run12[] = {370511, 370546};
+  const int arrHT2_Run12[] = {370521, 370522, 370531, 370980};
+  const int arrHT3_Run12[] = {380206, 380216}; // NO HT3 triggers in this dataset
 
   // Run14 triggers: 200 GeV AuAu
-  int arrHT1_Run14[] = {450201, 450211, 460201};
-  int arrHT2_Run14[] = {450202, 450212, 460202, 460212};
-  int arrHT3_Run14[] = {450203, 450213, 460203};
+  const int arrHT1_Run14[] = {450201, 450211, 460201};
+  const int arrHT2_Run14[] = {450202, 450212, 460202, 460212};
+  const int arrHT3_Run14[] = {450203, 450213, 460203};
 
   // Run16 triggers: 200 GeV AuAu
-  int arrHT1_Run16[] = {520201, 520211, 520221, 520231, 520241, 520251, 520261, 520605, 520615, 520625, 520635, 520645, 520655, 550201, 560201, 560202, 530201, 540201};
-  int arrHT2_Run16[] = {530202, 540203};
-  int arrHT3_Run16[] = {520203, 530213};
+  const int arrHT1_Run16[] = {520201, 520211, 520221, 520231, 520241, 520251, 520261, 520605, 520615, 520625, 520635, 520645, 520655, 550201, 560201, 560202, 530201, 540201};
+  const int arrHT2_Run16[] = {530202, 540203};
+  const int arrHT3_Run16[] = {520203, 530213};
 
   // Run17 triggers: (HT1 and HT2 not exclusive) 510 GeV pp
-  int arrHT1_Run17[] = {570204, 570214};
-  int arrHT2_Run17[] = {570205, 570215};
-  int arrHT3_Run17[] = {570201, 590201};
+  const int arrHT1_Run17[] = {570204, 570214};
+  const int arrHT2_Run17[] = {570205, 570215};
+  const int arrHT3_Run17[] = {570201, 590201};
+
+  struct TriggerList {
+    int        runFlag;
+    int        bit;
+    const int *ids;
+    int        nIds;
+  };
+
+  const int kMBDef = StJetFrameworkPicoBase::kTrigMaskMBDefault;
+  const int kHTOff = StJetFrameworkPicoBase::kTrigMaskHTOffset;
+  const int kHTDef = StJetFrameworkPicoBase::kTrigMaskHTDefault;
+
+#define TRIGLIST(flag, bit, arr) { StJetFrameworkPicoBase::flag, bit, arr, sizeof(arr)/sizeof(*arr) }
+  const TriggerList triggerLists[] = {
+    // MB - run flags not listed never fire
+    TRIGLIST(Run11_pp500,      StJetFrameworkPicoBase::kVPDMB,       arrMB_Run11),
+    TRIGLIST(Run11_pp500,      kMBDef,                               arrMB_Run11),
+    TRIGLIST(Run12_pp200,      StJetFrameworkPicoBase::kRun12main,   arrMB_Run12),
+    TRIGLIST(Run12_pp200,      StJetFrameworkPicoBase::kVPDMB,       arrMB_Run12extra),
+    TRIGLIST(Run12_pp200,      kMBDef,                               arrMB_Run12),
+    TRIGLIST(Run13_pp510,      StJetFrameworkPicoBase::kVPDMB,       arrMB_Run13),
+    TRIGLIST(Run13_pp510,      kMBDef,                               arrMB_Run13),
+    TRIGLIST(Run14_AuAu200,    StJetFrameworkPicoBase::kRun14main,   arrMB_Run14),
+    TRIGLIST(Run14_AuAu200,    StJetFrameworkPicoBase::kVPDMB5,      arrMB5_Run14),
+    TRIGLIST(Run14_AuAu200,    StJetFrameworkPicoBase::kVPDMB30,     arrMB30_Run14),
+    TRIGLIST(Run14_AuAu200,    kMBDef,                               arrMB_Run14),
+    TRIGLIST(Run14_AuAu200_MB, StJetFrameworkPicoBase::kRun14main,   arrMB_Run14),
+    TRIGLIST(Run14_AuAu200_MB, StJetFrameworkPicoBase::kVPDMB5,      arrMB5_Run14),
+    TRIGLIST(Run14_AuAu200_MB, StJetFrameworkPicoBase::kVPDMB30,     arrMB30_Run14),
+    TRIGLIST(Run14_AuAu200_MB, kMBDef,                               arrMB_Run14),
+    TRIGLIST(Run16_AuAu200,    StJetFrameworkPicoBase::kRun16main,   arrMB_Run16),
+    TRIGLIST(Run16_AuAu200,    StJetFrameworkPicoBase::kVPDMB5,      arrMB5_Run16),
+    TRIGLIST(Run16_AuAu200,    StJetFrameworkPicoBase::kVPDMB10,     arrMB10_Run16),
+    TRIGLIST(Run16_AuAu200,    kMBDef,                               arrMB_Run16),
+    TRIGLIST(Run17_pp510,      StJetFrameworkPicoBase::kVPDMB30,     arrMB30_Run17),
+    TRIGLIST(Run17_pp510,      StJetFrameworkPicoBase::kVPDMB100,    arrMB100_Run17),
+    TRIGLIST(Run17_pp510,      StJetFrameworkPicoBase::kVPDMBnovtx,  arrMBnovtx_Run17),
+    TRIGLIST(Run17_pp510,      kMBDef,                               arrMB30_Run17),
+
+    // HT
+    TRIGLIST(Run12_pp200,      kHTOff + StJetFrameworkPicoBase::kIsHT1, arrHT1_Run12),
+    TRIGLIST(Run12_pp200,      kHTOff + StJetFrameworkPicoBase::kIsHT2, arrHT2_Run12),
+    TRIGLIST(Run12_pp200,      kHTOff + StJetFrameworkPicoBase::kIsHT3, arrHT3_Run12),
+    TRIGLIST(Run12_pp200,      kHTDef,                                  arrHT2_Run12),
+    TRIGLIST(Run14_AuAu200,    kHTOff + StJetFrameworkPicoBase::kIsHT1, arrHT1_Run14),
+    TRIGLIST(Run14_AuAu200,    kHTOff + StJetFrameworkPicoBase::kIsHT2, arrHT2_Run14),
+    TRIGLIST(Run14_AuAu200,    kHTOff + StJetFrameworkPicoBase::kIsHT3, arrHT3_Run14),
+    TRIGLIST(Run14_AuAu200,    kHTDef,                                  arrHT2_Run14), // default to HT2
+    TRIGLIST(Run14_AuAu200_MB, kHTOff + StJetFrameworkPicoBase::kIsHT1, arrHT1_Run14),
+    TRIGLIST(Run14_AuAu200_MB, kHTOff + StJetFrameworkPicoBase::kIsHT2, arrHT2_Run14),
+    TRIGLIST(Run14_AuAu200_MB, kHTOff + StJetFrameworkPicoBase::kIsHT3, arrHT3_Run14),
+    TRIGLIST(Run14_AuAu200_MB, kHTDef,                                  arrHT2_Run14), // default to HT2
+    TRIGLIST(Run16_AuAu200,    kHTOff + StJetFrameworkPicoBase::kIsHT1, arrHT1_Run16),
+    TRIGLIST(Run16_AuAu200,    kHTOff + StJetFrameworkPicoBase::kIsHT2, arrHT2_Run16),
+    TRIGLIST(Run16_AuAu200,    kHTOff + StJetFrameworkPicoBase::kIsHT3, arrHT3_Run16),
+    TRIGLIST(Run16_AuAu200,    kHTDef,                                  arrHT1_Run16), // Run16 only has HT1's
+    TRIGLIST(Run17_pp510,      kHTOff + StJetFrameworkPicoBase::kIsHT1, arrHT1_Run17),
+    TRIGLIST(Run17_pp510,      kHTOff + StJetFrameworkPicoBase::kIsHT2, arrHT2_Run17),
+    TRIGLIST(Run17_pp510,      kHTOff + StJetFrameworkPicoBase::kIsHT3, arrHT3_Run17),
+    TRIGLIST(Run17_pp510,      kHTDef,                                  arrHT3_Run17)  // HT3
+  };
+#undef TRIGLIST
+  const int nTriggerLists = sizeof(triggerLists)/sizeof(*triggerLists);
+
+  // trigger mask of the current event - shared by all makers of the chain
+  struct TriggerMaskCache {
+    int    runId;
+    int    eventId;
+    int    runFlag;
+    UInt_t mask;
+  };
+  TriggerMaskCache triggerMaskCache = { -1, -1, -1, 0 };
+}
+//
+// Function: trigger mask of the current event for run flag
+// bit t: MB type t (fMBFlagEnum), bit kTrigMaskHTOffset + t: EMC trigger type t (fEmcTriggerFlagEnum)
+// types without own list for the run flag get the default list bit (kTrigMaskMBDefault, kTrigMaskHTDefault)
+// compiled once per event from the trigger tables and cached for all makers
+//_________________________________________________________________________
+UInt_t StJetFrameworkPicoBase::GetTriggerMask(Int_t RunFlag) {
+  // get PicoDstMaker - pointer kept, event taken from it every call
+  if(!mPicoDstMaker) mPicoDstMaker = static_cast<StPicoDstMaker*>(GetMaker("picoDst"));
+  if(!mPicoDstMaker) { LOG_WARN << " No PicoDstMaker! Skip! " << endm;  return 0; }
 
-  // run flag selection to check for MB firing
-  switch(RunFlag) {
-    case StJetFrameworkPicoBase::Run12_pp200 : // Run12 pp (200 GeV)
-        switch(type) {
-          case StJetFrameworkPicoBase::kIsHT1 :
-              if((DoComparison(arrHT1_Run12, sizeof(arrHT1_Run12)/sizeof(*arrHT1_Run12)))) { return kTRUE; }
-              break;
-          case StJetFrameworkPicoBase::kIsHT2 :
-              if((DoComparison(arrHT2_Run12, sizeof(arrHT2_Run12)/sizeof(*arrHT2_Run12)))) { return kTRUE; }
-              break;
-          case StJetFrameworkPicoBase::kIsHT3 :
-              if((DoComparison(arrHT3_Run12, sizeof(arrHT3_Run12)/sizeof(*arrHT3_Run12)))) { return kTRUE; }
-              break;
-          default :
-              if((DoComparison(arrHT2_Run12, sizeof(arrHT2_Run12)/sizeof(*arrHT2_Run12)))) { return kTRUE; }
-        }
-        break;
+  // construct PicoDst object from maker
+  mPicoDst = static_cast<StPicoDst*>(mPicoDstMaker->picoDst());
+  if(!mPicoDst) { LOG_WARN << " No PicoDst! Skip! " << endm; return 0; }
 
-    case StJetFrameworkPicoBase::Run14_AuAu200 : // Run14 AuAu (200 GeV)
-        switch(type) {
-          case kIsHT1 :
-              if((DoComparison(arrHT1_Run14, sizeof(arrHT1_Run14)/sizeof(*arrHT1_Run14)))) { return kTRUE; }
-              break;
-          case kIsHT2 :
-              if((DoComparison(arrHT2_Run14, sizeof(arrHT2_Run14)/sizeof(*arrHT2_Run14)))) { return kTRUE; }
-              break;
-          case kIsHT3 :
-              if((DoComparison(arrHT3_Run14, sizeof(arrHT3_Run14)/sizeof(*arrHT3_Run14)))) { return kTRUE; }
-              break;
-          default :  // default to HT2
-              if((DoComparison(arrHT2_Run14, sizeof(arrHT2_Run14)/sizeof(*arrHT2_Run14)))) { return kTRUE; }
-        }
-        break;
+  // create pointer to PicoEvent 
+  mPicoEvent = static_cast<StPicoEvent*>(mPicoDst->event());
+  if(!mPicoEvent) { LOG_WARN << " No PicoEvent! Skip! " << endm; return 0; }
 
-    case StJetFrameworkPicoBase::Run14_AuAu200_MB : // Run14 AuAu (200 GeV) - HFT dataset (MB trigger)
-        switch(type) {
-          case kIsHT1 :
-              if((DoComparison(arrHT1_Run14, sizeof(arrHT1_Run14)/sizeof(*arrHT1_Run14)))) { return kTRUE; }
-              break;
-          case kIsHT2 :
-              if((DoComparison(arrHT2_Run14, sizeof(arrHT2_Run14)/sizeof(*arrHT2_Run14)))) { return kTRUE; }
-              break;
-          case kIsHT3 :
-              if((DoComparison(arrHT3_Run14, sizeof(arrHT3_Run14)/sizeof(*arrHT3_Run14)))) { return kTRUE; }
-              break;
-          default :  // default to HT2
-              if((DoComparison(arrHT2_Run14, sizeof(arrHT2_Run14)/sizeof(*arrHT2_Run14)))) { return kTRUE; }
-        }
-        break;
+  // already compiled for this event
+  TriggerMaskCache &cache = triggerMaskCache;
+  if(cache.runId == mPicoEvent->runId() && cache.eventId == mPicoEvent->eventId() && cache.runFlag == RunFlag) return cache.mask;
 
-    case StJetFrameworkPicoBase::Run16_AuAu200 : // Run16 AuAu (200 GeV)
-        switch(type) {
-          case kIsHT1 :
-              if((DoComparison(arrHT1_Run16, sizeof(arrHT1_Run16)/sizeof(*arrHT1_Run16)))) { return kTRUE; }
-              break;
-          case kIsHT2 :
-              if((DoComparison(arrHT2_Run16, sizeof(arrHT2_Run16)/sizeof(*arrHT2_Run16)))) { return kTRUE; }
-              break;
-          case kIsHT3 :
-              if((DoComparison(arrHT3_Run16, sizeof(arrHT3_Run16)/sizeof(*arrHT3_Run16)))) { return kTRUE; }
-              break;
-          default :  // Run16 only has HT1's
-              if((DoComparison(arrHT1_Run16, sizeof(arrHT1_Run16)/sizeof(*arrHT1_Run16)))) { return kTRUE; }
-        }
-        break;
+  // check every list of this run flag against the event triggers
+  UInt_t mask = 0, hasList = GetTriggerListMask(RunFlag);
+  for(int i = 0; i < nTriggerLists; i++) {
+    const TriggerList &list = triggerLists[i];
+    if(list.runFlag != RunFlag) continue;
 
-    case StJetFrameworkPicoBase::Run17_pp510 : // Run17 pp (510 GeV)
-        switch(type) {
-          case StJetFrameworkPicoBase::kIsHT1 :
-              if((DoComparison(arrHT1_Run17, sizeof(arrHT1_Run17)/sizeof(*arrHT1_Run17)))) { return kTRUE; }
-              break;
-          case StJetFrameworkPicoBase::kIsHT2 :
-              if((DoComparison(arrHT2_Run17, sizeof(arrHT2_Run17)/sizeof(*arrHT2_Run17)))) { return kTRUE; }
-              break;
-          case StJetFrameworkPicoBase::kIsHT3 :
-              if((DoComparison(arrHT3_Run16, sizeof(arrHT3_Run17)/sizeof(*arrHT3_Run17)))) { return kTRUE; }
-              break;
-          default : // HT3
-              if((DoComparison(arrHT3_Run17, sizeof(arrHT3_Run17)/sizeof(*arrHT3_Run17)))) { return kTRUE; }
-        }
-        break; 
+    for(int j = 0; j < list.nIds; j++) {
+      if(mPicoEvent->isTrigger(list.ids[j])) { mask |= (1u << list.bit); break; }
+    }
+  }
 
-  } // RunFlag switch
+  // types without own list use the default list
+  for(int t = 0; t < kTrigMaskMBDefault; t++) {
+    if(!(hasList & (1u << t)) && (mask & (1u << kTrigMaskMBDefault))) mask |= (1u << t);
+  }
+  for(int t = kTrigMaskHTOffset; t < kTrigMaskHTDefault; t++) {
+    if(!(hasList & (1u << t)) && (mask & (1u << kTrigMaskHTDefault))) mask |= (1u << t);
+  }
 
-  return kFALSE;
+  cache.runId = mPicoEvent->runId();
+  cache.eventId = mPicoEvent->eventId();
+  cache.runFlag = RunFlag;
+  cache.mask = mask;
+
+  return mask;
+}
+//
+// Function: trigger mask bits that have their own trigger list for run flag
+//_________________________________________________________________________
+UInt_t StJetFrameworkPicoBase::GetTriggerListMask(Int_t RunFlag) {
+  UInt_t hasList = 0;
+  for(int i = 0; i < nTriggerLists; i++) {
+    if(triggerLists[i].runFlag == RunFlag) hasList |= (1u << triggerLists[i].bit);
+  }
+
+  return hasList;
+}
+//
+// Function: test MB type (fMBFlagEnum) in trigger mask
+//_________________________________________________________________________
+Bool_t StJetFrameworkPicoBase::HasMBTrigger(UInt_t mask, Int_t type) {
+  Int_t bit = (type >= 0 && type < kTrigMaskMBDefault) ? type : kTrigMaskMBDefault;
+  return (mask & (1u << bit)) ? kTRUE : kFALSE;
+}
+//
+// Function: test EMC trigger type (fEmcTriggerFlagEnum) in trigger mask
+//_________________________________________________________________________
+Bool_t StJetFrameworkPicoBase::HasHTTrigger(UInt_t mask, Int_t type) {
+  Int_t bit = (type >= 0 && kTrigMaskHTOffset + type < kTrigMaskHTDefault) ? kTrigMaskHTOffset + type : kTrigMaskHTDefault;
+  return (mask & (1u << bit)) ? kTRUE : kFALSE;
+}
+//
+// Function: check if event fired min-bias (MB) trigger
+//_________________________________________________________________________
+Bool_t StJetFrameworkPicoBase::CheckForMB(Int_t RunFlag, Int_t type) {
+  return HasMBTrigger(GetTriggerMask(RunFlag), type);
+}
+//
+// check to see if the event was EMC triggered for High Towers
+//____________________________________________________________________________
+Bool_t StJetFrameworkPicoBase::CheckForHT(Int_t RunFlag, Int_t type) {
+  return HasHTTrigger(GetTriggerMask(RunFlag), type);
 }
 //
 // Function: calculate momentum of a tower
@@ -1439,7 +1572,8 @@ Bool_t StJetFrameworkPicoBase::GetMomentum(TVector3 &mom, const StPicoBTowHit *t
 // Function: reset bad tower list
 //____________________________________________________________________________
 void StJetFrameworkPicoBase::ResetBadTowerList( ){
-  badTowers.clear();
+  fBadTowerBits.reset();
+  fHaveBadTowerList = kFALSE;
 }
 //
 // Add bad towers from comma separated values file
@@ -1468,7 +1602,9 @@ Bool_t StJetFrameworkPicoBase::AddBadTowers(TString csvfile){
       std::getline( ss, entry, ',' );
       int ientry = atoi(entry.c_str());
       if(ientry) {
-        badTowers.insert( ientry );
+        // IDs outside 1 - 4800 (e.g. empty list placeholder) only mark the list as read
+        if(ientry > 0 && ientry < kNTowerStatusBits) fBadTowerBits.set( ientry );
+        fHaveBadTowerList = kTRUE;
         __DEBUG(2, Form("Added bad tower # %d", ientry));
       }
     }
@@ -1479,14 +1615,13 @@ Bool_t StJetFrameworkPicoBase::AddBadTowers(TString csvfile){
 //
 // Function: check on if Tower is OK or not
 //____________________________________________________________________________________________
-Bool_t StJetFrameworkPicoBase::IsTowerOK( Int_t mTowId ){
-  //if( badTowers.size()==0 ){
-  if( badTowers.empty() ){
+Bool_t StJetFrameworkPicoBase::IsTowerOK( Int_t mTowId ) const {
+  if( !fHaveBadTowerList ){
     // maybe change class if calling FROM base
     __ERROR("StJetFrameworkPicoBase::IsTowerOK: WARNING: You're trying to run without a bad tower list. If you know what you're doing, deactivate this throw and recompile.");
     throw ( -1 );
   }
-  if( badTowers.count( mTowId )>0 ){
+  if( mTowId > 0 && mTowId < kNTowerStatusBits && fBadTowerBits[mTowId] ){
     __DEBUG(9, Form("Reject. Tower ID: %d", mTowId));
     return kFALSE;
   } else {
@@ -1498,7 +1633,8 @@ Bool_t StJetFrameworkPicoBase::IsTowerOK( Int_t mTowId ){
 // Function: reset dead tower list
 //____________________________________________________________________________
 void StJetFrameworkPicoBase::ResetDeadTowerList( ){
-  deadTowers.clear();
+  fDeadTowerBits.reset();
+  fHaveDeadTowerList = kFALSE;
 }
 //
 // Add dead towers from comma separated values file
@@ -1527,7 +1663,9 @@ Bool_t StJetFrameworkPicoBase::AddDeadTowers(TString csvfile){
       std::getline( ss, entry, ',' );
       int ientry = atoi(entry.c_str());
       if(ientry) {
-        deadTowers.insert( ientry );
+        // IDs outside 1 - 4800 (e.g. empty list placeholder) only mark the list as read
+        if(ientry > 0 && ientry < kNTowerStatusBits) fDeadTowerBits.set( ientry );
+        fHaveDeadTowerList = kTRUE;
         __DEBUG(2, Form("Added bad tower # %d", ientry));
       }
     }
@@ -1538,14 +1676,13 @@ Bool_t StJetFrameworkPicoBase::AddDeadTowers(TString csvfile){
 //
 // Function: check on if Tower is DEAD or not
 //____________________________________________________________________________________________
-Bool_t StJetFrameworkPicoBase::IsTowerDead( Int_t mTowId ){
-  //if( deadTowers.size()==0 ){
-  if( deadTowers.empty() ){
+Bool_t StJetFrameworkPicoBase::IsTowerDead( Int_t mTowId ) const {
+  if( !fHaveDeadTowerList ){
     // maybe change class if calling FROM base
     __ERROR("StJetFrameworkPicoBase::IsTowerDead: WARNING: You're trying to run without a dead tower list. If you know what you're doing, deactivate this throw and recompile.");
     throw ( -1 );
   }
-  if( deadTowers.count( mTowId )>0 ){
+  if( mTowId > 0 && mTowId < kNTowerStatusBits && fDeadTowerBits[mTowId] ){
     __DEBUG(9, Form("Reject. Tower ID: %d", mTowId));
     return kTRUE;
   } else {
@@ -1562,6 +1699,22 @@ Double_t StJetFrameworkPicoBase::GetMaxTrackPt()
   int nTrack = mPicoDst->numberOfTracks();
   double fMaxTrackPt = -99;
 
+  // use shared event selection if it already ran for this event with the same track cuts
+  StEventSelectionMaker *sel = GetEventSelection();
+  if(sel && sel->HasMaxTrackPtCuts(doUsePrimTracks, fTrackPtMinCut, fTrackPtMaxCut, fTrackEtaMinCut, fTrackEtaMaxCut,
+                                   fTrackPhiMinCut, fTrackPhiMaxCut, fTrackDCAcut, fTracknHitsFit, fTracknHitsRatio)) return sel->GetCachedMaxTrackPt();
+
+  // use shared track cache if available
+  StTrackCacheMaker *cache = GetTrackCache();
+  if(cache) {
+    for(int i = 0; i < cache->GetNumberOfTracks(); i++) {
+      if(!AcceptTrack(cache, i)) { continue; }
+      if(cache->GetPt(i) > fMaxTrackPt) { fMaxTrackPt = cache->GetPt(i); }
+    }
+
+    return fMaxTrackPt;
+  }
+
   // loop over all tracks
   for(int i = 0; i < nTrack; i++) {
     // get track pointer
@@ -1597,6 +1750,10 @@ Double_t StJetFrameworkPicoBase::GetMaxTowerEt()
   int nTowers = mPicoDst->numberOfBTowHits();
   double fMaxTowerEt = -99;
 
+  // use shared event selection if it already ran for this event
+  StEventSelectionMaker *sel = GetEventSelection();
+  if(sel) return sel->GetCachedMaxTowerEt();
+
   // loop over all towers
   for(int i = 0; i < nTowers; i++) {
     // get tower pointer
@@ -1606,14 +1763,8 @@ Double_t StJetFrameworkPicoBase::GetMaxTowerEt()
     int towerID = i+1;
     if(towerID < 0) continue;
 
-    // tower position - from vertex and ID: shouldn't need additional eta correction
-    TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-    //double towerPhi = towerPosition.Phi();
-    //if(towerPhi < 0.0)    towerPhi += 2.0*pi;
-    //if(towerPhi > 2.0*pi) towerPhi -= 2.0*pi;
-    double towerEta = towerPosition.PseudoRapidity();
+    // max is taken on the uncorrected energy: no tower position needed
     double towerEuncorr = tower->energy();               // uncorrected energy
-    double towEt = towerEuncorr / (1.0*TMath::CosH(towerEta)); 
 
     // get max tower
     if(towerEuncorr > fMaxTowerEt) { fMaxTowerEt = towerEuncorr; }
@@ -1622,6 +1773,18 @@ Double_t StJetFrameworkPicoBase::GetMaxTowerEt()
   return fMaxTowerEt;
 }
 //
+// Function: fill in-memory tracking efficiency table from input file
+// - all centrality x luminosity x species maps are read once, lookups don't touch the file
+// - call in Init() of the maker applying the efficiency (or of the maker for the base class)
+//____________________________________________________________________________________________
+Bool_t StJetFrameworkPicoBase::LoadTrackingEfficiency(TFile *infile)
+{
+  if(!fEfficiencyTable) fEfficiencyTable = new StTrackEfficiencyTable();
+  if(fEfficiencyTable->IsLoadedFrom(infile)) return kTRUE;
+
+  return fEfficiencyTable->Load(infile, fRunFlag);
+}
+//
 // Returns correction for tracking efficiency
 //
 //Double_t StJetFrameworkPicoBase::ApplyTrackingEffpp(StPicoTrack *trk)
@@ -1634,105 +1797,16 @@ Double_t StJetFrameworkPicoBase::ApplyTrackingEff(Bool_t applyEff, Double_t tpt,
   if(!applyEff) return trkEff;
 
   // x-variable = track pt, y-variable = track eta
-  double x = tpt;
-  double y = teta;
-  //y = TMath::Abs(teta);
-  double pi = 1.0*TMath::Pi();
-  double effBinContent = -99; // value extracted from histogram
-  const char *species =  "pion"; // FIXME
+  // pt above the flat region is clamped in the table: 4.5 GeV for Run14 AuAu, 1.8 GeV for Run12 pp
+  double effBinContent = -99; // value extracted from table
   int lumiBin = GetLuminosityBin(ZDCx);
 
-  //const int nspecies = 3;
-  //std::string species[nspecies] = {"pion", "kaon", "proton"};
-  //std::string leg_species[nspecies] = {"#pion", "K", "p"};
-  //std::string particles[nparticles] = {"piplus", "piminus", "kaonplus", "kaonminus", "proton", "antiproton"};
-  //std::string leg_particles[nparticles] = {"#pi^{+}", "#pi^{-}", "K^{+}", "K^{-}", "p", "#bar{p}"};
-  //hTrack_Efficiency_pTEta[is][ic][il] = new TH2D(Form("hTrack_%s_Efficiency_pTEta_%s_centbin%d", species[is].c_str(), lumi[il].c_str(), ic), "", 100, 0, 10, 10, -1, 1);
- 
-  // ========== AuAu Run14 ===========
-  if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200 || fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200_MB) {
-    // cut on pt: 0.2 - 30.0 GeV
-    // cut on eta: -1.0 < eta < 1.0
-    // pt is flat for AuAu above 5.0 (4.5) GeV
-    if(x > 4.5) x = 4.5;  // for pt > 4.5 use value at 4.5
-    int effBin = -99;
-    const char *histName = "";
-
-/*
-    // ============================================================================
-    if(effType == StJetFrameworkPicoBase::kHeaderArray) {
-      // efficiency function name
-      const char *funcName = Form("trackingEfficiency_%s_centbin%i_lumibin%i", species, cbin, lumiBin);
-      TString functionName = funcName; 
-
-      // setup to get efficiency from header array of values - extracted from Run14_efficiency.root
-      int bins = 50;
-      double EtaBinWidth = 0.2;
-      double PtBinWidth = 0.1;
-      int nPtBin  = 1.0*TMath::Floor(x / PtBinWidth);
-      int nEtaBin = 1.0*TMath::Floor((y+1.0) / EtaBinWidth);
-      int nBin = nPtBin + (nEtaBin * bins);
-      double effBinContent = functionName.Data()[nBin];
-    }
-    // ============================================================================
-*/
-
-    // 2-D pt/eta dependent efficiency
-    if(effType == StJetFrameworkPicoBase::kNormalPtEtaBased) {
-      // get 2D pTEta efficiency histo
-      histName = Form("hTrack_%s_Efficiency_pTEta_final_centbin%d_lumibin%d", species, cbin, lumiBin);
-      TH2F *h = static_cast<TH2F*>(infile->Get(Form("%s", histName)));
-      if(!h) cout<<"don't have requested histogram! "<<Form("%s", histName)<<endl;
-      h->SetName(Form("%s", histName));
-
-      // get efficiency 
-      effBin = h->FindBin(x, y); // pt, eta
-      effBinContent = h->GetBinContent(effBin);
-
-      // delete histo and close input file
-      delete h;
-    }
-
-    // test statement
-    //cout<<"efficiency: "<<effBinContent<<"  pt: "<<x<<"  eta: "<<y<<"   cbin: "<<cbin<<"  lumi: "<<ZDCx<<endl;
-  } // Run14 AuAu
-
-  // =========================================================================================================
-  // =========================================================================================================
-  // Run12 pp tracking efficiency:
-  if(fRunFlag == StJetFrameworkPicoBase::Run12_pp200) { // the below is probably true of all pp datasets 
-    // cut on pt: 0.2 - 30.0 GeV
-    // cut on eta: -1.0 < eta < 1.0
-    // pt is flat for pp above 2.0 (1.8) GeV 
-    if(x > 1.8) x = 1.8;  // for pt > 1.8 use value at 1.8
-
-    // some of the below is not used for the current pp parametrization
-    int effBin = -99;
-    const char *histName = "";
-
-    // 2-D pt/eta dependent efficiency
-    if(effType == StJetFrameworkPicoBase::kNormalPtEtaBased) {
-      // get 2D pTEta efficiency histo
-      histName = Form("hppRun12_PtEtaEfficiency_data_aacuts");
-
-      // changed from double to float
-      TH2F *h = static_cast<TH2F*>(infile->Get(Form("%s", histName)));
-      if(!h) cout<<"don't have requested histogram! "<<Form("%s", histName)<<endl;
-      h->SetName(Form("%s", histName));
-
-      // get efficiency 
-      effBin = h->FindBin(x, y); // pt, eta
-      effBinContent = h->GetBinContent(effBin);
-      double effBinContentErr = h->GetBinError(effBin);
-      //cout<<"effBinContent: "<<effBinContent<<"   effBinErr: "<<effBinContentErr<<endl;
-
-      // delete histo and close input file
-      delete h;
-    }
-
-    // test statement
-    //cout<<"efficiency: "<<effBinContent<<"  pt: "<<x<<"  eta: "<<y<<"  lumi: "<<ZDCx<<endl;
-  } // Run12 AuAu
+  // 2-D pt/eta dependent efficiency: in-memory table filled in Init() with LoadTrackingEfficiency(infile)
+  bool hasTable = (fRunFlag == StJetFrameworkPicoBase::Run12_pp200 || fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200 ||
+                   fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200_MB);
+  if(hasTable && effType == StJetFrameworkPicoBase::kNormalPtEtaBased && fEfficiencyTable) {
+    effBinContent = fEfficiencyTable->GetEfficiency(tpt, teta, cbin, lumiBin, StTrackEfficiencyTable::kPion);
+  }
 
   // RunFlag switch
   switch(fRunFlag) {
@@ -1933,6 +2007,41 @@ Int_t StJetFrameworkPicoBase::GetRunNo(Int_t RunFlag, Int_t runid){
   return -999;
 }
 //
+// Function: run context of run - run list index, bad run status and trigger lists
+// refilled only when the run ID changes: files are run-sorted, so the run list scans are done once per run
+// _________________________________________________________________________________
+const StRunContext *StJetFrameworkPicoBase::GetRunContext(Int_t runid, Int_t runFlag){
+  // makers pass their own run flag: one context per run flag, so makers of different datasets sharing
+  // the base maker don't refill each others context every event
+  if(runFlag < 0) runFlag = fRunFlag;
+  StRunContext *&runContext = fRunContexts[runFlag];
+  if(!runContext) runContext = new StRunContext();
+  if(runContext->IsValid(runid, runFlag)) return runContext;
+
+  // run index only for datasets with a run list
+  Int_t runNo = -999, nRuns = 0;
+  if(runFlag == StJetFrameworkPicoBase::Run12_pp200 || runFlag == StJetFrameworkPicoBase::Run14_AuAu200 ||
+     runFlag == StJetFrameworkPicoBase::Run14_AuAu200_MB || runFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
+    nRuns = GetNDataSetRuns(runFlag);
+    runNo = GetRunNo(runFlag, runid);
+  }
+
+  // bad run status - without a bad run list StRunContext::IsRunOK() fails, as IsRunOK() does
+  Bool_t hasBadRunList = !fBadRunTable.empty();
+  Bool_t runOK = hasBadRunList ? IsRunOK(runid) : kTRUE;
+
+  runContext->Set(runid, runFlag, runNo, nRuns, hasBadRunList, runOK, GetTriggerListMask(runFlag));
+  return runContext;
+}
+//
+// Function: BEMC tower geometry shared by the makers of the chain
+// created on first use - makers call SetVertex() each event, which only recomputes for a new vertex
+// _________________________________________________________________________________
+StBemcTowerGeometry *StJetFrameworkPicoBase::GetTowerGeometry(){
+  if(!fTowerGeom) fTowerGeom = new StBemcTowerGeometry();
+  return fTowerGeom;
+}
+//
 // this function returns number of 'runs' part of a dataset (RUN)
 // _________________________________________________________________________________
 Int_t StJetFrameworkPicoBase::GetNDataSetRuns(Int_t RunFlag){
@@ -2029,7 +2138,7 @@ Int_t StJetFrameworkPicoBase::GetVzRegion(double Vz) // 0-14, 15          0-19,
 // Reset bad run list object
 //____________________________________________________________________________
 void StJetFrameworkPicoBase::ResetBadRunList( ){
-  badRuns.clear();
+  fBadRunTable.clear();
 }
 //
 // Add bad runs from comma separated values file
@@ -2058,24 +2167,27 @@ Bool_t StJetFrameworkPicoBase::AddBadRuns(TString csvfile){
       std::getline( ss, entry, ',' );
       int ientry = atoi(entry.c_str());
       if(ientry) {
-        badRuns.insert( ientry );
+        fBadRunTable.push_back( ientry );
         __DEBUG(2, Form("Added bad run # %d", ientry));
       }
     }
   }
 
+  // keep table sorted and unique for binary search
+  std::sort(fBadRunTable.begin(), fBadRunTable.end());
+  fBadRunTable.erase(std::unique(fBadRunTable.begin(), fBadRunTable.end()), fBadRunTable.end());
+
   return kTRUE;
 }
 //
 // Function: check on if Run is OK or not
 //____________________________________________________________________________________________
-Bool_t StJetFrameworkPicoBase::IsRunOK( Int_t mRunId ){
-  //if( badRuns.size()==0 ){
-  if( badRuns.empty() ){
+Bool_t StJetFrameworkPicoBase::IsRunOK( Int_t mRunId ) const {
+  if( fBadRunTable.empty() ){
     __ERROR("StJetFrameworkPicoBase::IsRunOK: WARNING: You're trying to run without a bad run list. If you know what you're doing, deactivate this throw and recompile.");
     throw ( -1 );
   }
-  if( badRuns.count( mRunId )>0 ){
+  if( std::binary_search(fBadRunTable.begin(), fBadRunTable.end(), mRunId) ){
     __DEBUG(9, Form("Reject. Run ID: %d", mRunId));
     return kFALSE;
   } else {
@@ -5,6 +5,9 @@
 #include "StMaker.h"
 #include "StRoot/StPicoEvent/StPicoEvent.h"
 #include <set>
+#include <bitset>
+#include <vector>
+#include <map>
 
 // ROOT classes
 class TClonesArray;
@@ -33,6 +36,12 @@ class StRho;
 class StRhoParameter;
 class StEventPlaneMaker;
 class StCentMaker;
+class StTrackCacheMaker;
+class StTrackEtaPhiGrid;
+class StEventSelectionMaker;
+class StTrackEfficiencyTable;
+class StRunContext;
+class StBemcTowerGeometry;
 
 class StJetFrameworkPicoBase : public StMaker {
   public:
@@ -95,6 +104,14 @@ class StJetFrameworkPicoBase : public StMaker {
       external_scheme = 99
     };
 
+    // jet area type enumerator
+    enum EJetAreaType_t {
+      kActiveExplicitGhosts,   // active area, explicit ghosts generated every event (default)
+      kActiveFixedGhosts,      // active area, explicit ghosts generated once with fixed seed and reused
+      kActiveArea,             // active area, ghosts not kept in the jets
+      kVoronoiArea             // Voronoi area, no ghosts - equal to the passive area for kt jets
+    };
+
     // jet hadronic correction type enumerator
     enum EHadCorrType_t {
       kLastMatchedTrack,
@@ -142,6 +159,9 @@ class StJetFrameworkPicoBase : public StMaker {
       kRun12alt  = 9
     };
 
+    // event trigger mask bits: MB type t -> bit t, EMC trigger type t -> bit kTrigMaskHTOffset + t
+    enum { kTrigMaskMBDefault = 15, kTrigMaskHTOffset = 16, kTrigMaskHTDefault = 31 };
+
     // trigger type used to run specific part of analysis
     enum fTriggerEventTypeEnum {
       kTriggerANY = 0,
@@ -258,10 +278,13 @@ class StJetFrameworkPicoBase : public StMaker {
     void                    SetOutFileNameQA(TString QAout)           { mOutNameQA = QAout; }
     // TODO add MIXED event name
     virtual void            SetJetMakerName(const char *jn)           { fJetMakerName = jn; }
+    virtual void            SetJetArrayName(const char *jan)          { fJetArrayName = jan; } // jet array of the jet maker, empty: primary array
     virtual void            SetJetBGMakerName(const char *bjn)        { fJetBGMakerName = bjn; }
     virtual void            SetRhoMakerName(const char *rn)           { fRhoMakerName = rn; }
     virtual void            SetRhoSparseMakerName(const char *rpn)    { fRhoSparseMakerName = rpn; }
     virtual void            SetEventPlaneMakerName(const char *epn)   { fEventPlaneMakerName = epn; }
+    virtual void            SetTrackCacheMakerName(const char *tcn)   { fTrackCacheMakerName = tcn; }
+    virtual void            SetEventSelectionMakerName(const char *esn) { fEventSelectionMakerName = esn; }
 
     // add-to histogram name
     virtual void            AddToHistogramsName(TString add)           { fAddToHistogramsName = add  ; }
@@ -272,28 +295,38 @@ class StJetFrameworkPicoBase : public StMaker {
     void                    ResetDeadTowerList( );
     Bool_t                  AddBadTowers(TString csvfile);
     Bool_t                  AddDeadTowers(TString csvfile);
-    Bool_t                  IsTowerOK( Int_t mTowId );
-    Bool_t                  IsTowerDead( Int_t mTowId );
+    Bool_t                  IsTowerOK( Int_t mTowId ) const;
+    Bool_t                  IsTowerDead( Int_t mTowId ) const;
 
     // bad run list 
     void                    ResetBadRunList( );
     Bool_t                  AddBadRuns(TString csvfile);
-    Bool_t                  IsRunOK( Int_t mRunId );
+    Bool_t                  IsRunOK( Int_t mRunId ) const;
 
-    // return setup object for use in other classes
-    std::set<Int_t>         GetBadTowers()                   { return badTowers          ; }
-    std::set<Int_t>         GetDeadTowers()                  { return deadTowers         ; }
-    std::set<Int_t>         GetBadRuns()                     { return badRuns            ; }
+    // tower status: one bit per tower ID (1 - 4800), run status: sorted bad run IDs - filled at Init, shared by reference
+    enum { kNTowerStatusBits = 4801 };
+    typedef std::bitset<kNTowerStatusBits> TowerStatusBits_t;
+    const TowerStatusBits_t  &GetBadTowerBits() const        { return fBadTowerBits      ; }
+    const TowerStatusBits_t  &GetDeadTowerBits() const       { return fDeadTowerBits     ; }
+    const std::vector<Int_t> &GetBadRunTable() const         { return fBadRunTable       ; }
 
     Bool_t                  SelectAnalysisCentralityBin(Int_t centbin, Int_t fCentralitySelectionCut); // centrality bin to cut on for analysis
     Bool_t                  DoComparison(int myarr[], int elems);
     Bool_t                  CheckForMB(Int_t RunFlag, Int_t type);
     Bool_t                  CheckForHT(Int_t RunFlag, Int_t type);
+    UInt_t                  GetTriggerMask(Int_t RunFlag);  // MB/HT trigger bits of current event, compiled once per event
+    static UInt_t           GetTriggerListMask(Int_t RunFlag); // trigger mask bits with own trigger list for run flag
+    static Bool_t           HasMBTrigger(UInt_t mask, Int_t type);
+    static Bool_t           HasHTTrigger(UInt_t mask, Int_t type);
 
     // functions
     Double_t                ApplyTrackingEff(Bool_t applyEff, Double_t tpt, Double_t teta, Int_t cbin, Double_t ZDCx, Int_t effType, TFile *infile); // single-track reconstruction efficiency 
+    Bool_t                  LoadTrackingEfficiency(TFile *infile);  // fill in-memory efficiency table from file
+    StTrackEfficiencyTable *GetTrackingEfficiencyTable() const { return fEfficiencyTable; }
     Int_t                   GetRunNo(Int_t RunFlag, Int_t runid);
+    const StRunContext     *GetRunContext(Int_t runid, Int_t runFlag = -1);  // per-run quantities of a dataset (default: this makers run flag), refilled only when the run changes
     Int_t                   GetNDataSetRuns(Int_t RunFlag);
+    StBemcTowerGeometry    *GetTowerGeometry();  // BEMC tower geometry shared by all makers of the chain, vertex set once per event
 
   protected:
     TH1                    *FillEventTriggerQA(TH1 *h);               // filled event trigger QA plots
@@ -304,6 +337,13 @@ class StJetFrameworkPicoBase : public StMaker {
     Double_t                RelativeEPJET(Double_t jetAng, Double_t EPAng) const;         // relative jet event plane angle
     Bool_t                  AcceptJet(StJet *jet);                                   // jets accept cuts function
     Bool_t                  AcceptTrack(StPicoTrack *trk, Float_t B, TVector3 Vert); // track accept cuts function
+    Bool_t                  AcceptTrack(StPicoTrack *trk, Float_t B, TVector3 Vert, Double_t ptMin, Double_t ptMax); // track accept cuts function - given pt range
+    Bool_t                  AcceptTrack(StTrackCacheMaker *cache, Int_t itrk);        // track accept cuts function - cached track
+    StTrackCacheMaker      *GetTrackCache();                                         // shared track cache, 0x0 if not valid for this event
+    StTrackEtaPhiGrid      *GetTrackGrid();                                          // eta-phi grid of accepted tracks, filled once per event
+    StEventSelectionMaker  *GetEventSelection();                                     // shared event selection, 0x0 if not valid for this event
+    StEventPlaneMaker      *GetEventPlaneMaker(TString fEPMakerNametemp, Int_t ptbin); // event plane maker providing pt assoc bin
+    TClonesArray           *GetJetArray(StJetMakerTask *jetMaker) const;            // selected jet array of a jet maker
     //Bool_t                  AcceptTower(StPicoBTowHit *tower, TVector3 Vertex, Int_t towerID);     // tower accept cuts function
     Double_t                GetReactionPlane(); // get reaction plane angle
     Int_t                   EventCounter();     // when called, provides Event #
@@ -320,6 +360,9 @@ class StJetFrameworkPicoBase : public StMaker {
     Int_t                   GetZVertex4cmBin(Double_t zvertex) const;
 
 
+    // event plane shift (flattening) correction summed over harmonics 1..nHarm (nHarm <= kMaxShiftHarmonics)
+    enum { kMaxShiftHarmonics = 20 };
+    static Double_t         ShiftCorrection(Double_t psi, const Double_t *cosCoef, const Double_t *sinCoef, Int_t nHarm = kMaxShiftHarmonics, Int_t order = 2);
     static Double_t        *GenerateFixedBinArray(Int_t n, Double_t min, Double_t max);
     static void             GenerateFixedBinArray(Int_t n, Double_t min, Double_t max, Double_t *array);
 
@@ -404,6 +447,21 @@ class StJetFrameworkPicoBase : public StMaker {
     StRho                  *RhoMaker2; // for thomas, multiple jet collections
     StEventPlaneMaker      *EventPlaneMaker;
     StCentMaker            *mCentMaker;
+    StTrackCacheMaker      *mTrackCache;
+
+    // eta-phi grid of accepted tracks for cone queries and query result buffers
+    StTrackEtaPhiGrid      *fTrackGrid;//!
+    std::vector<Int_t>      fGridEntries;//!
+    std::vector<Double_t>   fGridDeltaR;//!
+
+    // tracking efficiency maps, loaded once from efficiency file
+    StTrackEfficiencyTable *fEfficiencyTable;
+
+    // run context of current run, one per run flag
+    std::map<Int_t, StRunContext*> fRunContexts;//!
+
+    // BEMC tower geometry, owned here and handed out to the jet and QA makers
+    StBemcTowerGeometry    *fTowerGeom;//!
 
     // position object
     StEmcPosition2         *mEmcPosition;
@@ -420,10 +478,13 @@ class StJetFrameworkPicoBase : public StMaker {
 
     // maker names
     TString                 fJetMakerName;
+    TString                 fJetArrayName;
     TString                 fJetBGMakerName;
     TString                 fRhoMakerName;
     TString                 fRhoSparseMakerName;
     TString                 fEventPlaneMakerName;
+    TString                 fTrackCacheMakerName;
+    TString                 fEventSelectionMakerName;
 
     // Rho objects
     StRhoParameter         *GetRhoFromEvent(const char *name);
@@ -447,14 +508,16 @@ class StJetFrameworkPicoBase : public StMaker {
     Int_t GetInputEventCounter() { return mInputEventCounter;}
 
   private:
-    // bad and dead tower list functions and arrays
-    std::set<Int_t>        badTowers;
-    std::set<Int_t>        deadTowers;
+    // bad and dead tower status bits, kTRUE once a list was read (the empty lists hold an out of range ID)
+    TowerStatusBits_t      fBadTowerBits;//!
+    TowerStatusBits_t      fDeadTowerBits;//!
+    Bool_t                 fHaveBadTowerList;//!
+    Bool_t                 fHaveDeadTowerList;//!
 
-    // bad run list 
-    std::set<Int_t>        badRuns;
+    // bad run list, sorted
+    std::vector<Int_t>     fBadRunTable;//!
 
-    ClassDef(StJetFrameworkPicoBase, 2)
+    ClassDef(StJetFrameworkPicoBase, 3)
 };
 
 /**
@@ -0,0 +1,88 @@
+//******************************************************************************
+//
+// StJetInput.cxx
+//
+// Authors: Joel Mazer
+//
+// Jet finder input of one event, shared between jet makers with the same cuts
+//
+//******************************************************************************
+
+#include "StJetInput.h"
+
+ClassImp(StJetInput)
+
+//_______________________________________________________________________________________________
+StJetInputCuts::StJetInputCuts() :
+  fJetType(-1),
+  fUsePrimTracks(kFALSE),
+  fMinJetTrackPt(0.), fMaxJetTrackPt(0.),
+  fJetTrackEtaMin(0.), fJetTrackEtaMax(0.),
+  fJetTrackPhiMin(0.), fJetTrackPhiMax(0.),
+  fJetTrackDCAcut(0.),
+  fJetTracknHitsFit(0),
+  fJetTracknHitsRatio(0.),
+  fTrackEtaMin(0.), fTrackEtaMax(0.),
+  fTrackPhiMin(0.), fTrackPhiMax(0.),
+  fJetTowerEtaMin(0.), fJetTowerEtaMax(0.),
+  fJetTowerPhiMin(0.), fJetTowerPhiMax(0.),
+  fTowerEnergyMin(0.),
+  fHadronicCorrFrac(0.),
+  fJetHadCorrType(-1),
+  fDoEffCorr(kFALSE),
+  fCorrectTracksforEff(kFALSE),
+  fTrackEfficiencyType(-1)
+{
+}
+//
+// Function: all cuts equal
+//_______________________________________________________________________________________________
+Bool_t StJetInputCuts::operator==(const StJetInputCuts &c) const
+{
+  return (fJetType == c.fJetType && fUsePrimTracks == c.fUsePrimTracks &&
+          fMinJetTrackPt == c.fMinJetTrackPt && fMaxJetTrackPt == c.fMaxJetTrackPt &&
+          fJetTrackEtaMin == c.fJetTrackEtaMin && fJetTrackEtaMax == c.fJetTrackEtaMax &&
+          fJetTrackPhiMin == c.fJetTrackPhiMin && fJetTrackPhiMax == c.fJetTrackPhiMax &&
+          fJetTrackDCAcut == c.fJetTrackDCAcut && fJetTracknHitsFit == c.fJetTracknHitsFit &&
+          fJetTracknHitsRatio == c.fJetTracknHitsRatio &&
+          fTrackEtaMin == c.fTrackEtaMin && fTrackEtaMax == c.fTrackEtaMax &&
+          fTrackPhiMin == c.fTrackPhiMin && fTrackPhiMax == c.fTrackPhiMax &&
+          fJetTowerEtaMin == c.fJetTowerEtaMin && fJetTowerEtaMax == c.fJetTowerEtaMax &&
+          fJetTowerPhiMin == c.fJetTowerPhiMin && fJetTowerPhiMax == c.fJetTowerPhiMax &&
+          fTowerEnergyMin == c.fTowerEnergyMin &&
+          fHadronicCorrFrac == c.fHadronicCorrFrac && fJetHadCorrType == c.fJetHadCorrType &&
+          fDoEffCorr == c.fDoEffCorr && fCorrectTracksforEff == c.fCorrectTracksforEff &&
+          fTrackEfficiencyType == c.fTrackEfficiencyType);
+}
+//_______________________________________________________________________________________________
+StJetInput::StJetInput() : TObject(),
+  fRunId(-99),
+  fEventId(-99),
+  fCuts(),
+  fTowerMatchMap(0x0)
+{
+  fVectors.reserve(2000);
+}
+//_______________________________________________________________________________________________
+StJetInput::~StJetInput()
+{
+}
+//
+// Function: start input of a new event
+//_______________________________________________________________________________________________
+void StJetInput::Reset(Int_t runId, Int_t eventId, const StJetInputCuts &cuts)
+{
+  fRunId = runId;
+  fEventId = eventId;
+  fCuts = cuts;
+  fTowerMatchMap = 0x0;
+  fVectors.clear();
+}
+//
+// Function: add input four-vector with user index
+//_______________________________________________________________________________________________
+void StJetInput::Add(Double_t px, Double_t py, Double_t pz, Double_t E, Int_t uid)
+{
+  fVectors.push_back(fastjet::PseudoJet(px, py, pz, E));
+  fVectors.back().set_user_index(uid);
+}
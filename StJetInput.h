@@ -0,0 +1,93 @@
+//******************************************************************************
+//
+// StJetInput.h
+//
+// Authors: Joel Mazer
+//
+// Jet finder input of one event: the prepared track and (hadronically corrected)
+// tower four-vectors with their user index (tracks 0+, ghosts = -1, towers < -1),
+// together with the cuts they were prepared with. A jet maker preparing the input
+// publishes it, other jet makers running on the same event with the same cuts
+// cluster it (StFJWrapper::AddInputVectors) instead of looping over tracks and
+// towers again
+//
+//******************************************************************************
+
+#ifndef StJetInput_H
+#define StJetInput_H
+
+// ROOT includes
+#include "TObject.h"
+#include <vector>
+
+// FastJet includes
+#include "FJ_includes.h"
+
+class StTowerMatchMap;
+
+// cuts the input vectors depend on - input is only shared between makers with equal cuts
+struct StJetInputCuts
+{
+  StJetInputCuts();
+  Bool_t operator==(const StJetInputCuts &c) const;
+  Bool_t operator!=(const StJetInputCuts &c) const   { return !(*this == c); }
+
+  Int_t             fJetType;                     // full, charged, neutral
+  Bool_t            fUsePrimTracks;               // primary or global tracks
+  Double_t          fMinJetTrackPt;               // jet track cuts
+  Double_t          fMaxJetTrackPt;
+  Double_t          fJetTrackEtaMin;
+  Double_t          fJetTrackEtaMax;
+  Double_t          fJetTrackPhiMin;
+  Double_t          fJetTrackPhiMax;
+  Double_t          fJetTrackDCAcut;
+  Int_t             fJetTracknHitsFit;
+  Double_t          fJetTracknHitsRatio;
+  Double_t          fTrackEtaMin;                 // cuts on tracks matched to towers
+  Double_t          fTrackEtaMax;
+  Double_t          fTrackPhiMin;
+  Double_t          fTrackPhiMax;
+  Double_t          fJetTowerEtaMin;              // jet tower cuts
+  Double_t          fJetTowerEtaMax;
+  Double_t          fJetTowerPhiMin;
+  Double_t          fJetTowerPhiMax;
+  Double_t          fTowerEnergyMin;
+  Double_t          fHadronicCorrFrac;            // hadronic correction
+  Int_t             fJetHadCorrType;
+  Bool_t            fDoEffCorr;                   // tracking efficiency correction
+  Bool_t            fCorrectTracksforEff;
+  Int_t             fTrackEfficiencyType;
+};
+
+class StJetInput : public TObject
+{
+   public:
+             StJetInput();
+    virtual  ~StJetInput();
+
+    // per event: Reset(), Add() for each track and tower - memory stays allocated
+    void              Reset(Int_t runId, Int_t eventId, const StJetInputCuts &cuts);
+    void              Add(Double_t px, Double_t py, Double_t pz, Double_t E, Int_t uid);
+
+    // track-tower matches used for the hadronic correction, owned by the preparing maker
+    void              SetTowerMatchMap(const StTowerMatchMap *m)    { fTowerMatchMap = m; }
+    const StTowerMatchMap *GetTowerMatchMap() const                 { return fTowerMatchMap; }
+
+    // input can be used for this event and these cuts
+    Bool_t            IsCurrent(Int_t runId, Int_t eventId) const   { return (fRunId == runId && fEventId == eventId); }
+    Bool_t            IsCompatible(const StJetInputCuts &cuts) const { return (fCuts == cuts); }
+
+    const std::vector<fastjet::PseudoJet> &GetVectors() const       { return fVectors; }
+    Int_t             GetNVectors() const                           { return (Int_t)fVectors.size(); }
+    const StJetInputCuts &GetCuts() const                           { return fCuts; }
+
+   private:
+    Int_t             fRunId;                       // run ID of event the input was prepared for
+    Int_t             fEventId;                     // event ID of event the input was prepared for
+    StJetInputCuts    fCuts;                        //! cuts the input was prepared with
+    const StTowerMatchMap *fTowerMatchMap;          //! track-tower matches of the preparing maker
+    std::vector<fastjet::PseudoJet> fVectors;       //! input four-vectors with user index
+
+    ClassDef(StJetInput, 1)
+};
+#endif
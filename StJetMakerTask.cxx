@@ -43,12 +43,17 @@
 // for towers
 #include "StEmcUtil/geometry/StEmcGeom.h"
 #include "StEmcPosition2.h"
+#include "StBemcTowerGeometry.h"
+#include "StTowerMatchMap.h"
 class StEmcPosition2;
 
 // jet class and fastjet wrapper and dataset (Run#'s) 
 #include "StJet.h"
 #include "StFJWrapper.h"
 #include "StJetFrameworkPicoBase.h"
+#include "StJetUtility.h"
+#include "StRunContext.h"
+#include "StEventSelectionMaker.h"
 #include "runlistP12id.h" // Run12 pp
 #include "runlistP16ij.h"
 #include "runlistRun14AuAu_P18ih.h" // new Run14 AuAu
@@ -57,6 +62,9 @@ class StEmcPosition2;
 // centrality includes
 #include "StCentMaker.h"
 
+// shared track cache
+#include "StTrackCacheMaker.h"
+
 // extra includes
 #include "StJetPicoDefinitions.h"
 
@@ -104,16 +112,22 @@ StJetMakerTask::StJetMakerTask() :
   fTracksName(""),
   fCaloName(""),
   fJetsName(""),
+  fJetInputMakerName(""),
+  fEventSelectionMakerName("EventSelectionMaker"),
+  fTrackCacheMakerName("TrackCacheMaker"),
   fJetAlgo(1), 
   fJetType(0), 
   fRecombScheme(fastjet::BIpt2_scheme), // was BIpt_scheme
   fjw("StJetMakerTask", "StJetMakerTask"),
+  fNJetConfigs(0),
+  fFillJetQA(kTRUE),
   fRadius(0.4),
   fMinJetArea(0.001),
   fMinJetPt(1.0),
   fJetPhiMin(-10.), fJetPhiMax(+10.),
   fJetEtaMin(-0.6), fJetEtaMax(0.6),
   fGhostArea(0.005), 
+  fJetAreaType(StJetFrameworkPicoBase::kActiveExplicitGhosts),
   fMinJetTrackPt(0.2), fMaxJetTrackPt(30.0),
   fMinJetClusPt(0.15),
   fMinJetClusE(0.2),
@@ -132,6 +146,7 @@ StJetMakerTask::StJetMakerTask() :
   mTowerEnergyMin(0.2),
   mHadronicCorrFrac(1.),
   fJetHadCorrType(StJetFrameworkPicoBase::kAllMatchedTracks), // default is using all matched Tracks, Aug2019, per Hanseul
+  fUtilities(0x0),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
   fJets(0x0),
@@ -144,7 +159,13 @@ StJetMakerTask::StJetMakerTask() :
   mPicoEvent(0x0),
   mCentMaker(0x0),
   mBaseMaker(0x0),
+  mTrackCache(0x0),
   mEmcPosition(0x0),
+  mTowerGeom(0x0),
+  mTowerMatchMap(0x0),
+  fJetInput(0x0),
+  fConstituentTable(0x0),
+  mInputMatchMap(0x0),
   grefmultCorr(0x0),
   fEfficiencyInputFile(0x0)
 {
@@ -155,11 +176,14 @@ StJetMakerTask::StJetMakerTask() :
     fTowerToTriggerTypeHT1[i] = kFALSE;
     fTowerToTriggerTypeHT2[i] = kFALSE;
     fTowerToTriggerTypeHT3[i] = kFALSE; 
-
-    for(int j = 0; j < 7; j++) mTowerMatchTrkIndex[i][j] = -1;
-    mTowerStatusArr[i] = 0;
   }
 
+  for(int i=0; i<kMaxJetConfigs; i++) {
+    fJetConfigAlgo[i] = -1;
+    fJetConfigRadius[i] = 0.0;
+    fjwConfig[i] = 0x0;
+    fJetsConfig[i] = 0x0;
+  }
 }
 
 //________________________________________________________________________
@@ -195,16 +219,22 @@ StJetMakerTask::StJetMakerTask(const char *name, double mintrackPt = 0.20, bool
   fTracksName("Tracks"),
   fCaloName("Towers"),
   fJetsName("Jets"),
+  fJetInputMakerName(""),
+  fEventSelectionMakerName("EventSelectionMaker"),
+  fTrackCacheMakerName("TrackCacheMaker"),
   fJetAlgo(1), 
   fJetType(0),
   fRecombScheme(fastjet::BIpt2_scheme), // was BIpt2_scheme
   fjw(name, name),
+  fNJetConfigs(0),
+  fFillJetQA(kTRUE),
   fRadius(0.4),
   fMinJetArea(0.001),
   fMinJetPt(1.0),
   fJetPhiMin(-10), fJetPhiMax(+10),
   fJetEtaMin(-0.6), fJetEtaMax(0.6),
   fGhostArea(0.005),
+  fJetAreaType(StJetFrameworkPicoBase::kActiveExplicitGhosts),
   fMinJetTrackPt(mintrackPt),
   fMaxJetTrackPt(30.0), 
   fMinJetClusPt(0.15),
@@ -224,6 +254,7 @@ StJetMakerTask::StJetMakerTask(const char *name, double mintrackPt = 0.20, bool
   mTowerEnergyMin(0.2),
   mHadronicCorrFrac(1.),
   fJetHadCorrType(StJetFrameworkPicoBase::kAllMatchedTracks), // default is using all matched Tracks, Aug2019, per Hanseul
+  fUtilities(0x0),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
   fJets(0x0),
@@ -236,7 +267,13 @@ StJetMakerTask::StJetMakerTask(const char *name, double mintrackPt = 0.20, bool
   mPicoEvent(0x0),
   mCentMaker(0x0),
   mBaseMaker(0x0),
+  mTrackCache(0x0),
   mEmcPosition(0x0),
+  mTowerGeom(0x0),
+  mTowerMatchMap(0x0),
+  fJetInput(0x0),
+  fConstituentTable(0x0),
+  mInputMatchMap(0x0),
   grefmultCorr(0x0),
   fEfficiencyInputFile(0x0)
 {
@@ -247,9 +284,13 @@ StJetMakerTask::StJetMakerTask(const char *name, double mintrackPt = 0.20, bool
     fTowerToTriggerTypeHT1[i] = kFALSE;
     fTowerToTriggerTypeHT2[i] = kFALSE;
     fTowerToTriggerTypeHT3[i] = kFALSE;
+  }
 
-    for(int j = 0; j < 7; j++) mTowerMatchTrkIndex[i][j] = -1;
-    mTowerStatusArr[i] = 0;
+  for(int i=0; i<kMaxJetConfigs; i++) {
+    fJetConfigAlgo[i] = -1;
+    fJetConfigRadius[i] = 0.0;
+    fjwConfig[i] = 0x0;
+    fJetsConfig[i] = 0x0;
   }
 
   if (!name) return;
@@ -261,6 +302,11 @@ StJetMakerTask::~StJetMakerTask()
 {
   // Destructor
   //fJets->Clear(); delete fJets;
+  for(int i = 0; i < fNJetConfigs; i++) {
+    if(fjwConfig[i])           delete fjwConfig[i];
+    if(fJetsConfig[i])         delete fJetsConfig[i];
+  }
+
   if(fHistMultiplicity)        delete fHistMultiplicity;
   if(fHistRawMult)             delete fHistRawMult;
   if(fHistCentrality)          delete fHistCentrality;
@@ -325,6 +371,10 @@ StJetMakerTask::~StJetMakerTask()
   if(fHistQATowIDvsPhi)        delete fHistQATowIDvsPhi;
 
   if(mEmcPosition)             delete mEmcPosition;
+  if(mTowerMatchMap)           delete mTowerMatchMap;
+  if(fJetInput)                delete fJetInput;
+  if(fConstituentTable)        delete fConstituentTable;
+  if(fUtilities)               delete fUtilities;
 
   // track reconstruction efficiency input file
   if(fEfficiencyInputFile) {
@@ -348,6 +398,15 @@ Int_t StJetMakerTask::Init() {
   // position object for Emc
   mEmcPosition = new StEmcPosition2();
 
+  // track-tower match map - filled per event for the hadronic correction
+  mTowerMatchMap = new StTowerMatchMap();
+
+  // jet input vectors - filled per event, can be clustered by other jet makers
+  fJetInput = new StJetInput();
+
+  // jet constituent table - filled per event, jets keep index spans into it
+  fConstituentTable = new StJetConstituentTable();
+
   // input file - for tracking efficiency: Run14 AuAu and Run12 pp
   const char *input = "";
 //if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) input=Form("./StRoot/StMyAnalysisMaker/Run14_AuAu_200_tracking_efficiency_and_momentum_smearing_dca_3p0_nhit_15_nhitfrac_0p52.root");
@@ -357,9 +416,44 @@ Int_t StJetMakerTask::Init() {
   if(fDoEffCorr) {
     fEfficiencyInputFile = new TFile(input, "READ");
     if(!fEfficiencyInputFile) cout<<Form("do not have input file: %s", input);
+
+    // efficiency is applied by the base maker: read all its maps into memory once - no file access per track
+    StJetFrameworkPicoBase *baseMaker = static_cast<StJetFrameworkPicoBase*>(GetMaker("baseClassMaker"));
+    if(baseMaker) baseMaker->LoadTrackingEfficiency(fEfficiencyInputFile);
+    else LOG_WARN << " No baseMaker! Tracking efficiency not loaded! " << endm;
   }
 
   // ============================ set jet parameters for fastjet wrapper  =======================
+  InitJetWrapper(fjw, fJetAlgo, fRadius);
+
+  // additional jet definitions: own wrapper and jet array, named by jet type, algorithm, radius and scheme
+  for(int i = 0; i < fNJetConfigs; i++) {
+    fJetConfigName[i] = StJetFrameworkPicoBase::GenerateJetName((StJetFrameworkPicoBase::EJetType_t)fJetType,
+        (StJetFrameworkPicoBase::EJetAlgo_t)fJetConfigAlgo[i], (StJetFrameworkPicoBase::ERecoScheme_t)fRecombScheme,
+        fJetConfigRadius[i], 0x0, 0x0, fJetsName);
+    fjwConfig[i] = new StFJWrapper(fJetConfigName[i].Data(), fJetConfigName[i].Data());
+    InitJetWrapper(*fjwConfig[i], fJetConfigAlgo[i], fJetConfigRadius[i]);
+    fJetsConfig[i] = new TClonesArray("StJet");
+    fJetsConfig[i]->SetName(fJetConfigName[i]);
+  }
+
+  // ghost-area specifications
+  double ghost_maxrap = 1.2;
+  fastjet::GhostedAreaSpec   area_spec(ghost_maxrap);
+  fastjet::AreaDefinition    area_def(fastjet::active_area_explicit_ghosts, area_spec);
+
+  // setting legacy mode
+  //if(fLegacyMode) { fjw.SetLegacyMode(kTRUE); }
+
+  // jet utilities - run on the jets of the main jet definition
+  InitUtilities();
+
+  return kStOK;
+}
+//
+// Function: set jet definition of a fastjet wrapper - recombination scheme and ghost area are common
+//_______________________________________________________________________________________
+void StJetMakerTask::InitJetWrapper(StFJWrapper &wrapper, Int_t algo, Double_t radius) {
   // recombination schemes:
   // E_scheme, pt_scheme, pt2_scheme, Et_scheme, Et2_scheme, BIpt_scheme, BIpt2_scheme, WTA_pt_scheme, WTA_modp_scheme
   fastjet::RecombinationScheme    recombScheme;
@@ -376,35 +470,57 @@ Int_t StJetMakerTask::Init() {
 
   // jet algorithm
   fastjet::JetAlgorithm          algorithm;
-  if (fJetAlgo == 1)      algorithm = fastjet::antikt_algorithm;
-  if (fJetAlgo == 0)      algorithm = fastjet::kt_algorithm;
+  if (algo == 1)      algorithm = fastjet::antikt_algorithm;
+  if (algo == 0)      algorithm = fastjet::kt_algorithm;
   // extra algorithms
-  if (fJetAlgo == 2)      algorithm = fastjet::cambridge_algorithm;
-  if (fJetAlgo == 3)      algorithm = fastjet::genkt_algorithm;
-  if (fJetAlgo == 11)     algorithm = fastjet::cambridge_for_passive_algorithm;
-  if (fJetAlgo == 13)     algorithm = fastjet::genkt_for_passive_algorithm;
-  if (fJetAlgo == 99)     algorithm = fastjet::plugin_algorithm;
-  if (fJetAlgo == 999)    algorithm = fastjet::undefined_jet_algorithm;
+  if (algo == 2)      algorithm = fastjet::cambridge_algorithm;
+  if (algo == 3)      algorithm = fastjet::genkt_algorithm;
+  if (algo == 11)     algorithm = fastjet::cambridge_for_passive_algorithm;
+  if (algo == 13)     algorithm = fastjet::genkt_for_passive_algorithm;
+  if (algo == 99)     algorithm = fastjet::plugin_algorithm;
+  if (algo == 999)    algorithm = fastjet::undefined_jet_algorithm;
   fastjet::Strategy               strategy = fastjet::Best;
 
+  // jet area type: Voronoi and active without explicit ghosts are faster when the area is only used for rho
+  fastjet::AreaType               areaType = fastjet::active_area_explicit_ghosts;
+  if (fJetAreaType == StJetFrameworkPicoBase::kActiveArea)   areaType = fastjet::active_area;
+  if (fJetAreaType == StJetFrameworkPicoBase::kVoronoiArea)  areaType = fastjet::voronoi_area;
+
   // setup fj wrapper
-  fjw.SetAreaType(fastjet::active_area_explicit_ghosts);
-  fjw.SetStrategy(strategy);
-  fjw.SetGhostArea(fGhostArea);
-  fjw.SetR(fRadius);
-  fjw.SetAlgorithm(algorithm);        //fJetAlgo);
-  fjw.SetRecombScheme(recombScheme);  //fRecombScheme);
-  fjw.SetMaxRap(1.2);
+  wrapper.SetAreaType(areaType);
+  wrapper.SetUseFixedGhosts(fJetAreaType == StJetFrameworkPicoBase::kActiveFixedGhosts);
+  wrapper.SetStrategy(strategy);
+  wrapper.SetGhostArea(fGhostArea);
+  wrapper.SetR(radius);
+  wrapper.SetAlgorithm(algorithm);        //fJetAlgo);
+  wrapper.SetRecombScheme(recombScheme);  //fRecombScheme);
+  wrapper.SetMaxRap(1.2);
+}
+//
+// Function: add a jet definition clustered from the same input as the main one
+// returns its index, -1 if it can't be added (after Init or too many)
+//_______________________________________________________________________________________
+Int_t StJetMakerTask::AddJetConfig(Double_t radius, Int_t algo) {
+  if(fJets || fNJetConfigs >= kMaxJetConfigs) {
+    LOG_WARN << Form("StJetMakerTask::AddJetConfig: can't add R = %.2f to %s (after Init or more than %d)", radius, GetName(), kMaxJetConfigs) << endm;
+    return -1;
+  }
 
-  // ghost-area specifications
-  double ghost_maxrap = 1.2;
-  fastjet::GhostedAreaSpec   area_spec(ghost_maxrap);
-  fastjet::AreaDefinition    area_def(fastjet::active_area_explicit_ghosts, area_spec);
+  fJetConfigRadius[fNJetConfigs] = radius;
+  fJetConfigAlgo[fNJetConfigs] = (algo < 0) ? fJetAlgo : algo;
 
-  // setting legacy mode
-  //if(fLegacyMode) { fjw.SetLegacyMode(kTRUE); }
+  return fNJetConfigs++;
+}
+//
+// Function: jet array by name - main array (SetJetsName) or additional jet definition (GetJetConfigName)
+//_______________________________________________________________________________________
+TClonesArray *StJetMakerTask::GetJets(const char *name) {
+  if(fJetsName == name) return fJets;
+  for(int i = 0; i < fNJetConfigs; i++) {
+    if(fJetConfigName[i] == name) return fJetsConfig[i];
+  }
 
-  return kStOK;
+  return 0x0;
 }
 //
 //
@@ -614,6 +730,7 @@ void StJetMakerTask::WriteHadCorrQAHistograms() {
 void StJetMakerTask::Clear(Option_t *opt) {
   fJets->Clear();
   fJetsBGsub->Clear();
+  for(int i = 0; i < fNJetConfigs; i++) fJetsConfig[i]->Clear();
 }
 //
 // Function: main loop, called for each event
@@ -626,12 +743,10 @@ int StJetMakerTask::Make()
   // ZERO's out the jet array
   fJets->Delete();
   fJetsBGsub->Delete();
+  for(int i = 0; i < fNJetConfigs; i++) fJetsConfig[i]->Delete();
 
-  // ZERO these out for double checking they aren't set
-  for(int i = 0; i < 4800; i++) {
-    for(int j = 0; j < 7; j++) mTowerMatchTrkIndex[i][j] = -1;
-    mTowerStatusArr[i] = 0;
-  }
+  // reset track-tower matches - only towers matched in the last event are touched
+  mTowerMatchMap->Clear();
 
   // get PicoDstMaker 
   mPicoDstMaker = static_cast<StPicoDstMaker*>(GetMaker("picoDst"));
@@ -661,17 +776,19 @@ int StJetMakerTask::Make()
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-  deadTowers = mBaseMaker->GetDeadTowers();
-  badTowers = mBaseMaker->GetBadTowers();
+  // tower positions - geometry is owned by the base maker and shared, vertex-corrected arrays are filled per event
+  mTowerGeom = mBaseMaker->GetTowerGeometry();
 
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
+  // get shared track cache - only use when filled for this event with the same track type
+  mTrackCache = GetTrackCache();
+
   // cut event on max track pt > 30.0 GeV
   if(GetMaxTrackPt() > fMaxEventTrackPt) return kStOK;
 
@@ -688,6 +805,9 @@ int StJetMakerTask::Make()
   // Z-vertex cut - - per the Aj analysis (-40, 40)
   if((zVtx < fEventZVtxMinCut) || (zVtx > fEventZVtxMaxCut)) return kStOk;
 
+  // tower eta, phi, 1/cosh(eta) and direction for this vertex - one pass over all towers
+  mTowerGeom->SetVertex(mVertex);
+
   // ============================ CENTRALITY ============================== //
   // get CentMaker pointer
   mCentMaker = static_cast<StCentMaker*>(GetMaker("CentMaker"));
@@ -728,10 +848,11 @@ int StJetMakerTask::Make()
   // check for MB and HT triggers - Type Flag corresponds to selected type of MB or EMC
   // NEED to ADD new triggers and runs to StJetFrameworkPicoBase class !!
   // different access method because this class doesn't inherit from base
-  bool fHaveMBevent    = mBaseMaker->CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event   = mBaseMaker->CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event  = mBaseMaker->CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-  bool fHaveEmcTrigger = mBaseMaker->CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = mBaseMaker->GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent    = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event   = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event  = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  bool fHaveEmcTrigger = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, fEmcTriggerEventType);
   bool fHaveAnyEvent   = kTRUE;
 
   // fill trigger array
@@ -749,8 +870,8 @@ int StJetMakerTask::Make()
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if(doppAnalysis)  fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;                    // pp analysis
   if(!doppAnalysis) fRunForMB = (fHaveMB5event || fHaveMB30event) ? kTRUE : kFALSE; // NON-pp analysis
-  bool fHaveHT2   = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT2);  // HT2
-  bool fHaveHT3   = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT3);  // HT3
+  bool fHaveHT2   = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT2);  // HT2
+  bool fHaveHT3   = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT3);  // HT3
   bool fHaveMB30HT2HT3 = (fHaveMB30event || fHaveHT2 || fHaveHT3) ? kTRUE : kFALSE;
   bool fHaveMBHT2HT3 = (doppAnalysis && (fRunForMB || fHaveHT2 || fHaveHT3)) ? kTRUE : kFALSE;
 
@@ -765,6 +886,11 @@ int StJetMakerTask::Make()
   if(!doConstituentSubtr) FillJetBranch();
   if( doConstituentSubtr) FillJetBGBranch();
 
+  // additional jet definitions - jet QA histograms are for the main jet definition only
+  fFillJetQA = kFALSE;
+  for(int i = 0; i < fNJetConfigs; i++) FillJetBranch(*fjwConfig[i], fJetsConfig[i], fJetConfigRadius[i]);
+  fFillJetQA = kTRUE;
+
   return kStOK;
 }
 //
@@ -785,6 +911,115 @@ void StJetMakerTask::FindJets()
   fjw.Clear();
   fFull_Event.clear();
 
+  // input vectors of the input maker if prepared for this event with the same cuts, else prepare them here
+  const StJetInput *input = GetSharedJetInput();
+  if(!input) {
+    PrepareJetInput();
+    input = fJetInput;
+  }
+  mInputMatchMap = input->GetTowerMatchMap();
+
+  // constituent table of this event: float kinematics and type of each input vector
+  fConstituentTable->Reset();
+  fConstituentTable->Fill(input->GetVectors());
+
+  // send input to FJ wrapper - user index is kept (tracks 0+, ghosts = -1, towers < -1)
+  fjw.AddInputVectors(input->GetVectors());
+
+  // if running constituent subtractor, do this in parallel
+  if(doConstituentSubtr) fFull_Event = input->GetVectors();
+
+  // run jet finder
+  fjw.Run();
+
+  // additional jet definitions - cluster the same input
+  for(int i = 0; i < fNJetConfigs; i++) {
+    fjwConfig[i]->Clear();
+    fjwConfig[i]->AddInputVectors(input->GetVectors());
+    fjwConfig[i]->Run();
+  }
+}
+//
+// Function: get the input vectors of the input maker (SetJetInputMakerName)
+// returns 0x0 if no input maker is set, it did not prepare input for the current event,
+// or prepared it with different cuts than this maker uses
+// QA histograms of the track and tower loop are only filled by the maker preparing the input
+//________________________________________________________________________
+const StJetInput *StJetMakerTask::GetSharedJetInput()
+{
+  if(fJetInputMakerName == "" || fJetInputMakerName == GetName()) return 0x0;
+
+  StMaker *maker = GetMaker(fJetInputMakerName);
+  if(!maker || !maker->InheritsFrom("StJetMakerTask")) return 0x0;
+
+  const StJetInput *input = static_cast<StJetMakerTask*>(maker)->GetJetInput();
+  if(!input || !input->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) return 0x0;
+  if(!input->IsCompatible(GetJetInputCuts())) return 0x0;
+
+  return input;
+}
+//
+// Function: cuts the input vectors depend on
+//________________________________________________________________________
+StJetInputCuts StJetMakerTask::GetJetInputCuts() const
+{
+  StJetInputCuts cuts;
+  cuts.fJetType = fJetType;
+  cuts.fUsePrimTracks = doUsePrimTracks;
+  cuts.fMinJetTrackPt = fMinJetTrackPt;
+  cuts.fMaxJetTrackPt = fMaxJetTrackPt;
+  cuts.fJetTrackEtaMin = fJetTrackEtaMin;
+  cuts.fJetTrackEtaMax = fJetTrackEtaMax;
+  cuts.fJetTrackPhiMin = fJetTrackPhiMin;
+  cuts.fJetTrackPhiMax = fJetTrackPhiMax;
+  cuts.fJetTrackDCAcut = fJetTrackDCAcut;
+  cuts.fJetTracknHitsFit = fJetTracknHitsFit;
+  cuts.fJetTracknHitsRatio = fJetTracknHitsRatio;
+  cuts.fTrackEtaMin = fTrackEtaMin;
+  cuts.fTrackEtaMax = fTrackEtaMax;
+  cuts.fTrackPhiMin = fTrackPhiMin;
+  cuts.fTrackPhiMax = fTrackPhiMax;
+  cuts.fJetTowerEtaMin = fJetTowerEtaMin;
+  cuts.fJetTowerEtaMax = fJetTowerEtaMax;
+  cuts.fJetTowerPhiMin = fJetTowerPhiMin;
+  cuts.fJetTowerPhiMax = fJetTowerPhiMax;
+  cuts.fTowerEnergyMin = mTowerEnergyMin;
+  cuts.fHadronicCorrFrac = mHadronicCorrFrac;
+  cuts.fJetHadCorrType = fJetHadCorrType;
+  cuts.fDoEffCorr = fDoEffCorr;
+  cuts.fCorrectTracksforEff = doCorrectTracksforEffBeforeJetReco;
+  cuts.fTrackEfficiencyType = fTrackEfficiencyType;
+
+  return cuts;
+}
+//
+// Function: track-tower match map was built with these track cuts (track type, pt range and quality cuts)
+// - matched tracks pass AcceptJetTrack(), their E is summed if they also pass AcceptTrack() (no pt cut):
+//   same as a single cut set if the jet track acceptance is inside the AcceptTrack() acceptance
+//________________________________________________________________________
+Bool_t StJetMakerTask::HasTowerMatchMapCuts(Bool_t usePrim, Double_t ptMin, Double_t ptMax, Double_t etaMin, Double_t etaMax,
+                                            Double_t phiMin, Double_t phiMax, Double_t dcaMax, Int_t nHitsFitMin, Double_t nHitsRatioMin) const {
+  // input maker map (if used) was built with the same cuts
+  StJetInputCuts cuts = GetJetInputCuts();
+  if(cuts.fJetType == kNeutralJet) return kFALSE; // no tracks matched
+
+  // jet track acceptance inside the acceptance for the hadronic correction
+  if((cuts.fJetTrackEtaMin < cuts.fTrackEtaMin) || (cuts.fJetTrackEtaMax > cuts.fTrackEtaMax)) return kFALSE;
+  if((cuts.fJetTrackPhiMin < cuts.fTrackPhiMin) || (cuts.fJetTrackPhiMax > cuts.fTrackPhiMax)) return kFALSE;
+
+  return (usePrim == cuts.fUsePrimTracks && ptMin == cuts.fMinJetTrackPt && ptMax == cuts.fMaxJetTrackPt &&
+          etaMin == cuts.fJetTrackEtaMin && etaMax == cuts.fJetTrackEtaMax && phiMin == cuts.fJetTrackPhiMin && phiMax == cuts.fJetTrackPhiMax &&
+          dcaMax == cuts.fJetTrackDCAcut && nHitsFitMin == cuts.fJetTracknHitsFit && nHitsRatioMin == cuts.fJetTracknHitsRatio);
+}
+//
+// Function: fill input vectors from tracks + towers
+//________________________________________________________________________
+void StJetMakerTask::PrepareJetInput()
+{
+  // input of this event and cut set - tracks matched to towers are kept with it for the jet constituents
+  fJetInput->Reset(mPicoEvent->runId(), mPicoEvent->eventId(), GetJetInputCuts());
+  fJetInput->SetTowerMatchMap(mTowerMatchMap);
+
   // get cent bin for some histograms: cbin = 1 for pp and thus array element 0
   Int_t cbin = -1;
   if (fCentralityScaled >= 0 && fCentralityScaled < 10)       cbin = 1; //  0-10%
@@ -802,34 +1037,60 @@ void StJetMakerTask::FindJets()
   // loop over ALL tracks in PicoDst and add to jet, after acceptance and quality cuts 
   if((fJetType == kFullJet) || (fJetType == kChargedJet)) {
     for(unsigned short iTracks = 0; iTracks < ntracks; iTracks++){
-      // get track pointer
-      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(iTracks));
-      if(!trk){ continue; }
-
-      // acceptance and kinematic quality cuts - pt cut is also applied here currently
-      if(!AcceptJetTrack(trk, Bfield, mVertex)) { continue; }
+      // track variables
+      double pt, phi, eta, px, py, pz, p;
+      short charge;
+      int matchedTowerIndex;
+      bool useForHadCorr;
+
+      if(mTrackCache) {
+        // acceptance and kinematic quality cuts on shared track cache - pt cut is also applied here currently
+        if(!AcceptJetTrack(mTrackCache, iTracks)) { continue; }
+
+        pt = mTrackCache->GetPt(iTracks);
+        phi = mTrackCache->GetPhi(iTracks);  // (0, 2pi)
+        eta = mTrackCache->GetEta(iTracks);
+        px = mTrackCache->GetPx(iTracks);
+        py = mTrackCache->GetPy(iTracks);
+        pz = mTrackCache->GetPz(iTracks);
+        p = mTrackCache->GetP(iTracks);
+        charge = mTrackCache->GetCharge(iTracks);
+        matchedTowerIndex = mTrackCache->GetTowerIndex(iTracks); // towerIndex = towerID - 1
+
+        // matched track used for hadronic correction: standard track cuts (no pt cut)
+        useForHadCorr = (matchedTowerIndex >= 0) && AcceptTrack(mTrackCache, iTracks);
+      } else {
+        // get track pointer
+        StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(iTracks));
+        if(!trk){ continue; }
+
+        // acceptance and kinematic quality cuts - pt cut is also applied here currently
+        if(!AcceptJetTrack(trk, Bfield, mVertex)) { continue; }
+
+        // get momentum vector of track - global or primary track
+        TVector3 mTrkMom;
+        if(doUsePrimTracks) { 
+          mTrkMom = trk->pMom();                // get primary track vector
+        } else { 
+          mTrkMom = trk->gMom(mVertex, Bfield); // get global track vector 
+        }
 
-      // get momentum vector of track - global or primary track
-      TVector3 mTrkMom;
-      if(doUsePrimTracks) { 
-        mTrkMom = trk->pMom();                // get primary track vector
-      } else { 
-        mTrkMom = trk->gMom(mVertex, Bfield); // get global track vector 
+        pt = mTrkMom.Perp();
+        phi = mTrkMom.Phi();
+        if(phi < 0.0)    phi += 2.0*pi;  // force from 0-2pi
+        if(phi > 2.0*pi) phi -= 2.0*pi;  // force from 0-2pi
+        eta = mTrkMom.PseudoRapidity();
+        px = mTrkMom.x();
+        py = mTrkMom.y();
+        pz = mTrkMom.z();
+        p = mTrkMom.Mag();
+        charge = trk->charge();
+        matchedTowerIndex = trk->bemcTowerIndex(); // towerIndex = towerID - 1
+
+        // matched track used for hadronic correction: standard track cuts (no pt cut)
+        useForHadCorr = (matchedTowerIndex >= 0) && AcceptTrack(trk, Bfield, mVertex);
       }
-
-      // track variables
-      double pt = mTrkMom.Perp();
-      double phi = mTrkMom.Phi();
-      if(phi < 0.0)    phi += 2.0*pi;  // force from 0-2pi
-      if(phi > 2.0*pi) phi -= 2.0*pi;  // force from 0-2pi
-      double eta = mTrkMom.PseudoRapidity();
-      double px = mTrkMom.x();
-      double py = mTrkMom.y();
-      double pz = mTrkMom.z();
-      double p = mTrkMom.Mag();
       double energy = 1.0*TMath::Sqrt(p*p + pi0mass*pi0mass);
-      short charge = trk->charge();
-      int matchedTowerIndex = trk->bemcTowerIndex(); // towerIndex = towerID - 1
       //cout<<"Charge: "<<charge<<"  nHitsFit: "<<trk->nHitsFit()<<endl;
 
       // fill some track QA histograms
@@ -851,58 +1112,31 @@ void StJetMakerTask::FindJets()
       double energyCorr = 1.0*TMath::Sqrt(pxCorr*pxCorr + pyCorr*pyCorr + pzCorr*pzCorr + pi0mass*pi0mass);
       //cout<<"pt: "<<pt<<"   eta: "<<eta<<"   trkEff: "<<trkEff<<endl;
 
-      // add track input vector to FastJet
+      // add track input vector
       if(doCorrectTracksforEffBeforeJetReco) {  // kTRUE - corrects tracks before FastJet reconstruction
-        fjw.AddInputVector(pxCorr, pyCorr, pzCorr, energyCorr, iTracks); // efficiency corrected components
+        fJetInput->Add(pxCorr, pyCorr, pzCorr, energyCorr, iTracks); // efficiency corrected components
       } else {
         // THIS IS DEFAULT !
-        // send track info to FJ wrapper
-        fjw.AddInputVector(px, py, pz, energy, iTracks); // includes E
-      }
-
-      // if running constituent subtractor, do this in parallel
-      if(doConstituentSubtr) {
-        if(doCorrectTracksforEffBeforeJetReco) {  // kTRUE - corrects tracks before FastJet reconstruction
-          fastjet::PseudoJet particle_Track(pxCorr, pyCorr, pzCorr, energyCorr); // efficiency corrected components
-          particle_Track.set_user_index(iTracks);
-          fFull_Event.push_back(particle_Track);
-        } else {
-          // THIS IS DEFAULT !
-          fastjet::PseudoJet particle_Track(px, py, pz, energy);
-          particle_Track.set_user_index(iTracks);
-          fFull_Event.push_back(particle_Track);
-        }
+        fJetInput->Add(px, py, pz, energy, iTracks); // includes E
       }
 
       //====  matched track index ===
       int trackIndex = iTracks;
       if(trackIndex < 0) { continue; } // can't happen
       if(matchedTowerIndex < 0) { continue; } // rare, but sometimes the 'trk->bemcTowerIndex()' returns -1; 
-/*
-      cout<<"1. trackIndex = "<<trackIndex<<"   matchedTowerIndex = "<<matchedTowerIndex<<
-      "   mTowerMatchTrkIndex[ "<<matchedTowerIndex<<" ][ "<<mTowerStatusArr[ matchedTowerIndex ]<<" ]] = "<<mTowerMatchTrkIndex[ matchedTowerIndex ][ mTowerStatusArr[ matchedTowerIndex ]]<<
-      "   mTowerStatusArr[ "<<matchedTowerIndex<<" ] = "<<mTowerStatusArr[ matchedTowerIndex ]<<endl;
-*/
-      mTowerMatchTrkIndex[ matchedTowerIndex ][ mTowerStatusArr[ matchedTowerIndex ]] = (double)trackIndex;
-      //cout<<"1. mTowerMatchTrkIndex[ "<<matchedTowerIndex<<" ][ "<<mTowerStatusArr[ matchedTowerIndex ]<<" ] = "<<
-      //          mTowerMatchTrkIndex[ matchedTowerIndex ][ mTowerStatusArr[ matchedTowerIndex ]]<<endl;
-
-      mTowerStatusArr[ matchedTowerIndex ] = mTowerStatusArr[ matchedTowerIndex ] + 1;  // 1+ means match, 0 for no match
-/*
-      cout<<"2. mTowerMatchTrkIndex[ "<<matchedTowerIndex<<" ][ "<<mTowerStatusArr[ matchedTowerIndex ]<<" ] = "<<
-                mTowerMatchTrkIndex[ matchedTowerIndex ][ mTowerStatusArr[ matchedTowerIndex ]]<<endl;
-      cout<<"2. trackIndex = "<<trackIndex<<"   matchedTowerIndex = "<<matchedTowerIndex<<
-      "   mTowerMatchTrkIndex[ "<<matchedTowerIndex<<" ][ "<<mTowerStatusArr[ matchedTowerIndex ]<<" ]] = "<<mTowerMatchTrkIndex[ matchedTowerIndex ][ mTowerStatusArr[ matchedTowerIndex ]]<<
-      "   mTowerStatusArr[ "<<matchedTowerIndex<<" ] = "<<mTowerStatusArr[ matchedTowerIndex ]<<endl;
-*/
 
+      // record match: counts all matched jet tracks, E sum/max only from tracks passing the standard cuts
+      mTowerMatchMap->AddMatch(matchedTowerIndex, trackIndex, energy, useForHadCorr);
     } // track loop
 
   }   // if full/charged jets
 
+  // CSR offsets for matched tracks of each tower
+  mTowerMatchMap->Build();
+  mTowerMatchMap->SetEvent(mPicoEvent->runId(), mPicoEvent->eventId());
+
   // full or neutral jets - get towers and apply hadronic correction
   if((fJetType == kFullJet) || (fJetType == kNeutralJet)) {
-    int matchedTowerTrackCounter = 0;
 
     // print
     //int nTracks = mPicoDst->numberOfTracks();               // number of tracks
@@ -927,15 +1161,13 @@ void StJetMakerTask::FindJets()
       if(!AcceptJetTower(tower, towerID)) continue;
 
       // cluster and tower position - from vertex and ID: shouldn't need additional eta correction
-      TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-      double towerPhi = towerPosition.Phi();
-      if(towerPhi < 0.0)    towerPhi += 2.0*pi;  // force from 0-2pi
-      if(towerPhi > 2.0*pi) towerPhi -= 2.0*pi;  // force from 0-2pi
-      double towerEta = towerPosition.PseudoRapidity();
+      double towerPhi = mTowerGeom->GetPhi(towerID);          // (0, 2pi)
+      double towerEta = mTowerGeom->GetEta(towerID);
+      double towerInvCosh = mTowerGeom->GetInvCosh(towerID);  // 1/cosh(eta)
       int towerADC = tower->adc();
       double towerEunCorr = tower->energy();  // uncorrected energy
       double towerE = tower->energy();        // corrected energy (hadronically - done below)
-      double towEtunCorr = towerEunCorr / (1.0*TMath::CosH(towerEta));
+      double towEtunCorr = towerEunCorr * towerInvCosh;
 
       // fill QA histos for jet towers - no energy cuts at this point
       fHistNTowervsID->Fill(towerID);
@@ -947,9 +1179,10 @@ void StJetMakerTask::FindJets()
       fHistNTowervsPhivsEta->Fill(towerPhi, towerEta);
 
       // fill a NmatchTrack histogram here (centrality dependent)
+      int nMatchedTracks = mTowerMatchMap->GetNMatched(towerIndex);
       if(cbin > 0 && cbin < 6) {
         int arrayBin = cbin - 1; // value -> array
-        fHistNMatchTrack[arrayBin]->Fill( (double)mTowerStatusArr[towerIndex] );
+        fHistNMatchTrack[arrayBin]->Fill( (double)nMatchedTracks );
       }
 
       // cut on min tower energy after filling histos
@@ -960,43 +1193,18 @@ void StJetMakerTask::FindJets()
       double maxEt = 0.;
       double sumEt = 0.;
 
-      // if tower was is matched to a track or multiple, add up the matched track energies - (mult opt.) to then subtract from the corresponding tower
+      // if tower was is matched to a track or multiple, subtract the matched track energies - (mult opt.) from the corresponding tower
       // August 15: if *have* 1+ matched trk-tow AND uncorrected energy of tower is at least your tower constituent cut, then CONTINUE 
-      if(mTowerStatusArr[towerIndex] > 0.5 && towerEunCorr > mTowerEnergyMin) {
-        double maxE = 0.0;
-        double sumE = 0.0;
+      if(nMatchedTracks > 0 && towerEunCorr > mTowerEnergyMin) {
 // =======================================================================================================================
-        // --- finds max E track matched to tower *AND* the sum of all matched track E and subtract from said tower
+        // --- max E track matched to tower *AND* the sum of all matched track E, accumulated while filling the match map
         //     USER provides readMacro.C which method to use for their analysis via SetJetHadCorrType(type);
-        // loop over ALL matched tracks
-        for(int itrk = 0; itrk < mTowerStatusArr[towerIndex]; itrk++) {
-          StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track( mTowerMatchTrkIndex[towerIndex][itrk] ));
-          if(!trk) { cout<<"No track pointer..."<<endl; continue; }
-          //cout<<"itrk = "<<itrk<<"   mTowerMatchTrkIndex[ "<<towerIndex<<" ][ "<<itrk<<"] = "<<mTowerMatchTrkIndex[towerIndex][itrk]<<endl;
-
-          if(!AcceptTrack(trk, Bfield, mVertex)) { cout<<"track matched back doesn't pass cuts"<<endl; continue; }  
-
-          // get track variables to matched tower from 3-vector
-          TVector3 mTrkMom;
-          if(doUsePrimTracks) {
-            mTrkMom = trk->pMom();                // get primary track vector
-          } else {             
-            mTrkMom = trk->gMom(mVertex, Bfield); // get global track vector
-          }
-
-          // track variables
-          double p = mTrkMom.Mag();
-          double E = 1.0*TMath::Sqrt(p*p + pi0mass*pi0mass);
-          if(E > maxE) maxE = E;
-          sumE = sumE + E;
-
-          // test statement
-          //cout<<itrk<<"  itrkE: "<<E<<"  sumtrkE: "<<sumE<<endl;
-        } // track loop
+        double maxE = mTowerMatchMap->GetMaxE(towerIndex);
+        double sumE = mTowerMatchMap->GetSumE(towerIndex);
 
         // apply hadronic correction to tower
-        maxEt  = (towerEunCorr - (mHadronicCorrFrac * maxE))/(1.0*TMath::CosH(towerEta));
-        sumEt  = (towerEunCorr - (mHadronicCorrFrac * sumE))/(1.0*TMath::CosH(towerEta));        
+        maxEt  = (towerEunCorr - (mHadronicCorrFrac * maxE)) * towerInvCosh;
+        sumEt  = (towerEunCorr - (mHadronicCorrFrac * sumE)) * towerInvCosh;
 
         // fill histogram to compare 2 hadronic correction methods (centrality dependent)
         if(cbin > 0 && cbin < 6) {
@@ -1008,9 +1216,9 @@ void StJetMakerTask::FindJets()
       // else - no match so treat towers on their own. Must meet constituent cut
 
       // Et - correction comparison
-      double fMaxEt = (maxEt == 0) ? towerEunCorr / (1.0*TMath::CosH(towerEta)) : maxEt;
-      double fSumEt = (sumEt == 0) ? towerEunCorr / (1.0*TMath::CosH(towerEta)) : sumEt;
-      //if(mTowerStatusArr[towerIndex] > 0.5) cout<<"towerEunCorr = "<<towerEunCorr<<"  CosH: "<<1.0*TMath::CosH(towerEta)<<"   fMaxEt: "<<fMaxEt<<"   fSumEt: "<<fSumEt<<endl;
+      double fMaxEt = (maxEt == 0) ? towEtunCorr : maxEt;
+      double fSumEt = (sumEt == 0) ? towEtunCorr : sumEt;
+      //if(nMatchedTracks > 0) cout<<"towerEunCorr = "<<towerEunCorr<<"  CosH: "<<1.0*TMath::CosH(towerEta)<<"   fMaxEt: "<<fMaxEt<<"   fSumEt: "<<fSumEt<<endl;
 
       // QA - added Dec18, 2019 - TEST
       if(cbin > 0 && cbin < 6) {
@@ -1021,11 +1229,11 @@ void StJetMakerTask::FindJets()
 
       // cut on transverse tower energy (more uniform)
       double towerEt = 0.0;
-      if(mTowerStatusArr[towerIndex] < 1) { // no matches, use towers uncorrected energy
-        towerEt = towerEunCorr / (1.0*TMath::CosH(towerEta)); 
+      if(nMatchedTracks < 1) { // no matches, use towers uncorrected energy
+        towerEt = towEtunCorr;
       } else { 
-          if(fJetHadCorrType == StJetFrameworkPicoBase::kHighestEMatchedTrack) {  towerEt = fMaxEt;  towerE = fMaxEt  * 1.0*TMath::CosH(towerEta); }
-          if(fJetHadCorrType == StJetFrameworkPicoBase::kAllMatchedTracks)     {  towerEt = fSumEt;  towerE = fSumEt  * 1.0*TMath::CosH(towerEta); } 
+          if(fJetHadCorrType == StJetFrameworkPicoBase::kHighestEMatchedTrack) {  towerEt = fMaxEt;  towerE = fMaxEt / towerInvCosh; }
+          if(fJetHadCorrType == StJetFrameworkPicoBase::kAllMatchedTracks)     {  towerEt = fSumEt;  towerE = fSumEt / towerInvCosh; } 
       }
       if(towerEt == 0) { cout<<"fJetHadCorrType - or - towerE actually 0"<<endl; }  // it was unset, because you provided wrong fJetHadCorrType
       if(towerEt < 0) towerEt = 0.0;
@@ -1038,23 +1246,13 @@ void StJetMakerTask::FindJets()
       double towerPy = mom.y();
       double towerPz = mom.z();
 
-      // add towers to fastjet - shift tower index (tracks 0+, ghosts = -1, towers < -1)
+      // add tower input vector - shift tower index (tracks 0+, ghosts = -1, towers < -1)
       int uidTow = -(itow + 2);  
-      fjw.AddInputVector(towerPx, towerPy, towerPz, towerE, uidTow); // includes E
-
-      // if running constituent subtractor, do this in parallel
-      if(doConstituentSubtr) {
-        fastjet::PseudoJet particle_Tower(towerPx, towerPy, towerPz, towerE);
-        particle_Tower.set_user_index(uidTow);
-        fFull_Event.push_back(particle_Tower);
-      }
+      fJetInput->Add(towerPx, towerPy, towerPz, towerE, uidTow); // includes E
 
     } // tower loop
 
   }   // neutral/full jets
-
-  // run jet finder
-  fjw.Run();
 }
 //
 /**
@@ -1063,9 +1261,20 @@ void StJetMakerTask::FindJets()
  * called for each jet and finally after jet finding the terminate method of all utilities is called.
  */
 void StJetMakerTask::FillJetBranch()
+{
+  FillJetBranch(fjw, fJets, fRadius);
+}
+//
+// Function: fill jet array from the jets of a fastjet wrapper
+//________________________________________________________________________
+void StJetMakerTask::FillJetBranch(StFJWrapper &wrapper, TClonesArray *jets, Double_t radius)
 {
   // get inclusive jets
-  std::vector<fastjet::PseudoJet> jets_incl = fjw.GetInclusiveJets();
+  std::vector<fastjet::PseudoJet> jets_incl = wrapper.GetInclusiveJets();
+
+  // jet utilities are for the main jet definition only
+  Bool_t doUtilities = (fUtilities && &wrapper == &fjw);
+  if(doUtilities) PrepareUtilities();
 
   // sort jets according to jet pt
   static Int_t indexes[9999] = {-1};
@@ -1076,41 +1285,46 @@ void StJetMakerTask::FillJetBranch()
   //for(UInt_t ij = 0, jetCount = 0; ij < jets_incl.size(); ++ij) {
   for(UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
     Int_t ij = indexes[ijet];
-    __DEBUG(StJetFrameworkPicoBase::kDebugFillJets,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fjw.GetJetArea(ij)));
+    __DEBUG(StJetFrameworkPicoBase::kDebugFillJets,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), wrapper.GetJetArea(ij)));
 
     // PERFORM CUTS ON inclusive JETS before saving
     if(jets_incl[ij].perp() < fMinJetPt) continue;                                              // cut on min jet pt
-    if(fjw.GetJetArea(ij) < fMinJetArea*TMath::Pi()*fRadius*fRadius) continue;                  // cut on min jet area
+    if(wrapper.GetJetArea(ij) < fMinJetArea*TMath::Pi()*radius*radius) continue;                  // cut on min jet area
     if((jets_incl[ij].eta() < fJetEtaMin) || (jets_incl[ij].eta() > fJetEtaMax)) continue;      // cut on eta acceptance
     if((jets_incl[ij].phi() < fJetPhiMin) || (jets_incl[ij].phi() > fJetPhiMax)) continue;      // cut on phi acceptance
 
     // need to figure out how to get m or E from STAR tracks
-    StJet *jet = new ((*fJets)[jetCount])
+    StJet *jet = new ((*jets)[jetCount])
       StJet(jets_incl[ij].perp(), jets_incl[ij].eta(), jets_incl[ij].phi(), jets_incl[ij].m());
 
     jet->SetLabel(ij);
 
     // area vector and components
-    fastjet::PseudoJet area(fjw.GetJetAreaVector(ij));
-    jet->SetArea(area.perp());  // same as fjw.GetJetArea(ij)
+    fastjet::PseudoJet area(wrapper.GetJetAreaVector(ij));
+    jet->SetArea(area.perp());  // same as wrapper.GetJetArea(ij)
     jet->SetAreaEta(area.eta());
     jet->SetAreaPhi(area.phi());
     jet->SetAreaE(area.E());
 
-    // March 8, 2018 - probably don't need this anymore after coming up with method to pass and extract constituents via index!
-    // get constituents of jets
-    fConstituents = fjw.GetJetConstituents(ij);
-    jet->SetJetConstituents(fConstituents);
+    // get constituents of jets - the jet keeps a span in the constituent table,
+    // its PseudoJet constituents are only made on request (StJet::GetJetConstituents)
+    fConstituents = wrapper.GetJetConstituents(ij);
+    Int_t constitBegin = fConstituentTable->AddJet(fConstituents);
+    jet->SetConstituentSpan(fConstituentTable, constitBegin, fConstituentTable->GetNJetEntries() - constitBegin);
 
     // fill jet constituents
-    vector<fastjet::PseudoJet> constituents = fjw.GetJetConstituents(ij);
-    FillJetConstituents(jet, constituents, constituents);
+    FillJetConstituents(jet, fConstituents, fConstituents);
+
+    // run jet utilities on accepted jet
+    if(doUtilities) ExecuteUtilities(jet, ij);
 
     __DEBUG(StJetFrameworkPicoBase::kDebugFillJets, Form("Added jet n. %d, pt = %f, area = %f, constituents = %d", jetCount, jet->Pt(), jet->Area(), jet->GetNumberOfConstituents()));
 
     jetCount++;
   } // jet loop 
 
+  if(doUtilities) TerminateUtilities();
+
 }
 //
 /**
@@ -1141,9 +1355,13 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
   else if (fCentralityScaled >= 30 && fCentralityScaled < 50) cbin = 4; // 30-50%
   else if (fCentralityScaled >= 50 && fCentralityScaled < 80) cbin = 5; // 50-80%
 
-  // initially set track and tower constituent sizes
-  jet->SetNumberOfTracks(constituents.size());
-  jet->SetNumberOfTowers(constituents.size());
+  // jets with a span in the constituent table take their track and tower indices from it,
+  // the others (subtracted constituents) store them: initially set track and tower constituent sizes
+  Bool_t fillIDs = (jet->GetConstituentTable() == 0x0);
+  if(fillIDs) {
+    jet->SetNumberOfTracks(constituents.size());
+    jet->SetNumberOfTowers(constituents.size());
+  }
 
   // loop over constituents for ij'th jet
   for(UInt_t ic = 0; ic < constituents.size(); ++ic) {
@@ -1152,7 +1370,7 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
 
     // CHARGED COMPONENT (tracks)
     if(uid >= 0) {
-      jet->AddTrackAt(uid, nt);
+      if(fillIDs) jet->AddTrackAt(uid, nt);
 
       // get jet track pointer
       StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(uid));
@@ -1182,11 +1400,13 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
       if(pt > maxTrack) maxTrack = pt;
 
       // fill some QA histograms
-      fHistJetNTrackvsPtCent[cbin - 1]->Fill(pt);
-      fHistJetNTrackvsPt->Fill(pt);
-      fHistJetNTrackvsPhi->Fill(phi);
-      fHistJetNTrackvsEta->Fill(eta);
-      fHistJetNTrackvsPhivsEta->Fill(phi, eta);
+      if(fFillJetQA) {
+        fHistJetNTrackvsPtCent[cbin - 1]->Fill(pt);
+        fHistJetNTrackvsPt->Fill(pt);
+        fHistJetNTrackvsPhi->Fill(phi);
+        fHistJetNTrackvsEta->Fill(eta);
+        fHistJetNTrackvsPhivsEta->Fill(phi, eta);
+      }
 
       // TODO -  add histograms to a switch with tracking efficiency applied ???
 
@@ -1209,7 +1429,7 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
 
         // convert uid to tower index (index of tower - in BTowHit array)
         Int_t towIndex = -(uid + 2);   // 1 less than towerID
-        jet->AddTowerAt(towIndex, nc);
+        if(fillIDs) jet->AddTowerAt(towIndex, nc);
 
         // get jet tower pointer
         StPicoBTowHit *tower = static_cast<StPicoBTowHit*>(mPicoDst->btowHit(towIndex));
@@ -1223,12 +1443,10 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
         // tower acceptance cuts, also cuts bad towers - already done before input to FJ
         if(!AcceptJetTower(tower, towerID)) continue;
 
-        // get vector for tower position
-        TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-        double towerPhi = towerPosition.Phi();
-        if(towerPhi < 0.0)    towerPhi += 2.0*pi;  // force from 0-2pi
-        if(towerPhi > 2.0*pi) towerPhi -= 2.0*pi;  // force from 0-2pi
-        double towerEta = towerPosition.PseudoRapidity();
+        // tower position for this vertex
+        double towerPhi = mTowerGeom->GetPhi(towerID);          // (0, 2pi)
+        double towerEta = mTowerGeom->GetEta(towerID);
+        double towerInvCosh = mTowerGeom->GetInvCosh(towerID);  // 1/cosh(eta)
         double towEuncorr = tower->energy();
         double towE = tower->energy();
         int towADC = tower->adc();
@@ -1238,53 +1456,31 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
 
         // need to perform hadronic correction again since StBTowHit object is not updated
         // if tower was not matched to an accepted track, use it for jet by itself if > constit cut
-        if(mTowerStatusArr[towIndex] > 0.5) {
-          double maxE = 0.0;
-          double sumE = 0.0;
-
+        int nMatchedTracks = mInputMatchMap->GetNMatched(towIndex);
+        if(nMatchedTracks > 0) {
 // ============================================================================================================================
-          // loop over ALL matched tracks
-          for(int itrk = 0; itrk < mTowerStatusArr[towIndex]; itrk++) {
-            StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track( mTowerMatchTrkIndex[towIndex][itrk] ));
-            if(!trk) { cout<<"No track pointer..."<<endl; continue; }
-            if(!AcceptTrack(trk, Bfield, mVertex)) { 
-              cout<<"track matched back doesn't pass cuts"<<endl; continue; 
-            }
-
-            // get track variables to matched tower from 3-vector
-            TVector3 mTrkMom;
-            if(doUsePrimTracks) {
-              mTrkMom = trk->pMom();                // get primary track vector
-            } else {
-              mTrkMom = trk->gMom(mVertex, Bfield); // get global track vector
-            }
-
-            // track variables
-            double p = mTrkMom.Mag();
-            double E = 1.0*TMath::Sqrt(p*p + pi0mass*pi0mass);
-
-            if(E > maxE) maxE = E;
-            sumE = sumE + E;
-          } // track loop
+          // max and sum E of matched tracks - from the match map filled with the jet input
+          double maxE = mInputMatchMap->GetMaxE(towIndex);
+          double sumE = mInputMatchMap->GetSumE(towIndex);
 
           // apply hadronic correction to tower
-          maxEt  = (towEuncorr - (mHadronicCorrFrac * maxE))/(1.0*TMath::CosH(towerEta));
-          sumEt  = (towEuncorr - (mHadronicCorrFrac * sumE))/(1.0*TMath::CosH(towerEta));
+          maxEt  = (towEuncorr - (mHadronicCorrFrac * maxE)) * towerInvCosh;
+          sumEt  = (towEuncorr - (mHadronicCorrFrac * sumE)) * towerInvCosh;
 // ============================================================================================================================
         } // hadronic correction - have matched track
         // else - no match so treat towers on their own
 
         // set tower transverse energy, various options available
-        double fMaxEt = (maxEt == 0) ? towEuncorr / (1.0*TMath::CosH(towerEta)) : maxEt;
-        double fSumEt = (sumEt == 0) ? towEuncorr / (1.0*TMath::CosH(towerEta)) : sumEt;
+        double fMaxEt = (maxEt == 0) ? towEuncorr * towerInvCosh : maxEt;
+        double fSumEt = (sumEt == 0) ? towEuncorr * towerInvCosh : sumEt;
 
         // cut on transverse tower energy (more uniform)
         double towEt = 0.0;
-        if(mTowerStatusArr[towIndex] < 1) { // no matches, use towers uncorrected energy
-          towEt = towEuncorr / (1.0*TMath::CosH(towerEta));
+        if(nMatchedTracks < 1) { // no matches, use towers uncorrected energy
+          towEt = towEuncorr * towerInvCosh;
         } else {
-          if(fJetHadCorrType == StJetFrameworkPicoBase::kHighestEMatchedTrack) { towEt = fMaxEt;  towE = fMaxEt  * 1.0*TMath::CosH(towerEta); }
-          if(fJetHadCorrType == StJetFrameworkPicoBase::kAllMatchedTracks)     { towEt = fSumEt;  towE = fSumEt  * 1.0*TMath::CosH(towerEta); }
+          if(fJetHadCorrType == StJetFrameworkPicoBase::kHighestEMatchedTrack) { towEt = fMaxEt;  towE = fMaxEt / towerInvCosh; }
+          if(fJetHadCorrType == StJetFrameworkPicoBase::kAllMatchedTracks)     { towEt = fSumEt;  towE = fSumEt / towerInvCosh; }
         }
         if(towEt == 0) { cout<<"fJetHadCorrType - or - towerE actually 0"<<endl; }  // it was unset, because you provided wrong fJetHadCorrType
         if(towEt < 0.0) towEt = 0.0;
@@ -1295,16 +1491,18 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
         neutralE += towE;
 
         // fill QA histos for jet towers
-        fHistJetNTowervsID->Fill(towerID);
-        fHistJetNTowervsADC->Fill(towADC);
-        fHistJetNTowervsE->Fill(towE);
-        fHistJetNTowervsEtCent[cbin - 1]->Fill(towEt);
-        fHistJetNTowervsEt->Fill(towEt);
-        fHistJetNTowervsPhi->Fill(towerPhi);
-        fHistJetNTowervsEta->Fill(towerEta);
-        fHistJetNTowervsPhivsEta->Fill(towerPhi, towerEta);
-        fHistQATowIDvsEta->Fill(towerID, towerEta);
-        fHistQATowIDvsPhi->Fill(towerID, towerPhi);
+        if(fFillJetQA) {
+          fHistJetNTowervsID->Fill(towerID);
+          fHistJetNTowervsADC->Fill(towADC);
+          fHistJetNTowervsE->Fill(towE);
+          fHistJetNTowervsEtCent[cbin - 1]->Fill(towEt);
+          fHistJetNTowervsEt->Fill(towEt);
+          fHistJetNTowervsPhi->Fill(towerPhi);
+          fHistJetNTowervsEta->Fill(towerEta);
+          fHistJetNTowervsPhivsEta->Fill(towerPhi, towerEta);
+          fHistQATowIDvsEta->Fill(towerID, towerEta);
+          fHistQATowIDvsPhi->Fill(towerID, towerPhi);
+        }
 
         // increase tower counter
         nc++;
@@ -1315,14 +1513,17 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
   }  // end of constituent loop
 
   // set some jet properties
-  jet->SetNumberOfTracks(nt);
-  jet->SetNumberOfTowers(nc);
+  if(fillIDs) {
+    jet->SetNumberOfTracks(nt);
+    jet->SetNumberOfTowers(nc);
+  }
   jet->SetMaxTrackPt(maxTrack);
   jet->SetMaxTowerEt(maxTower);  
   jet->SetNEF(neutralE/jet->E());  // should this be Et? FIXME
   //jet->SortConstituents(); // TODO see how this works - sorts TowerIds() and TrackIds() by index (increasing)
 
   // fill jets histograms
+  if(!fFillJetQA) return;
   fHistNJetsvsPt->Fill(jet->Pt()); 
   fHistNJetsvsPhi->Fill(jet->Phi());
   fHistNJetsvsEta->Fill(jet->Eta());
@@ -1337,6 +1538,75 @@ void StJetMakerTask::FillJetConstituents(StJet *jet, std::vector<fastjet::Pseudo
   fHistNJetTowersvsJetPt[cbin - 1]->Fill(jet->Pt(), nc);
   fHistNJetConstituentsvsJetPt[cbin - 1]->Fill(jet->Pt(), nt + nc);
 }
+//
+// Function: add a jet utility, run on the accepted jets of the main jet definition every event
+// the maker owns the utility, returns 0x0 if it can't be added (after Init or same name)
+//________________________________________________________________________
+StJetUtility* StJetMakerTask::AddUtility(StJetUtility *utility)
+{
+  if(!utility) return 0x0;
+  if(fJets) {
+    LOG_WARN << Form("StJetMakerTask::AddUtility: can't add %s to %s after Init", utility->GetName(), GetName()) << endm;
+    return 0x0;
+  }
+
+  if(!fUtilities) {
+    fUtilities = new TObjArray();
+    fUtilities->SetOwner(kTRUE);
+  }
+
+  if(fUtilities->FindObject(utility->GetName())) {
+    LOG_WARN << Form("StJetMakerTask::AddUtility: %s already has a utility called %s", GetName(), utility->GetName()) << endm;
+    return 0x0;
+  }
+
+  utility->SetJetTask(this);
+  fUtilities->Add(utility);
+
+  return utility;
+}
+//
+// Function: initialize jet utilities (end of Init)
+//________________________________________________________________________
+void StJetMakerTask::InitUtilities()
+{
+  if(!fUtilities) return;
+
+  TIter next(fUtilities);
+  StJetUtility *utility = 0x0;
+  while((utility = static_cast<StJetUtility*>(next()))) utility->Init();
+}
+//
+// Function: prepare jet utilities for the event (before the jet loop)
+//________________________________________________________________________
+void StJetMakerTask::PrepareUtilities()
+{
+  TIter next(fUtilities);
+  StJetUtility *utility = 0x0;
+  while((utility = static_cast<StJetUtility*>(next()))) {
+    utility->InitEvent(fjw);
+    utility->Prepare(fjw);
+  }
+}
+//
+// Function: run jet utilities on an accepted jet - ij is the index of the jet in the wrapper
+// utilities needing a reclustering share StFJWrapper::GetReclusteredJet(ij)
+//________________________________________________________________________
+void StJetMakerTask::ExecuteUtilities(StJet *jet, Int_t ij)
+{
+  TIter next(fUtilities);
+  StJetUtility *utility = 0x0;
+  while((utility = static_cast<StJetUtility*>(next()))) utility->ProcessJet(jet, ij, fjw);
+}
+//
+// Function: terminate jet utilities for the event (after the jet loop)
+//________________________________________________________________________
+void StJetMakerTask::TerminateUtilities()
+{
+  TIter next(fUtilities);
+  StJetUtility *utility = 0x0;
+  while((utility = static_cast<StJetUtility*>(next()))) utility->Terminate(fjw);
+}
 /**
  * Sorts jets by pT (decreasing)
  * @param[out] indexes This array is used to return the indexes of the jets ordered by pT
@@ -1461,6 +1731,21 @@ Bool_t StJetMakerTask::AcceptJetTrack(StPicoTrack *trk, Float_t B, TVector3 Vert
   return kTRUE;
 }
 //
+// Function: track quality cuts - cached track, see AcceptTrack() above
+//________________________________________________________________________
+Bool_t StJetMakerTask::AcceptTrack(StTrackCacheMaker *cache, Int_t itrk) {
+  // no pt cut for track-tower matches
+  return cache->PassCuts(itrk, 0.0, 9999., fTrackEtaMin, fTrackEtaMax, fTrackPhiMin, fTrackPhiMax,
+                         fJetTrackDCAcut, fJetTracknHitsFit, fJetTracknHitsRatio);
+}
+//
+// Function: jet track quality cuts - cached track, see AcceptJetTrack() above
+//________________________________________________________________________
+Bool_t StJetMakerTask::AcceptJetTrack(StTrackCacheMaker *cache, Int_t itrk) {
+  return cache->PassCuts(itrk, fMinJetTrackPt, fMaxJetTrackPt, fJetTrackEtaMin, fJetTrackEtaMax, fJetTrackPhiMin, fJetTrackPhiMax,
+                         fJetTrackDCAcut, fJetTracknHitsFit, fJetTracknHitsRatio);
+}
+//
 // Tower Quality Cuts
 //________________________________________________________________________
 Bool_t StJetMakerTask::AcceptJetTower(StPicoBTowHit *tower, Int_t towerID) {
@@ -1471,11 +1756,8 @@ Bool_t StJetMakerTask::AcceptJetTower(StPicoBTowHit *tower, Int_t towerID) {
   if(towerID < 0) return kFALSE; 
 
   // cluster and tower position - from vertex and ID: shouldn't need additional eta correction
-  TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-  double phi = towerPosition.Phi();
-  if(phi < 0.0)    phi += 2.0*pi;  // force from 0-2pi
-  if(phi > 2.0*pi) phi -= 2.0*pi;  // force from 0-2pi
-  double eta = towerPosition.PseudoRapidity();
+  double phi = mTowerGeom->GetPhi(towerID);  // (0, 2pi)
+  double eta = mTowerGeom->GetEta(towerID);
 
   // check for bad (and dead) towers
   bool TowerOK = mBaseMaker->IsTowerOK(towerID);      // kTRUE means GOOD
@@ -1519,24 +1801,15 @@ Bool_t StJetMakerTask::GetMomentum(TVector3 &mom, const StPicoBTowHit *tower, Do
   Double_t p = 1.0*TMath::Sqrt(energy*energy - mass*mass);
 
   // tower ID - passed into function
-  // get tower position
-  TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-  double posX = towerPosition.x();
-  double posY = towerPosition.y();
-  double posZ = towerPosition.z();
-
-  // shouldn't need correction with above method
-//  posX-=xVtx;
-//  posY-=yVtx;
-//  posZ-=zVtx;
-
-  // get r, set position components
-  Double_t r = TMath::Sqrt(posX*posX + posY*posY + posZ*posZ) ;
-  if(r > 1e-12) {
-    mom.SetX( p*posX/r );
-    mom.SetY( p*posY/r );
-    mom.SetZ( p*posZ/r );
-  } else { return kFALSE; }
+  // unit vector from vertex to tower, precomputed for this vertex
+  if(towerID < 1 || towerID > StBemcTowerGeometry::kNTowers) return kFALSE;
+  double ux = mTowerGeom->GetUx(towerID);
+  double uy = mTowerGeom->GetUy(towerID);
+  double uz = mTowerGeom->GetUz(towerID);
+
+  // set momentum components along tower direction
+  if(ux == 0. && uy == 0. && uz == 0.) return kFALSE;
+  mom.SetXYZ( p*ux, p*uy, p*uz );
 
   return kTRUE;
 }
@@ -1603,14 +1876,58 @@ void StJetMakerTask::FillEmcTriggersArr() {
 */
 //==========
 //
+// Function: get the shared track cache (StTrackCacheMaker)
+// returns 0x0 if it is not in the chain, was not filled for the current event,
+// or was filled with a different track type (primary/global) than this maker uses
+//_________________________________________________________________________________________________
+StTrackCacheMaker *StJetMakerTask::GetTrackCache()
+{
+  StTrackCacheMaker *cache = static_cast<StTrackCacheMaker*>(GetMaker(fTrackCacheMakerName));
+  if(!cache || !mPicoEvent) return 0x0;
+  if(!cache->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) return 0x0;
+  if(cache->GetUsePrimaryTracks() != doUsePrimTracks) return 0x0;
+
+  return cache;
+}
+//
+// Function: get the shared event selection (StEventSelectionMaker)
+// returns 0x0 if it is not in the chain, did not run for the current event,
+// or used a different track type (primary/global) than this maker uses
+//_________________________________________________________________________________________________
+StEventSelectionMaker *StJetMakerTask::GetEventSelection()
+{
+  StEventSelectionMaker *sel = static_cast<StEventSelectionMaker*>(GetMaker(fEventSelectionMakerName));
+  if(!sel || !mPicoEvent) return 0x0;
+  if(!sel->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) return 0x0;
+  if(sel->GetUsePrimaryTracks() != doUsePrimTracks) return 0x0;
+
+  return sel;
+}
+//
 // Function: Returns pt of hardest track in the event
 //_________________________________________________________________________________________________
 Double_t StJetMakerTask::GetMaxTrackPt()
 {
+  // use shared event selection if it already ran for this event with the same track cuts - AcceptTrack() has no pt cut
+  StEventSelectionMaker *sel = GetEventSelection();
+  if(sel && sel->HasMaxTrackPtCuts(doUsePrimTracks, StEventSelectionMaker::kMaxTrackPtCutMin, StEventSelectionMaker::kMaxTrackPtCutMax,
+                                   fTrackEtaMin, fTrackEtaMax, fTrackPhiMin, fTrackPhiMax,
+                                   fJetTrackDCAcut, fJetTracknHitsFit, fJetTracknHitsRatio)) return sel->GetCachedMaxTrackPt();
+
   // get # of tracks
   int nTrack = mPicoDst->numberOfTracks();
   double fMaxTrackPt = -99;
 
+  // use shared track cache if available
+  if(mTrackCache) {
+    for(int i = 0; i < mTrackCache->GetNumberOfTracks(); i++) {
+      if(!AcceptTrack(mTrackCache, i)) { continue; }
+      if(mTrackCache->GetPt(i) > fMaxTrackPt) { fMaxTrackPt = mTrackCache->GetPt(i); }
+    }
+
+    return fMaxTrackPt;
+  }
+
   // loop over all tracks
   for(int i = 0; i < nTrack; i++) {
     // get track pointer
@@ -1647,6 +1964,7 @@ Double_t StJetMakerTask::GetMaxTowerEt()
   // get # of towers
   int nTowers = mPicoDst->numberOfBTowHits();
   double fMaxTowerEt = -99;
+  mTowerGeom->SetVertex(mVertex);  // geometry of the base maker: recomputed only if its vertex differs from mVertex
 
   // loop over all towers
   for(int i = 0; i < nTowers; i++) {
@@ -1658,11 +1976,9 @@ Double_t StJetMakerTask::GetMaxTowerEt()
     int towerID = i+1;
     if(towerID < 0) continue;
 
-    // tower position - from vertex and ID: shouldn't need additional eta correction
-    TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-    double towerEta = towerPosition.PseudoRapidity();
+    // tower position (Et not used for now) - from vertex and ID: shouldn't need additional eta correction
     double towerEuncorr = tower->energy();               // uncorrected energy
-    double towEt = towerEuncorr / (1.0*TMath::CosH(towerEta)); // should this be used instead?
+    double towEt = towerEuncorr * mTowerGeom->GetInvCosh(towerID); // should this be used instead?
 
     // get max tower
     if(towEt > fMaxTowerEt) { fMaxTowerEt = towEt; }
@@ -10,6 +10,8 @@
 #include "StMuDSTMaker/COMMON/StMuDst.h"
 class StEmcGeom;
 class StEmcPosition2;
+class StBemcTowerGeometry;
+class StTowerMatchMap;
 
 // ROOT classes
 class TClonesArray;
@@ -34,11 +36,15 @@ class StPicoBTowHit;
 // Jet classes
 class StFJWrapper;
 class StJetUtility;
+class StTrackCacheMaker;
+class StEventSelectionMaker;
 
 // STAR includes
 #include "StFJWrapper.h"
 #include "FJ_includes.h"
 #include "StJet.h"
+#include "StJetInput.h"
+#include "StJetConstituentTable.h"
 #include "StJetFrameworkPicoBase.h"
 
 namespace fastjet {
@@ -51,11 +57,13 @@ namespace fastjet {
  * This class implements a wrapper for the FastJet jet finder. It allows to set a jet definition (jet algorithm, recombination scheme) and the
  * list of jet constituents. The jet finding is delegated to the class StFJWrapper which implements an interface to FastJet.
  *
- * The below is not functional yet:
  * The FastJet contrib utilities are available via the StJetUtility base class
  * and its derived classes. Utilities can be added via the AddUtility(StJetUtility*) method.
- * All the utilities added in the list will be executed. Users can implement new utilities
- * deriving a new class from StJetUtility to interface functionalities of the FastJet contribs.
+ * All the utilities added in the list will be executed for the accepted jets of the main jet
+ * definition, once per event. Users can implement new utilities deriving a new class from
+ * StJetUtility to interface functionalities of the FastJet contribs. Utilities needing a
+ * reclustering of the jet should use StFJWrapper::GetReclusteredJet(), shared by all of them
+ * (see StJetUtilitySubstructure.h).
  */
 
 class StJetMakerTask : public StMaker {
@@ -68,6 +76,9 @@ class StJetMakerTask : public StMaker {
     kNeutralJet
   };
 
+  // max number of additional jet definitions (radius, algorithm)
+  enum { kMaxJetConfigs = 10 };
+
   StJetMakerTask();
   StJetMakerTask(const char *name, double mintrackPt, bool dohistos, const char* outName);
   virtual ~StJetMakerTask();
@@ -112,6 +123,9 @@ class StJetMakerTask : public StMaker {
   void         SetClusName(const char *n)                 { fCaloName      = n;  }
   void         SetTracksName(const char *n)               { fTracksName    = n;  }
   void         SetJetsName(const char *n)                 { fJetsName      = n;  }
+  void         SetJetInputMakerName(const char *n)        { fJetInputMakerName = n; } // cluster input of this jet maker when it has the same cuts
+  void         SetEventSelectionMakerName(const char *n)  { fEventSelectionMakerName = n; }
+  void         SetTrackCacheMakerName(const char *n)      { fTrackCacheMakerName = n; }
   void         SetJetAlgo(Int_t a)                        { fJetAlgo          = a     ; }
   void         SetJetType(Int_t t)                        { fJetType          = t     ; }
   void         SetRecombScheme(Int_t scheme)              { fRecombScheme     = scheme; }
@@ -119,6 +133,7 @@ class StJetMakerTask : public StMaker {
   void         SetMinJetPt(Double_t j)                    { fMinJetPt         = j     ; }
   void         SetRadius(Double_t r)                      { fRadius        = r;  }
   void         SetGhostArea(Double_t gharea)              { fGhostArea        = gharea; }
+  void         SetJetAreaType(Int_t t)                    { fJetAreaType      = t     ; } // StJetFrameworkPicoBase::EJetAreaType_t
   void         SetJetEtaRange(Double_t emi, Double_t ema) { fJetEtaMin        = emi   ; fJetEtaMax = ema; }
   void         SetJetPhiRange(Double_t pmi, Double_t pma) { fJetPhiMin        = pmi   ; fJetPhiMax = pma; }
 
@@ -145,12 +160,25 @@ class StJetMakerTask : public StMaker {
   StJetUtility          *AddUtility(StJetUtility *utility);
   TObjArray             *GetUtilities()                   { return fUtilities ; }
 
+  // additional jet definitions clustered from the same input, jets in own array - algo -1: same as SetJetAlgo()
+  Int_t                  AddJetConfig(Double_t radius, Int_t algo = -1);
+  Int_t                  GetNJetConfigs() const           { return fNJetConfigs; }
+  const char            *GetJetConfigName(Int_t i) const  { return (i >= 0 && i < fNJetConfigs) ? fJetConfigName[i].Data() : ""; }
+
   // jets
   TClonesArray          *GetJets()                        { return fJets; }
+  TClonesArray          *GetJets(Int_t iconf)             { return (iconf >= 0 && iconf < fNJetConfigs) ? fJetsConfig[iconf] : 0x0; }
+  TClonesArray          *GetJets(const char *name);       // main or additional jet array by name
+  const StTowerMatchMap *GetTowerMatchMap() const         { return (mInputMatchMap) ? mInputMatchMap : mTowerMatchMap; } // built with this makers track cuts
+  Bool_t                 HasTowerMatchMapCuts(Bool_t usePrim, Double_t ptMin, Double_t ptMax, Double_t etaMin, Double_t etaMax,
+                            Double_t phiMin, Double_t phiMax, Double_t dcaMax, Int_t nHitsFitMin, Double_t nHitsRatioMin) const; // map built with these track cuts
+  const StJetInput      *GetJetInput() const              { return fJetInput; }      // input vectors prepared by this maker
+  const StJetConstituentTable *GetConstituentTable() const { return fConstituentTable; } // constituents of the jets of this event
   TClonesArray          *GetJetsBGsub()                   { return fJetsBGsub; }
 
   // getters
   Double_t               GetGhostArea()                   { return fGhostArea         ; }
+  Int_t                  GetJetAreaType()                 { return fJetAreaType       ; }
   const char            *GetJetsName()                    { return fJetsName.Data()   ; }
   const char            *GetJetsTag()                     { return fJetsTag.Data()    ; }
   Double_t               GetJetEtaMin()                   { return fJetEtaMin         ; }
@@ -161,6 +189,7 @@ class StJetMakerTask : public StMaker {
   UInt_t                 GetJetAlgo()                     { return fJetAlgo           ; }
   Int_t                  GetRecombScheme()                { return fRecombScheme      ; }
   Bool_t                 GetLegacyMode()                  { return fLegacyMode        ; }
+  Bool_t                 GetUsePrimaryTracks() const      { return doUsePrimTracks    ; }
   Double_t               GetMinJetArea()                  { return fMinJetArea        ; }
   Double_t               GetMinJetPt()                    { return fMinJetPt          ; }
   Double_t               GetRadius()                      { return fRadius            ; }
@@ -176,9 +205,6 @@ class StJetMakerTask : public StMaker {
 
   Bool_t                 IsLocked() const;
 
-  std::set<Int_t>        GetBadTowers()                   { return badTowers          ; }
-  std::set<Int_t>        GetDeadTowers()                  { return deadTowers         ; }
-
   // set hadronic correction fraction and type for matched tracks to towers
   void                   SetHadronicCorrFrac(float frac)    { mHadronicCorrFrac = frac; }
   void                   SetJetHadCorrType(Int_t hct)       { fJetHadCorrType = hct;}
@@ -187,15 +213,22 @@ class StJetMakerTask : public StMaker {
   // this 1st version is deprecated as the parameters are global for the class and already set
   void                   FindJets(TObjArray *tracks, TObjArray *towers, Int_t algo, Double_t radius);
   void                   FindJets();
+  void                   PrepareJetInput();         // fill input vectors from tracks and towers
+  const StJetInput      *GetSharedJetInput();       // input of the input maker, 0x0 if not valid for this event and cuts
+  StJetInputCuts         GetJetInputCuts() const;   // cuts the input vectors depend on
   //Int_t FindJets(); // use this if want to return NJets found
   void                   FillJetConstituents(StJet *jet, std::vector<fastjet::PseudoJet>& constituents,
                             std::vector<fastjet::PseudoJet>& constituents_sub, Int_t flag = 0, TString particlesSubName = "");
   Bool_t                 AcceptTrack(StPicoTrack *trk, Float_t B, TVector3 Vert);         // track accept cuts function
   Bool_t                 AcceptJetTrack(StPicoTrack *trk, Float_t B, TVector3 Vert);      // jet track accept cuts function
+  Bool_t                 AcceptTrack(StTrackCacheMaker *cache, Int_t itrk);               // track accept cuts function - cached track
+  Bool_t                 AcceptJetTrack(StTrackCacheMaker *cache, Int_t itrk);            // jet track accept cuts function - cached track
   Bool_t                 AcceptJetTower(StPicoBTowHit *tower, Int_t towerID);             // jet tower accept cuts function
   Int_t                  GetCentBin(Int_t cent, Int_t nBin) const;                        // centrality bin
   Bool_t                 GetMomentum(TVector3 &mom, const StPicoBTowHit *tower, Double_t mass, Int_t towerID, Double_t CorrectedEnergy) const;
   void                   FillEmcTriggersArr();
+  StTrackCacheMaker     *GetTrackCache();           // shared track cache, 0x0 if not valid for this event
+  StEventSelectionMaker *GetEventSelection();       // shared event selection, 0x0 if not valid for this event
   Double_t               GetMaxTrackPt();           // find max track pt in event
   Double_t               GetMaxTowerEt();           // find max tower Et in event
   void                   RunEventQA();              // function to fill some event QA plots
@@ -203,6 +236,8 @@ class StJetMakerTask : public StMaker {
 
   // may not need any of these except fill jet branch if I want 2 different functions
   void                   FillJetBranch();
+  void                   FillJetBranch(StFJWrapper &wrapper, TClonesArray *jets, Double_t radius);
+  void                   InitJetWrapper(StFJWrapper &wrapper, Int_t algo, Double_t radius);
   void                   FillJetBGBranch();
   void                   InitUtilities();
   void                   PrepareUtilities();
@@ -258,6 +293,9 @@ class StJetMakerTask : public StMaker {
   TString                fTracksName;             // name of track collection
   TString                fCaloName;               // name of calo cluster collection
   TString                fJetsName;               // name of jet collection
+  TString                fJetInputMakerName;      // name of jet maker providing the input vectors
+  TString                fEventSelectionMakerName; // name of shared event selection maker
+  TString                fTrackCacheMakerName;    // name of shared track cache maker
 
   Int_t                  fJetAlgo;                // jet algorithm (kt, akt, etc)
   Int_t                  fJetType;                // jet type (full, charged, neutral)
@@ -265,6 +303,15 @@ class StJetMakerTask : public StMaker {
 
   StFJWrapper            fjw; //!fastjet wrapper
 
+  // additional jet definitions
+  Int_t                  fNJetConfigs;                      // number of additional jet definitions
+  Int_t                  fJetConfigAlgo[kMaxJetConfigs];    // jet algorithm
+  Double_t               fJetConfigRadius[kMaxJetConfigs];  // jet radius
+  TString                fJetConfigName[kMaxJetConfigs];    // name of jet array, see StJetFrameworkPicoBase::GenerateJetName()
+  StFJWrapper           *fjwConfig[kMaxJetConfigs];         //!fastjet wrapper
+  TClonesArray          *fJetsConfig[kMaxJetConfigs];       //!jet collection
+  Bool_t                 fFillJetQA;                        //!fill jet QA histograms (main jet definition only)
+
   // jet attributes
   Double_t               fRadius;                 // jet radius
   TString                fJetsTag;                // tag of jet collection (usually = "Jets")
@@ -275,6 +322,7 @@ class StJetMakerTask : public StMaker {
   Double_t               fJetEtaMin;              // minimum eta to keep jet in output
   Double_t               fJetEtaMax;              // maximum eta to keep jet in output
   Double_t               fGhostArea;              // ghost area
+  Int_t                  fJetAreaType;            // jet area type, see StJetFrameworkPicoBase::EJetAreaType_t
 
   // track attributes
   Double_t               fMinJetTrackPt;          // min jet track transverse momentum cut
@@ -307,7 +355,7 @@ class StJetMakerTask : public StMaker {
   Int_t                  fJetHadCorrType;         // hadronic correction type to be used
 
   // may not need some of next bools
-  TObjArray             *fUtilities;              // jet utilities (gen subtractor, constituent subtractor etc.)
+  TObjArray             *fUtilities;              // jet utilities (substructure, gen subtractor etc.), owned
   Bool_t                 fLocked;                 // true if lock is set
   Bool_t                 fIsInit;                 //!=true if already initialized
   Bool_t                 fLegacyMode;             //!=true to enable FJ 2.x behavior
@@ -334,17 +382,23 @@ class StJetMakerTask : public StMaker {
   StPicoEvent           *mPicoEvent;              // PicoEvent object
   StCentMaker           *mCentMaker;              // Centrality maker object
   StJetFrameworkPicoBase *mBaseMaker;             // Base class object
+  StTrackCacheMaker     *mTrackCache;             // shared track cache object (0x0 if not available)
 
   // position objection
   StEmcPosition2        *mEmcPosition;            // Emc position object
+  StBemcTowerGeometry   *mTowerGeom;              // precomputed tower eta/phi/cosh for current vertex - owned by the base maker
 
   // centrality objects
   StRefMultCorr         *grefmultCorr;
 
-//  Double_t                mTowerMatchTrkIndex[4800];
-//  Bool_t                 mTowerStatusArr[4800];
-  Double_t               mTowerMatchTrkIndex[4800][7];
-  Int_t                  mTowerStatusArr[4800];
+  // track-tower matches for hadronic correction (CSR format, E sum and max per tower)
+  StTowerMatchMap       *mTowerMatchMap;
+
+  // input vectors prepared by this maker, and track-tower matches of the input used this event
+  // constituent table of the input used this event - jets keep index spans into it
+  StJetInput            *fJetInput;
+  StJetConstituentTable *fConstituentTable;
+  const StTowerMatchMap *mInputMatchMap;
 
   // histograms
   TH1F           *fHistMultiplicity;//!
@@ -403,16 +457,9 @@ class StJetMakerTask : public StMaker {
   TH2F           *fHistQATowIDvsEta;//!
   TH2F           *fHistQATowIDvsPhi;//!
 
-  // bad and dead tower list
-  std::set<Int_t>        badTowers; 
-  std::set<Int_t>        deadTowers;
-
-  // bad run list 
-  std::set<Int_t>        badRuns;
-
   StJetMakerTask(const StJetMakerTask&);            // not implemented
   StJetMakerTask &operator=(const StJetMakerTask&); // not implemented
 
-  ClassDef(StJetMakerTask, 4) // Jet producing task
+  ClassDef(StJetMakerTask, 7) // Jet producing task
 };
 #endif
@@ -42,12 +42,15 @@
 // tower/cluster includes
 #include "StEmcUtil/geometry/StEmcGeom.h"
 #include "StEmcPosition2.h"
+#include "StBemcTowerGeometry.h"
 
 // jet class and fastjet wrapper
 #include "StJet.h"
 #include "FJ_includes.h"
 #include "StFJWrapper.h"
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
+#include "StEventSelectionMaker.h"
 
 // centrality
 #include "StCentMaker.h"
@@ -95,6 +98,7 @@ StJetMakerTaskBGsub::StJetMakerTaskBGsub() :
   fTracksName(""),
   fCaloName(""),
   fJetsName(""),
+  fJetInputMakerName(""),
   fJetAlgo(1), 
   fJetType(0), 
   fRecombScheme(fastjet::BIpt2_scheme),
@@ -108,6 +112,7 @@ StJetMakerTaskBGsub::StJetMakerTaskBGsub() :
   fJetEtaMin(-0.6),
   fJetEtaMax(0.6),
   fGhostArea(0.005), 
+  fJetAreaType(StJetFrameworkPicoBase::kActiveExplicitGhosts),
   fMinJetTrackPt(0.2),
   fMaxJetTrackPt(30.0),
   fMinJetClusPt(0.15),
@@ -146,7 +151,9 @@ StJetMakerTaskBGsub::StJetMakerTaskBGsub() :
   mCentMaker(0x0),
   mBaseMaker(0x0),
   mEmcPosition(0x0),
-  grefmultCorr(0x0)
+  mTowerGeom(0x0),
+  grefmultCorr(0x0),
+  fJetInput(0x0)
 {
   // Default constructor.
   for(int i=0; i<8; i++) { fEmcTriggerArr[i] = kFALSE; }
@@ -190,6 +197,7 @@ StJetMakerTaskBGsub::StJetMakerTaskBGsub(const char *name, double mintrackPt = 0
   fTracksName("Tracks"),
   fCaloName("Clusters"),
   fJetsName("Jets"),
+  fJetInputMakerName(""),
   fJetAlgo(1), 
   fJetType(0),
   fRecombScheme(fastjet::BIpt_scheme),
@@ -204,6 +212,7 @@ StJetMakerTaskBGsub::StJetMakerTaskBGsub(const char *name, double mintrackPt = 0
   fJetEtaMin(-0.6), 
   fJetEtaMax(0.6),
   fGhostArea(0.005),
+  fJetAreaType(StJetFrameworkPicoBase::kActiveExplicitGhosts),
   fMinJetTrackPt(mintrackPt), //0.20
   fMaxJetTrackPt(30.0), 
   fMinJetClusPt(0.15),
@@ -242,7 +251,9 @@ StJetMakerTaskBGsub::StJetMakerTaskBGsub(const char *name, double mintrackPt = 0
   mCentMaker(0x0),
   mBaseMaker(0x0), 
   mEmcPosition(0x0),
-  grefmultCorr(0x0)
+  mTowerGeom(0x0),
+  grefmultCorr(0x0),
+  fJetInput(0x0)
 {
   // Standard constructor.
   for(int i=0; i<8; i++) { fEmcTriggerArr[i] = kFALSE; }
@@ -302,6 +313,7 @@ StJetMakerTaskBGsub::~StJetMakerTaskBGsub()
   if(fHistQATowIDvsPhi)        delete fHistQATowIDvsPhi;
 
   if(mEmcPosition)             delete mEmcPosition;
+  if(fJetInput)                delete fJetInput;
 }
 //
 //
@@ -320,6 +332,9 @@ Int_t StJetMakerTaskBGsub::Init() {
   // position object for Emc
   mEmcPosition = new StEmcPosition2();
 
+  // jet input vectors - filled per event, can be clustered by other jet makers
+  fJetInput = new StJetInput();
+
   // ============================ set jet parameters for fastjet wrapper  =======================
   // recombination schemes:
   // E_scheme, pt_scheme, pt2_scheme, Et_scheme, Et2_scheme, BIpt_scheme, BIpt2_scheme, WTA_pt_scheme, WTA_modp_scheme
@@ -348,8 +363,14 @@ Int_t StJetMakerTaskBGsub::Init() {
   if (fJetAlgo == 999)    algorithm = fastjet::undefined_jet_algorithm;
   fastjet::Strategy               strategy = fastjet::Best;
 
+  // jet area type: Voronoi and active without explicit ghosts are faster when the area is only used for rho
+  fastjet::AreaType               areaType = fastjet::active_area_explicit_ghosts;
+  if (fJetAreaType == StJetFrameworkPicoBase::kActiveArea)   areaType = fastjet::active_area;
+  if (fJetAreaType == StJetFrameworkPicoBase::kVoronoiArea)  areaType = fastjet::voronoi_area;
+
   // setup fj wrapper
-  fjw.SetAreaType(fastjet::active_area_explicit_ghosts);
+  fjw.SetAreaType(areaType);
+  fjw.SetUseFixedGhosts(fJetAreaType == StJetFrameworkPicoBase::kActiveFixedGhosts);
   fjw.SetStrategy(strategy);
   fjw.SetGhostArea(fGhostArea);
   fjw.SetR(fRadius);
@@ -539,15 +560,14 @@ int StJetMakerTaskBGsub::Make()
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-  deadTowers = mBaseMaker->GetDeadTowers();
-  badTowers = mBaseMaker->GetBadTowers();
+  // tower positions - geometry is owned by the base maker and shared, vertex-corrected arrays are filled per event
+  mTowerGeom = mBaseMaker->GetTowerGeometry();
 
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 30.0 GeV
@@ -566,6 +586,9 @@ int StJetMakerTaskBGsub::Make()
   // Z-vertex cut - - per the Aj analysis (-40, 40)
   if((zVtx < fEventZVtxMinCut) || (zVtx > fEventZVtxMaxCut)) return kStOk; //Pico::kSkipThisEvent;
 
+  // tower eta, phi, 1/cosh(eta) and direction for this vertex - one pass over all towers
+  mTowerGeom->SetVertex(mVertex);
+
   // ============================ CENTRALITY ============================== //
   // get CentMaker pointer
   mCentMaker = static_cast<StCentMaker*>(GetMaker("CentMaker"));
@@ -604,10 +627,11 @@ int StJetMakerTaskBGsub::Make()
   // check for MB and HT triggers - Type Flag corresponds to selected type of MB or EMC
   // NEED to ADD new triggers and runs to StJetFrameworkPicoBase class !!
   // different access method because this class doesn't inherit from base
-  bool fHaveMBevent    = mBaseMaker->CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event   = mBaseMaker->CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event  = mBaseMaker->CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-  bool fHaveEmcTrigger = mBaseMaker->CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = mBaseMaker->GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent    = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event   = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event  = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  bool fHaveEmcTrigger = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, fEmcTriggerEventType);
   bool fHaveAnyEvent   = kTRUE;
 
   // fill trigger array
@@ -647,6 +671,122 @@ void StJetMakerTaskBGsub::FindJets()
   fjw.Clear();
   fFull_Event.clear();
 
+  // track-tower matches are needed for the jet constituents also when the input is shared
+  if((fJetType == kFullJet) || (fJetType == kNeutralJet)) FillTowerTrackMatches();
+
+  // input vectors of the input maker if prepared for this event with the same cuts, else prepare them here
+  const StJetInput *input = GetSharedJetInput();
+  if(!input) {
+    PrepareJetInput();
+    input = fJetInput;
+  }
+
+  // send input to FJ wrapper - user index is kept (tracks 0+, ghosts = -1, towers < -1)
+  fjw.AddInputVectors(input->GetVectors());
+  fFull_Event = input->GetVectors();
+
+  // run jet finder
+  fjw.Run();
+}
+//
+// Function: get the input vectors of the input maker (SetJetInputMakerName)
+// returns 0x0 if no input maker is set, it did not prepare input for the current event,
+// or prepared it with different cuts than this maker uses
+// QA histograms of the track and tower loop are only filled by the maker preparing the input
+//________________________________________________________________________
+const StJetInput *StJetMakerTaskBGsub::GetSharedJetInput()
+{
+  if(fJetInputMakerName == "" || fJetInputMakerName == GetName()) return 0x0;
+
+  StMaker *maker = GetMaker(fJetInputMakerName);
+  if(!maker || !maker->InheritsFrom("StJetMakerTaskBGsub")) return 0x0;
+
+  const StJetInput *input = static_cast<StJetMakerTaskBGsub*>(maker)->GetJetInput();
+  if(!input || !input->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) return 0x0;
+  if(!input->IsCompatible(GetJetInputCuts())) return 0x0;
+
+  return input;
+}
+//
+// Function: cuts the input vectors depend on
+// - hadronic correction with the last matched track, no efficiency correction
+//________________________________________________________________________
+StJetInputCuts StJetMakerTaskBGsub::GetJetInputCuts() const
+{
+  StJetInputCuts cuts;
+  cuts.fJetType = fJetType;
+  cuts.fUsePrimTracks = doUsePrimTracks;
+  cuts.fMinJetTrackPt = fMinJetTrackPt;
+  cuts.fMaxJetTrackPt = fMaxJetTrackPt;
+  cuts.fJetTrackEtaMin = fJetTrackEtaMin;
+  cuts.fJetTrackEtaMax = fJetTrackEtaMax;
+  cuts.fJetTrackPhiMin = fJetTrackPhiMin;
+  cuts.fJetTrackPhiMax = fJetTrackPhiMax;
+  cuts.fJetTrackDCAcut = fJetTrackDCAcut;
+  cuts.fJetTracknHitsFit = fJetTracknHitsFit;
+  cuts.fJetTracknHitsRatio = fJetTracknHitsRatio;
+  cuts.fTrackEtaMin = fTrackEtaMin;
+  cuts.fTrackEtaMax = fTrackEtaMax;
+  cuts.fTrackPhiMin = fTrackPhiMin;
+  cuts.fTrackPhiMax = fTrackPhiMax;
+  cuts.fJetTowerEtaMin = fJetTowerEtaMin;
+  cuts.fJetTowerEtaMax = fJetTowerEtaMax;
+  cuts.fJetTowerPhiMin = fJetTowerPhiMin;
+  cuts.fJetTowerPhiMax = fJetTowerPhiMax;
+  cuts.fTowerEnergyMin = mTowerEnergyMin;
+  cuts.fHadronicCorrFrac = mHadronicCorrFrac;
+  cuts.fJetHadCorrType = StJetFrameworkPicoBase::kLastMatchedTrack;
+
+  return cuts;
+}
+//
+// Function: track-tower matches of tracks passing the quality cuts, from the BEMC PID traits
+//________________________________________________________________________
+void StJetMakerTaskBGsub::FillTowerTrackMatches()
+{
+  // ==================== March 6th, 2018
+  // towerStatus array
+  //float mTowerMatchTrkIndex[4800] = { 0 };
+  //bool mTowerStatusArr[4800] = { 0 };
+  int matchedTowerTrackCounter = 0;
+  int nBEmcPidTraits = mPicoDst->numberOfBEmcPidTraits();
+
+  // loop over ALL clusters in PicoDst to get track<->tower matches saved to arrays for hadronic correction
+  for(unsigned short iClus = 0; iClus < nBEmcPidTraits; iClus++){
+    StPicoBEmcPidTraits *cluster = static_cast<StPicoBEmcPidTraits*>(mPicoDst->bemcPidTraits(iClus));
+    if(!cluster){ cout<<"Cluster pointer does not exist.. iClus = "<<iClus<<endl; continue; }
+
+    // cluster and tower ID -  ID's are calculated as such:
+    // mBtowId       = (ntow[0] <= 0 || ntow[0] > 4800) ? -1 : (Short_t)ntow[0];
+    int towID = cluster->btowId();   // projected tower Id: 1 - 4800
+    int towIDindex = towID - 1;
+    if(towID < 0) continue;
+
+    // matched track index
+    int trackIndex = cluster->trackIndex();
+
+    // get track pointer
+    StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(trackIndex));
+    if(!trk) { cout<<"No trk pointer...."<<endl; continue; }
+
+    // apply quality cut to matched tracks
+    if(AcceptTrack(trk, Bfield, mVertex)) {
+
+      // tower status set - towerID is matched to track passing quality cuts
+      mTowerMatchTrkIndex[towIDindex] = trackIndex;
+      mTowerStatusArr[towIDindex] = kTRUE;
+      matchedTowerTrackCounter++;
+    } // when tracks meet cuts, save matching to arrays
+  } // PIDTraits loop
+}
+//
+// Function: fill input vectors from tracks + towers
+//________________________________________________________________________
+void StJetMakerTaskBGsub::PrepareJetInput()
+{
+  // input of this event and cut set
+  fJetInput->Reset(mPicoEvent->runId(), mPicoEvent->eventId(), GetJetInputCuts());
+
   // assume neutral pion mass, additional parameters constructed
   double pi = 1.0*TMath::Pi();
   double pi0mass = Pico::mMass[0]; // GeV
@@ -691,54 +831,15 @@ void StJetMakerTaskBGsub::FindJets()
       fHistNTrackvsEta->Fill(eta);
       fHistNTrackvsPhivsEta->Fill(phi, eta);
 
-      // send track info to FJ wrapper
-      //fjw.AddInputVector(px, py, pz, p, iTracks);    // p -> E
-      fjw.AddInputVector(px, py, pz, energy, iTracks); // includes E
-
-      fastjet::PseudoJet particle_Track(px, py, pz, energy);
-      particle_Track.set_user_index(iTracks);
-      fFull_Event.push_back(particle_Track);
+      // add track input vector
+      //fJetInput->Add(px, py, pz, p, iTracks);    // p -> E
+      fJetInput->Add(px, py, pz, energy, iTracks); // includes E
 
     } // track loop
   } // if full/charged jets
 
   // full or neutral jets - get towers and apply hadronic correction
   if((fJetType == kFullJet) || (fJetType == kNeutralJet)) {
-    // ==================== March 6th, 2018
-    // towerStatus array
-    //float mTowerMatchTrkIndex[4800] = { 0 };
-    //bool mTowerStatusArr[4800] = { 0 };
-    int matchedTowerTrackCounter = 0;
-    int nBEmcPidTraits = mPicoDst->numberOfBEmcPidTraits();
-  
-    // loop over ALL clusters in PicoDst to get track<->tower matches saved to arrays for hadronic correction
-    for(unsigned short iClus = 0; iClus < nBEmcPidTraits; iClus++){
-      StPicoBEmcPidTraits *cluster = static_cast<StPicoBEmcPidTraits*>(mPicoDst->bemcPidTraits(iClus));
-      if(!cluster){ cout<<"Cluster pointer does not exist.. iClus = "<<iClus<<endl; continue; }
-
-      // cluster and tower ID -  ID's are calculated as such:
-      // mBtowId       = (ntow[0] <= 0 || ntow[0] > 4800) ? -1 : (Short_t)ntow[0];
-      int towID = cluster->btowId();   // projected tower Id: 1 - 4800
-      int towIDindex = towID - 1;
-      if(towID < 0) continue;
-
-      // matched track index
-      int trackIndex = cluster->trackIndex();
-
-      // get track pointer
-      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(trackIndex));
-      if(!trk) { cout<<"No trk pointer...."<<endl; continue; }
-
-      // apply quality cut to matched tracks
-      if(AcceptTrack(trk, Bfield, mVertex)) {
-
-        // tower status set - towerID is matched to track passing quality cuts
-        mTowerMatchTrkIndex[towIDindex] = trackIndex;
-        mTowerStatusArr[towIDindex] = kTRUE;
-        matchedTowerTrackCounter++;
-      } // when tracks meet cuts, save matching to arrays
-    } // PIDTraits loop
-
     // loop over towers and add input vectors to fastjet
     int nTowers = mPicoDst->numberOfBTowHits();
     for(int itow = 0; itow < nTowers; itow++) {
@@ -752,15 +853,13 @@ void StJetMakerTaskBGsub::FindJets()
       if(towerID < 0) continue; // double check these aren't still in the event list
 
       // cluster and tower position - from vertex and ID: shouldn't need additional eta correction
-      TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-      double towerPhi = towerPosition.Phi();
-      if(towerPhi < 0.0)    towerPhi += 2.0*pi;
-      if(towerPhi > 2.0*pi) towerPhi -= 2.0*pi;
-      double towerEta = towerPosition.PseudoRapidity();
+      double towerPhi = mTowerGeom->GetPhi(towerID);          // (0, 2pi)
+      double towerEta = mTowerGeom->GetEta(towerID);
+      double towerInvCosh = mTowerGeom->GetInvCosh(towerID);  // 1/cosh(eta)
       int towerADC = tower->adc();
       double towerEunCorr = tower->energy();  // uncorrected energy
       double towerE = tower->energy();        // corrected energy (hadronically - done below)
-      double towEt = towerE / (1.0*TMath::CosH(towerEta));
+      double towEt = towerE * towerInvCosh;
 
       // fill QA histos for jet towers  
       fHistNTowervsID->Fill(towerID);
@@ -802,7 +901,7 @@ void StJetMakerTaskBGsub::FindJets()
       // else - no match so treat towers on their own
 
       // cut on transverse tower energy
-      double towerEt = towerE / (1.0*TMath::CosH(towerEta));
+      double towerEt = towerE * towerInvCosh;
       if(towerEt < 0.0) towerEt = 0.0;
       if(towerEt < mTowerEnergyMin) continue;
 
@@ -821,21 +920,13 @@ void StJetMakerTaskBGsub::FindJets()
       double towerPy = mom.y();
       double towerPz = mom.z();
 
-      // add towers to fastjet: shift tower index (tracks 0+, ghosts = -1, towers < -1)
+      // add tower input vector: shift tower index (tracks 0+, ghosts = -1, towers < -1)
       int uidTow = -(itow + 2);  
-      fjw.AddInputVector(towerPx, towerPy, towerPz, towerE, uidTow); // includes E
-
-      fastjet::PseudoJet particle_Tower(towerPx, towerPy, towerPz, towerE);
-      particle_Tower.set_user_index(uidTow);
-      fFull_Event.push_back(particle_Tower);
+      fJetInput->Add(towerPx, towerPy, towerPz, towerE, uidTow); // includes E
 
     } // tower loop
 
   } // neutral/full jets
-
-  // run jet finder
-  fjw.Run();
-
 }
 //
 /**
@@ -986,16 +1077,12 @@ void StJetMakerTaskBGsub::FillJetConstituents(StJet *jet, std::vector<fastjet::P
         if(towerID < 0) continue;
 
         // get vector to determine tower position
-        TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-        double towerPhi = towerPosition.Phi();
-        double towerEta = towerPosition.PseudoRapidity();
+        double towerPhi = mTowerGeom->GetPhi(towerID);          // (0, 2pi)
+        double towerEta = mTowerGeom->GetEta(towerID);
+        double towerInvCosh = mTowerGeom->GetInvCosh(towerID);  // 1/cosh(eta)
         double towEuncorr = tower->energy();
         double towE = tower->energy();
 
-        // shift tower phi (0, 2*pi)
-        if(towerPhi < 0.0)    towerPhi += 2.0*pi;
-        if(towerPhi > 2.0*pi) towerPhi -= 2.0*pi;
-
         // April9, need to perform hadronic correction again since StBTowHit object is not updated
         // if tower was not matched to an accepted track, use it for jet by itself if > 0.2 GeV
         if(mTowerStatusArr[towerIDindex]) {
@@ -1029,7 +1116,7 @@ void StJetMakerTaskBGsub::FillJetConstituents(StJet *jet, std::vector<fastjet::P
         // else - no match so treat towers on their own
 
         // cut on tower transverse energy - should of already been done before adding them to fastjet
-        double towEt = towE / (1.0*TMath::CosH(towerEta)); // - FIXME should we cut on tower Et or E?
+        double towEt = towE * towerInvCosh; // - FIXME should we cut on tower Et or E?
         if(towEt < 0.0) towEt = 0.0; 
         if(towEt < mTowerEnergyMin) continue;  // should make this Et TODO
         // =================================================================
@@ -1212,11 +1299,8 @@ Bool_t StJetMakerTaskBGsub::AcceptJetTower(StPicoBTowHit *tower, Int_t towerID)
   if(towerID < 0) return kFALSE; 
 
   // cluster and tower position - from vertex and ID: shouldn't need additional eta correction
-  TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-  double phi = towerPosition.Phi();
-  if(phi < 0.0)    phi += 2.0*pi;
-  if(phi > 2.0*pi) phi -= 2.0*pi;
-  double eta = towerPosition.PseudoRapidity();
+  double phi = mTowerGeom->GetPhi(towerID);  // (0, 2pi)
+  double eta = mTowerGeom->GetEta(towerID);
 
   // check for bad (and dead) towers
   bool TowerOK = mBaseMaker->IsTowerOK(towerID);      // kTRUE means GOOD
@@ -1264,24 +1348,15 @@ Bool_t StJetMakerTaskBGsub::GetMomentum(TVector3 &mom, const StPicoBTowHit *towe
   // tower ID passed in, check that we have set value
   if(towerID < 0) return kFALSE;
 
-  // get tower position
-  TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-  double posX = towerPosition.x();
-  double posY = towerPosition.y();
-  double posZ = towerPosition.z();
-
-  // shouldn't need correction with above method
-//  posX-=xVtx;
-//  posY-=yVtx;
-//  posZ-=zVtx;
-
-  // get r, set position components
-  Double_t r = TMath::Sqrt(posX*posX + posY*posY + posZ*posZ) ;
-  if(r > 1e-12) {
-    mom.SetX( p*posX/r );
-    mom.SetY( p*posY/r );
-    mom.SetZ( p*posZ/r );
-  } else { return kFALSE; }
+  // unit vector from vertex to tower, precomputed for this vertex
+  if(towerID < 1 || towerID > StBemcTowerGeometry::kNTowers) return kFALSE;
+  double ux = mTowerGeom->GetUx(towerID);
+  double uy = mTowerGeom->GetUy(towerID);
+  double uz = mTowerGeom->GetUz(towerID);
+
+  // set momentum components along tower direction
+  if(ux == 0. && uy == 0. && uz == 0.) return kFALSE;
+  mom.SetXYZ( p*ux, p*uy, p*uz );
 
   return kTRUE;
 }
@@ -1330,6 +1405,13 @@ void StJetMakerTaskBGsub::FillEmcTriggersArr() {
 //
 Double_t StJetMakerTaskBGsub::GetMaxTrackPt()
 {
+  // use shared event selection if it already ran for this event with the same track cuts - AcceptTrack() has no pt cut
+  StEventSelectionMaker *sel = static_cast<StEventSelectionMaker*>(GetMaker("EventSelectionMaker"));
+  if(sel && sel->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId()) &&
+     sel->HasMaxTrackPtCuts(doUsePrimTracks, StEventSelectionMaker::kMaxTrackPtCutMin, StEventSelectionMaker::kMaxTrackPtCutMax,
+                            fTrackEtaMin, fTrackEtaMax, fTrackPhiMin, fTrackPhiMax,
+                            fJetTrackDCAcut, fJetTracknHitsFit, fJetTracknHitsRatio)) return sel->GetCachedMaxTrackPt();
+
   // get # of tracks
   int nTrack = mPicoDst->numberOfTracks();
   double fMaxTrackPt = -99;
@@ -1372,6 +1454,7 @@ Double_t StJetMakerTaskBGsub::GetMaxTowerEt()
   // get # of towers
   int nTowers = mPicoDst->numberOfBTowHits();
   double fMaxTowerEt = -99;
+  mTowerGeom->SetVertex(mVertex);  // geometry of the base maker: recomputed only if its vertex differs from mVertex
 
   // loop over all towers
   for(int i = 0; i < nTowers; i++) {
@@ -1382,14 +1465,9 @@ Double_t StJetMakerTaskBGsub::GetMaxTowerEt()
     int towerID = i+1;
     if(towerID < 0) continue;
 
-    // tower position - from vertex and ID: shouldn't need additional eta correction
-    TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-    //double towerPhi = towerPosition.Phi();
-    //if(towerPhi < 0.0)    towerPhi += 2.0*pi;
-    //if(towerPhi > 2.0*pi) towerPhi -= 2.0*pi;
-    double towerEta = towerPosition.PseudoRapidity();
+    // tower position (Et not used for now)
     double towerEuncorr = tower->energy();               // uncorrected energy
-    double towEt = towerEuncorr / (1.0*TMath::CosH(towerEta)); // should this be used instead?
+    double towEt = towerEuncorr * mTowerGeom->GetInvCosh(towerID); // should this be used instead?
 
     // get max tower
     if(towerEuncorr > fMaxTowerEt) { fMaxTowerEt = towerEuncorr; }
@@ -1513,7 +1591,7 @@ Int_t StJetMakerTaskBGsub::FastJetBGsub(){
   //vector<fastjet::PseudoJet> fjets2 = fjw.GetInclusiveJets();
   //vector<fastjet::PseudoJet> full_jets2 = fjets2.inclusive_jets(fMinJetPt);
   static Int_t indexes[9999] = {-1};
-  fastjet::ClusterSequenceArea *fClusterSequence = fjw.GetClusterSequence();
+  fastjet::ClusterSequenceAreaBase *fClusterSequence = fjw.GetClusterSequenceAreaBase();
   vector<fastjet::PseudoJet> full_jets2 = fClusterSequence->inclusive_jets(fMinJetPt);
   GetSortedArray(indexes, full_jets2);
   for(unsigned int ij = 0; ij < full_jets2.size(); ij++) {
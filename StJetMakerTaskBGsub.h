@@ -10,6 +10,7 @@
 ///#include "StMuDSTMaker/COMMON/StMuDst.h"
 class StEmcGeom;
 class StEmcPosition2;
+class StBemcTowerGeometry;
 
 // ROOT classes
 class TClonesArray;
@@ -42,6 +43,7 @@ class StCentMaker;
 #include "StFJWrapper.h"
 #include "FJ_includes.h"
 #include "StJet.h"
+#include "StJetInput.h"
 #include "StJetFrameworkPicoBase.h"
 
 namespace fastjet {
@@ -94,6 +96,7 @@ class StJetMakerTaskBGsub : public StMaker {
   void                 SetClusName(const char *n)                 { fCaloName      = n;  }
   void                 SetTracksName(const char *n)               { fTracksName    = n;  }
   void                 SetJetsName(const char *n)                 { fJetsName      = n;  }
+  void                 SetJetInputMakerName(const char *n)        { fJetInputMakerName = n; } // cluster input of this jet maker when it has the same cuts
   void                 SetJetAlgo(Int_t a)                        { fJetAlgo          = a     ; }
   void                 SetJetType(Int_t t)                        { fJetType          = t     ; }
   void                 SetRecombScheme(Int_t scheme)              { fRecombScheme     = scheme; }
@@ -101,6 +104,7 @@ class StJetMakerTaskBGsub : public StMaker {
   void                 SetMinJetPt(Double_t j)                    { fMinJetPt         = j     ; }
   void                 SetRadius(Double_t r)                      { fRadius        = r;  }
   void                 SetGhostArea(Double_t gharea)              { fGhostArea        = gharea; }
+  void                 SetJetAreaType(Int_t t)                    { fJetAreaType      = t     ; } // StJetFrameworkPicoBase::EJetAreaType_t
   void                 SetJetEtaRange(Double_t emi, Double_t ema) { fJetEtaMin        = emi   ; fJetEtaMax = ema; }
   void                 SetJetPhiRange(Double_t pmi, Double_t pma) { fJetPhiMin        = pmi   ; fJetPhiMax = pma; }
 
@@ -135,9 +139,11 @@ class StJetMakerTaskBGsub : public StMaker {
   // jets
   TClonesArray        *GetJets()                        { return fJets; }
   TClonesArray        *GetJetsBGsub()                   { return fJetsBGsub; }
+  const StJetInput    *GetJetInput() const              { return fJetInput; }  // input vectors prepared by this maker
  
   // getters
   Double_t             GetGhostArea()                   { return fGhostArea         ; }
+  Int_t                GetJetAreaType()                 { return fJetAreaType       ; }
   const char          *GetJetsName()                    { return fJetsName.Data()   ; }
   const char          *GetJetsTag()                     { return fJetsTag.Data()    ; }
   Double_t             GetJetEtaMin()                   { return fJetEtaMin         ; }
@@ -170,6 +176,10 @@ class StJetMakerTaskBGsub : public StMaker {
   // this 1st version is deprecated as the parameters are global for the class and already set
   void                 FindJets(TObjArray *tracks, TObjArray *clus, Int_t algo, Double_t radius);
   void                 FindJets();
+  void                 FillTowerTrackMatches();       // track-tower matches for the hadronic correction
+  void                 PrepareJetInput();             // fill input vectors from tracks and towers
+  const StJetInput    *GetSharedJetInput();           // input of the input maker, 0x0 if not valid for this event and cuts
+  StJetInputCuts       GetJetInputCuts() const;       // cuts the input vectors depend on
   void                 FillJetConstituents(StJet *jet, std::vector<fastjet::PseudoJet>& constituents,
                           std::vector<fastjet::PseudoJet>& constituents_sub, Int_t flag = 0, TString particlesSubName = "");
   Bool_t               AcceptTrack(StPicoTrack *trk, Float_t B, TVector3 Vert);         // track accept cuts function
@@ -238,6 +248,7 @@ class StJetMakerTaskBGsub : public StMaker {
   TString              fTracksName;             // name of track collection
   TString              fCaloName;               // name of calo cluster collection
   TString              fJetsName;               // name of jet collection
+  TString              fJetInputMakerName;      // name of jet maker providing the input vectors
 
   Int_t                fJetAlgo;                // jet algorithm (kt, akt, etc)
   Int_t                fJetType;                // jet type (full, charged, neutral)
@@ -256,6 +267,7 @@ class StJetMakerTaskBGsub : public StMaker {
   Double_t             fJetEtaMin;              // minimum eta to keep jet in output
   Double_t             fJetEtaMax;              // maximum eta to keep jet in output
   Double_t             fGhostArea;              // ghost area
+  Int_t                fJetAreaType;            // jet area type, see StJetFrameworkPicoBase::EJetAreaType_t
 
   // track attributes
   Double_t             fMinJetTrackPt;          // min jet track transverse momentum cut
@@ -313,6 +325,7 @@ class StJetMakerTaskBGsub : public StMaker {
 
   // position object
   StEmcPosition2      *mEmcPosition;
+  StBemcTowerGeometry *mTowerGeom;    // precomputed tower eta/phi/cosh for current vertex - owned by the base maker
 
   // centrality objects
   StRefMultCorr       *grefmultCorr;
@@ -320,6 +333,9 @@ class StJetMakerTaskBGsub : public StMaker {
   Float_t              mTowerMatchTrkIndex[4800];
   Bool_t               mTowerStatusArr[4800];
 
+  // input vectors prepared by this maker
+  StJetInput          *fJetInput;
+
   // histograms
   TH1F           *fHistMultiplicity;//!
   TH1F           *fHistCentrality;//!
@@ -360,16 +376,9 @@ class StJetMakerTaskBGsub : public StMaker {
   TH2F           *fHistQATowIDvsEta;//!
   TH2F           *fHistQATowIDvsPhi;//!
 
-  // bad and dead tower list
-  std::set<Int_t>        badTowers;
-  std::set<Int_t>        deadTowers;
-
-  // bad run list 
-  std::set<Int_t>        badRuns;
-
   StJetMakerTaskBGsub(const StJetMakerTaskBGsub&);            // not implemented
   StJetMakerTaskBGsub &operator=(const StJetMakerTaskBGsub&); // not implemented
 
-  ClassDef(StJetMakerTaskBGsub, 2) // Jet producing task with bg sub
+  ClassDef(StJetMakerTaskBGsub, 4) // Jet producing task with bg sub
 };
 #endif
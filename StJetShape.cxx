@@ -20,6 +20,264 @@ using namespace std;
 
 #ifdef FASTJET_VERSION
 
+//________________________________________________________________________
+StJetShapeKernel::StJetShapeKernel(Double_t rMax, Double_t drStep, Int_t nSubBins) :
+  fRMax(rMax), fDRStep(drStep), fNR(TMath::Nint(rMax/drStep)), fBinWidth(drStep/TMath::Max(nSubBins, 1)), fNBins(0),
+  fNumTable(), fDenTable(), fPt(), fEta(), fPhi(), fPx(), fPy(), fPz(), fPairDR(), fPairW(), fPairBins(),
+  fMass(0), fAngularity(0), fpTD(0), fCircularity(0), fSigma2(0), fLeSub(0), fNConstituents(0),
+  fGRNum(fNR, 0.), fGRDen(fNR, 0.)
+{
+  // pairs beyond rMax + 6 sigma do not contribute to any radius
+  fNBins = TMath::CeilNint((fRMax + 6.*fDRStep)/fBinWidth) + 1;
+  fPairBins.assign(fNBins, 0.);
+
+  // kernels of StJetShapeGRNum and StJetShapeGRDen at the bin centres
+  fNumTable.resize(fNBins*fNR);
+  fDenTable.resize(fNBins*fNR);
+  for(Int_t ib = 0; ib < fNBins; ib++) {
+    Double_t dr = (ib + 0.5)*fBinWidth;
+    for(Int_t ir = 0; ir < fNR; ir++) {
+      Double_t x = ir*fDRStep - dr;
+      fNumTable[ib*fNR + ir] = TMath::Exp(-x*x/(2*fDRStep*fDRStep))/(TMath::Sqrt(2.*TMath::Pi())*fDRStep);
+      fDenTable[ib*fNR + ir] = 0.5*(1.+TMath::Erf(x/(TMath::Sqrt(2.)*fDRStep)));
+    }
+  }
+}
+
+//________________________________________________________________________
+void StJetShapeKernel::Process(const fastjet::PseudoJet &jet) {
+  fMass = jet.m();
+  fAngularity = fpTD = fCircularity = fSigma2 = fLeSub = 0;
+  fNConstituents = 0;
+  for(Int_t ir = 0; ir < fNR; ir++) { fGRNum[ir] = 0; fGRDen[ir] = 0; }
+  if (!jet.has_constituents()) return;
+
+  // extract constituents once
+  std::vector<fastjet::PseudoJet> constits = jet.constituents();
+  Int_t n = constits.size();
+  fNConstituents = n;
+  fPt.resize(n); fEta.resize(n); fPhi.resize(n);
+  fPx.resize(n); fPy.resize(n); fPz.resize(n);
+  for(Int_t ic = 0; ic < n; ic++) {
+    fPt[ic]  = constits[ic].perp();
+    fEta[ic] = constits[ic].eta();
+    fPhi[ic] = constits[ic].phi();
+    fPx[ic]  = constits[ic].px();
+    fPy[ic]  = constits[ic].py();
+    fPz[ic]  = constits[ic].pz();
+  }
+
+  ProcessShapes(jet);
+  ProcessGR();
+}
+
+//________________________________________________________________________
+void StJetShapeKernel::ProcessShapes(const fastjet::PseudoJet &jet) {
+  // one pass for angularity, pTD, sigma2 and circularity moments and the two leading pt
+  Double_t jetEta = jet.eta();
+  Double_t jetPhi = jet.phi();
+
+  // 2 general normalized vectors perpendicular to the jet (StJetShapeCircularity)
+  Double_t pxjet = jet.px(), pyjet = jet.py(), pzjet = jet.pz();
+  TVector3 ppJ3(- pxjet* pzjet, - pyjet * pzjet, pxjet * pxjet + pyjet * pyjet);
+  ppJ3.SetMag(1.);
+  TVector3 ppJ2(-pyjet, pxjet, 0);
+  ppJ2.SetMag(1.);
+
+  Double_t sumPt = 0., sumPt2 = 0., angNum = 0.;
+  Double_t sxx = 0., syy = 0., sxy = 0.;
+  Double_t cxx = 0., cyy = 0., cxy = 0., csum = 0.;
+  Bool_t   circOK = kTRUE;
+  Double_t pt1 = 0., pt2 = 0.;
+  for(Int_t ic = 0; ic < fNConstituents; ic++) {
+    Double_t pt = fPt[ic];
+    Double_t dphi = fPhi[ic] - jetPhi;
+    if(dphi < -1.*TMath::Pi()) dphi += TMath::TwoPi();
+    if(dphi > TMath::Pi())     dphi -= TMath::TwoPi();
+    Double_t deta = fEta[ic] - jetEta;
+    Double_t pt2w = pt*pt;
+
+    sumPt  += pt;
+    sumPt2 += pt2w;
+    angNum += pt*TMath::Sqrt(deta*deta + dphi*dphi);
+
+    sxx += pt2w*deta*deta;
+    syy += pt2w*dphi*dphi;
+    sxy -= pt2w*deta*TMath::Abs(dphi);
+
+    // projection of the momentum perpendicular to the jet onto the two vectors
+    Double_t ppjX = fPx[ic]*ppJ2.X() + fPy[ic]*ppJ2.Y();
+    Double_t ppjY = fPx[ic]*ppJ3.X() + fPy[ic]*ppJ3.Y() + fPz[ic]*ppJ3.Z();
+    Double_t ppjT = TMath::Sqrt(ppjX*ppjX + ppjY*ppjY);
+    if(ppjT <= 0) circOK = kFALSE;
+    else {
+      cxx += ppjX*ppjX/ppjT;
+      cyy += ppjY*ppjY/ppjT;
+      cxy += ppjX*ppjY/ppjT;
+      csum += ppjT;
+    }
+
+    if(pt > pt1)      { pt2 = pt1; pt1 = pt; }
+    else if(pt > pt2) { pt2 = pt; }
+  }
+
+  if(sumPt > 0) {
+    fAngularity = angNum/sumPt;
+    fpTD = TMath::Sqrt(sumPt2)/sumPt;
+  }
+  if(fNConstituents >= 2) fLeSub = TMath::Abs(pt1 - pt2);
+
+  // smaller eigenvalue of the symmetric 2x2 moment matrices
+  if(fNConstituents >= 2 && sumPt2 > 0) {
+    Double_t lmin = 0.5*(sxx + syy) - TMath::Sqrt(0.25*(sxx - syy)*(sxx - syy) + sxy*sxy);
+    fSigma2 = TMath::Sqrt(TMath::Abs(lmin)/sumPt2);
+  }
+  if(fNConstituents >= 2 && circOK && csum > 0) {
+    cxx /= csum; cyy /= csum; cxy /= csum;
+    Double_t lmin = 0.5*(cxx + cyy) - TMath::Sqrt(0.25*(cxx - cyy)*(cxx - cyy) + cxy*cxy);
+    fCircularity = 2*lmin;
+  }
+}
+
+//________________________________________________________________________
+void StJetShapeKernel::ProcessGR() {
+  // one pair sweep: dR and weight per pair, then deposit into dR bins
+  Int_t n = fNConstituents;
+  if(n < 2) return;
+  if((Int_t)fPairDR.size() < n) { fPairDR.resize(n); fPairW.resize(n); }
+  for(Int_t ib = 0; ib < fNBins; ib++) fPairBins[ib] = 0.;
+
+  const Double_t twoPi = TMath::TwoPi();
+  const Double_t pi = TMath::Pi();
+  const Double_t invBin = 1./fBinWidth;
+  Double_t *dr = &fPairDR[0];
+  Double_t *w = &fPairW[0];
+  for(Int_t i = 0; i < n - 1; i++) {
+    const Double_t eta = fEta[i], phi = fPhi[i], pt = fPt[i];
+    const Double_t *etaj = &fEta[i + 1];
+    const Double_t *phij = &fPhi[i + 1];
+    const Double_t *ptj  = &fPt[i + 1];
+    Int_t m = n - i - 1;
+
+    // no branches or calls besides sqrt - vectorized by the compiler
+    for(Int_t j = 0; j < m; j++) {
+      Double_t deta = eta - etaj[j];
+      Double_t dphi = TMath::Abs(phi - phij[j]);
+      dphi = (dphi > pi) ? twoPi - dphi : dphi;
+      Double_t dr2 = deta*deta + dphi*dphi;
+      dr[j] = TMath::Sqrt(dr2);
+      w[j] = pt*ptj[j]*dr2;
+    }
+
+    // share between the two nearest bin centres
+    for(Int_t j = 0; j < m; j++) {
+      Double_t x = dr[j]*invBin - 0.5;
+      if(x >= fNBins - 1) continue;
+      if(x < 0) { fPairBins[0] += w[j]; continue; }
+      Int_t ib = (Int_t)x;
+      Double_t f = x - ib;
+      fPairBins[ib]     += w[j]*(1. - f);
+      fPairBins[ib + 1] += w[j]*f;
+    }
+  }
+
+  // fold with the kernels for all radii
+  for(Int_t ib = 0; ib < fNBins; ib++) {
+    Double_t wb = fPairBins[ib];
+    if(wb == 0) continue;
+    const Double_t *num = &fNumTable[ib*fNR];
+    const Double_t *den = &fDenTable[ib*fNR];
+    for(Int_t ir = 0; ir < fNR; ir++) {
+      fGRNum[ir] += wb*num[ir];
+      fGRDen[ir] += wb*den[ir];
+    }
+  }
+}
+
+//________________________________________________________________________
+void StJetNsubjettiness::Compute(const fastjet::PseudoJet &jet, Double_t tau[], Int_t nmax, Double_t *openingAngle) const {
+  if (nmax > kMaxN) nmax = kMaxN;
+  for (Int_t n = 0; n < nmax; n++) tau[n] = 0;
+  if (openingAngle) *openingAngle = -2;
+  if (!jet.has_constituents()) return;
+
+  std::vector<fastjet::PseudoJet> constits = jet.constituents();
+  Int_t nconst = constits.size();
+  Double_t norm = 0.;
+  for (Int_t ic = 0; ic < nconst; ic++) norm += constits[ic].perp();
+  norm *= TMath::Power(fJetR, fBeta);
+  if (nconst == 0 || norm <= 0) return;
+
+  // a jet from a C/A clustering of its constituents (StFJWrapper::GetReclusteredJet) already has
+  // the C/A axes as its exclusive subjets, it is not reclustered again
+  Bool_t useJetCS = (fAxes == kCAAxes && jet.has_valid_cluster_sequence() &&
+                     jet.validated_cs()->jet_def().jet_algorithm() == fastjet::cambridge_algorithm);
+
+  // otherwise one reclustering of the jet constituents for the axes of all N
+  fastjet::ClusterSequence *clustSeq = 0;
+  if (!useJetCS) {
+    fastjet::JetAlgorithm algo = fastjet::kt_algorithm;
+    if (fAxes == kCAAxes) algo = fastjet::cambridge_algorithm;
+    if (fAxes == kAntiKtAxes) algo = fastjet::antikt_algorithm;
+    Double_t R = (fAxes == kAntiKtAxes) ? fSubR : fastjet::JetDefinition::max_allowable_R;
+    fastjet::JetDefinition jetDef(algo, R, fastjet::E_scheme, fastjet::Best);
+    clustSeq = new fastjet::ClusterSequence(constits, jetDef);
+  }
+
+  std::vector<fastjet::PseudoJet> subjets;
+  if (fAxes == kAntiKtAxes) subjets = fastjet::sorted_by_pt(clustSeq->inclusive_jets());
+
+  std::vector<fastjet::PseudoJet> axes;
+  for (Int_t n = 1; n <= nmax || (openingAngle && n <= 2); n++) {
+    // N hardest anti-kt subjets or N exclusive subjets
+    if (fAxes == kAntiKtAxes) {
+      axes.assign(subjets.begin(), subjets.begin() + TMath::Min(n, (Int_t)subjets.size()));
+    } else {
+      if (n > nconst) break;
+      axes = useJetCS ? jet.exclusive_subjets_up_to(n) : clustSeq->exclusive_jets(n);
+    }
+
+    if (n == 2 && openingAngle && axes.size() > 1) {
+      Double_t dEta = axes[0].pseudorapidity() - axes[1].pseudorapidity();
+      Double_t dPhi = TVector2::Phi_mpi_pi(axes[0].phi() - axes[1].phi());
+      *openingAngle = TMath::Sqrt(dEta*dEta + dPhi*dPhi);
+    }
+
+    // each constituent is an axis
+    if (n > nmax || n >= nconst) continue;
+
+    Double_t sum = 0.;
+    for (Int_t ic = 0; ic < nconst; ic++) {
+      Double_t dR2min = 1e10;
+      for (UInt_t k = 0; k < axes.size(); k++) {
+        Double_t dR2 = constits[ic].squared_distance(axes[k]);
+        if (dR2 < dR2min) dR2min = dR2;
+      }
+      sum += constits[ic].perp() * TMath::Power(dR2min, 0.5*fBeta);
+    }
+    tau[n - 1] = sum / norm;
+  }
+
+  if (clustSeq) delete clustSeq;
+}
+
+//________________________________________________________________________
+Double32_t StJetNsubjettiness::Tau(const fastjet::PseudoJet &jet, Int_t N) const {
+  if (N < 1 || N > kMaxN) return -1;
+
+  Double_t tau[kMaxN];
+  Compute(jet, tau, N);
+  return tau[N - 1];
+}
+
+//________________________________________________________________________
+Double32_t StJetNsubjettiness::OpeningAngle(const fastjet::PseudoJet &jet) const {
+  Double_t tau[kMaxN];
+  Double_t angle = -2;
+  Compute(jet, tau, 0, &angle);
+  return angle;
+}
+
 //________________________________________________________________________
 Double32_t StJetShapeGRNum::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents())
@@ -233,44 +491,32 @@ Double32_t StJetShapeSigma2::result(const fastjet::PseudoJet &jet) const {
 Double32_t StJetShape1subjettiness_kt::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(1,0,0.2,1.0,0.4,jet,0);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kKtAxes, 1.0, 0.4, 0.2);
+  return nSub.Tau(jet, 1);
 }
 
 //____________________________________________________________________________
 Double32_t StJetShape2subjettiness_kt::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(2,0,0.2,1.0,0.4,jet,0);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kKtAxes, 1.0, 0.4, 0.2);
+  return nSub.Tau(jet, 2);
 }
 
 //____________________________________________________________________________
 Double32_t StJetShape3subjettiness_kt::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(3,0,0.2,1.0,0.4,jet,0);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kKtAxes, 1.0, 0.4, 0.2);
+  return nSub.Tau(jet, 3);
 }
 
 //____________________________________________________________________________
 Double32_t StJetShapeOpeningAngle_kt::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(2,0,0.2,1.0,0.4,jet,1);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kKtAxes, 1.0, 0.4, 0.2);
+  return nSub.OpeningAngle(jet);
 }
 
 // =====
@@ -278,66 +524,48 @@ Double32_t StJetShapeOpeningAngle_kt::result(const fastjet::PseudoJet &jet) cons
 Double32_t StJetShape1subjettiness_ca::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(1,1,0.2,1.0,0.4,jet,0);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kCAAxes, 1.0, 0.4, 0.2);
+  return nSub.Tau(jet, 1);
 }
 
 //____________________________________________________________________________
 Double32_t StJetShape2subjettiness_ca::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(2,1,0.2,1.0,0.4,jet,0);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kCAAxes, 1.0, 0.4, 0.2);
+  return nSub.Tau(jet, 2);
 }
 
 //____________________________________________________________________________
 Double32_t StJetShapeOpeningAngle_ca::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(2,1,0.2,1.0,0.4,jet,1);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kCAAxes, 1.0, 0.4, 0.2);
+  return nSub.OpeningAngle(jet);
 }
 
 //____________________________________________________________________________
 Double32_t StJetShape1subjettiness_akt02::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(1,2,0.2,1.0,0.4,jet,0);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kAntiKtAxes, 1.0, 0.4, 0.2);
+  return nSub.Tau(jet, 1);
 }
 
 //____________________________________________________________________________
 Double32_t StJetShape2subjettiness_akt02::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(2,2,0.2,1.0,0.4,jet,0);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kAntiKtAxes, 1.0, 0.4, 0.2);
+  return nSub.Tau(jet, 2);
 }
 
 //____________________________________________________________________________
 Double32_t StJetShapeOpeningAngle_akt02::result(const fastjet::PseudoJet &jet) const {
   if (!jet.has_constituents()) 
     return 0;
-  StFJWrapper *fFastjetWrapper = new StFJWrapper("FJWrapper", "FJWrapper");
-  Double32_t Result = fFastjetWrapper->StFJWrapper::NSubjettinessDerivativeSub(2,2,0.2,1.0,0.4,jet,1);
-  fFastjetWrapper->Clear();
-  delete fFastjetWrapper;
-  return Result;
+  StJetNsubjettiness nSub(StJetNsubjettiness::kAntiKtAxes, 1.0, 0.4, 0.2);
+  return nSub.OpeningAngle(jet);
 }
 
 //____________________________________________________________________________
@@ -116,6 +116,109 @@ class StJetShapeLeSub : public fastjet::FunctionOfPseudoJet<Double32_t>{
   }
 };
 
+//__________________________________________________________________________
+// fused jet shape kernel: the constituents are extracted once into arrays (pt, eta, phi, px, py, pz)
+// and all first-order shapes (as StJetShapeAngularity, pTD, Circularity, Sigma2, Constituent, LeSub,
+// Mass) come out of one pass over them. The GR numerator and denominator (StJetShapeGRNum/GRDen) for
+// all radii r = ir*drStep, ir < Nint(rMax/drStep), come from one pair sweep: pair weights pt_i pt_j dR^2
+// are binned in dR (each shared linearly between the two nearest of nSubBins bins per drStep) and folded
+// with tabulated Gaussian/erf kernels, instead of an exp/erf per pair and radius.
+// Memory is kept between jets: use one kernel per thread
+class StJetShapeKernel
+{
+ public:
+  StJetShapeKernel(Double_t rMax = 2., Double_t drStep = 0.04, Int_t nSubBins = 10);
+
+  void       Process(const fastjet::PseudoJet &jet);
+
+  // first-order shapes of the last processed jet
+  Double_t   GetMass()                      const { return fMass;          }
+  Double_t   GetAngularity()                const { return fAngularity;    }
+  Double_t   GetpTD()                       const { return fpTD;           }
+  Double_t   GetCircularity()               const { return fCircularity;   }
+  Double_t   GetSigma2()                    const { return fSigma2;        }
+  Double_t   GetLeSub()                     const { return fLeSub;         }
+  Int_t      GetNConstituents()             const { return fNConstituents; }
+
+  // GR of the last processed jet at r = ir*drStep
+  Int_t      GetNGR()                       const { return fNR;            }
+  Double_t   GetGRRadius(Int_t ir)          const { return ir*fDRStep;     }
+  Double_t   GetGRNumerator(Int_t ir)       const { return fGRNum[ir];     }
+  Double_t   GetGRDenominator(Int_t ir)     const { return fGRDen[ir];     }
+  const std::vector<Double_t>& GetGRNumerator()   const { return fGRNum; }
+  const std::vector<Double_t>& GetGRDenominator() const { return fGRDen; }
+
+ protected:
+  void       ProcessShapes(const fastjet::PseudoJet &jet);
+  void       ProcessGR();
+
+  Double_t   fRMax;                    // max GR radius
+  Double_t   fDRStep;                  // GR radius step and kernel width
+  Int_t      fNR;                      // number of GR radii
+  Double_t   fBinWidth;                // pair dR bin width
+  Int_t      fNBins;                   // number of pair dR bins
+  std::vector<Double_t> fNumTable;     // Gaussian kernel [bin*fNR + ir]
+  std::vector<Double_t> fDenTable;     // erf kernel [bin*fNR + ir]
+
+  // constituents
+  std::vector<Double_t> fPt;
+  std::vector<Double_t> fEta;
+  std::vector<Double_t> fPhi;
+  std::vector<Double_t> fPx;
+  std::vector<Double_t> fPy;
+  std::vector<Double_t> fPz;
+
+  // pair sweep buffers
+  std::vector<Double_t> fPairDR;
+  std::vector<Double_t> fPairW;
+  std::vector<Double_t> fPairBins;
+
+  // results
+  Double_t   fMass;
+  Double_t   fAngularity;
+  Double_t   fpTD;
+  Double_t   fCircularity;
+  Double_t   fSigma2;
+  Double_t   fLeSub;
+  Int_t      fNConstituents;
+  std::vector<Double_t> fGRNum;
+  std::vector<Double_t> fGRDen;
+};
+
+//__________________________________________________________________________
+// per-jet N-subjettiness with normalized measure: tau_N = sum_i pt_i min_k dR(i,k)^beta / sum_i pt_i R0^beta
+// only the jet constituents are reclustered, once, and the axes of all N come from that cluster sequence
+// (exclusive kt or C/A subjets, or the hardest anti-kt subjets of radius subR - as KT_Axes, CA_Axes and
+// AntiKT_Axes of fastjet::contrib::Nsubjettiness). C/A axes of a jet that comes from a C/A clustering
+// (StFJWrapper::GetReclusteredJet) are taken from its own cluster sequence. There is no mutable or
+// event-level state, so one object can be used for different jets in parallel
+class StJetNsubjettiness
+{
+ public:
+  // axes: Algorithm 0, 1, 2 of StFJWrapper::NSubjettiness
+  enum EAxes_t {
+    kKtAxes = 0,
+    kCAAxes = 1,
+    kAntiKtAxes = 2
+  };
+  enum { kMaxN = 3 };
+
+  StJetNsubjettiness(Int_t axes = kKtAxes, Double_t beta = 1.0, Double_t jetR = 0.4, Double_t subR = 0.2) :
+    fAxes(axes), fBeta(beta), fJetR(jetR), fSubR(subR) {}
+
+  // tau_1..tau_nmax (nmax <= kMaxN), 0 for N >= number of constituents
+  // openingAngle: eta-phi distance of the two N = 2 axes, -2 if the jet has no two axes
+  void       Compute(const fastjet::PseudoJet &jet, Double_t tau[], Int_t nmax = kMaxN, Double_t *openingAngle = 0) const;
+  Double32_t Tau(const fastjet::PseudoJet &jet, Int_t N) const;
+  Double32_t OpeningAngle(const fastjet::PseudoJet &jet) const;
+
+ protected:
+  Int_t      fAxes;   // axes type
+  Double_t   fBeta;   // angular exponent
+  Double_t   fJetR;   // normalization radius R0
+  Double_t   fSubR;   // subjet radius of the anti-kt axes
+};
+
 //__________________________________________________________________________
 class StJetShape1subjettiness_kt : public fastjet::FunctionOfPseudoJet<Double32_t>{
  public:
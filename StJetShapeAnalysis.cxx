@@ -45,12 +45,14 @@
 // jet-framework includes
 #include "StEventPlaneMaker.h"
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 #include "StRhoParameter.h"
 #include "StRho.h"
 #include "StJetMakerTask.h"
+#include "StJetConstituentTable.h"
 #include "StEventPoolManager.h"
-#include "StFemtoTrack.h"
 #include "StCentMaker.h"
+#include "StTrackEtaPhiGrid.h"
 
 // old file kept
 #include "StPicoConstants.h"
@@ -140,6 +142,7 @@ StJetShapeAnalysis::StJetShapeAnalysis(const char *name, StPicoDstMaker *picoMak
   doComments = mDoComments;
   mBaseMaker = 0x0;
   mCentMaker = 0x0;
+  fMixTracks = 0x0;
   fAnalysisMakerName = name;
   fJetMakerName = jetMakerName;
   fRhoMakerName = rhoMakerName;
@@ -223,6 +226,8 @@ StJetShapeAnalysis::~StJetShapeAnalysis()
       }
     }
   }
+
+  if(fMixTracks) delete fMixTracks;
 }
 //
 //_________________________________________________________________________________________
@@ -237,6 +242,9 @@ Int_t StJetShapeAnalysis::Init() {
   //fJets->SetName(fJetsName);
   //fJets->SetOwner(kTRUE);
 
+  // track columns for the event pools - reused every event
+  fMixTracks = new StEventPoolTracks();
+
   return kStOK;
 }
 //
@@ -245,6 +253,9 @@ Int_t StJetShapeAnalysis::Finish() {
   //  Summarize the run.
   cout << "StJetShapeAnalysis::Finish()\n";
 
+  // event pool memory
+  if(fPoolMgr) fPoolMgr->PrintMemoryUsage();
+
   //  Write histos to file and close it.
   if(mOutName!="") {
     TFile *fout = new TFile(mOutName.Data(), "UPDATE");
@@ -579,15 +590,11 @@ Int_t StJetShapeAnalysis::Make() {
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-  deadTowers = mBaseMaker->GetDeadTowers();
-  badTowers = mBaseMaker->GetBadTowers();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 30.0 GeV
@@ -676,10 +683,11 @@ Int_t StJetShapeAnalysis::Make() {
   if(fDebugLevel == kDebugEmcTrigger) cout<<endl;
 
   // check for MB/HT event
-  bool fHaveMBevent = CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-  bool fHaveEmcTrigger = CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent = HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  bool fHaveEmcTrigger = HasHTTrigger(fTrigMask, fEmcTriggerEventType);
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if(doppAnalysis)  fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;
   if(!doppAnalysis) fRunForMB = (fHaveMB5event || fHaveMB30event) ? kTRUE : kFALSE;
@@ -710,7 +718,7 @@ Int_t StJetShapeAnalysis::Make() {
   }
 
   // get JetMaker collection of jets
-  fJets = static_cast<TClonesArray*>(JetMaker->GetJets());
+  fJets = GetJetArray(JetMaker);
   if(!fJets) {
     LOG_WARN << Form(" No fJets object! Skip! ") << endm;
     return kStWarn;
@@ -777,14 +785,13 @@ Int_t StJetShapeAnalysis::Make() {
       TPC_PSI2 = tpc2EP;
 
     } else { // pt-dependent bin mode
-      const char *fEventPlaneMakerNameChTemp = fEventPlaneMakerName;
-      EventPlaneMaker = static_cast<StEventPlaneMaker*>(GetMaker(Form("%s%i", fEventPlaneMakerNameChTemp, fTPCptAssocBin)));
+      EventPlaneMaker = GetEventPlaneMaker(fEventPlaneMakerName, fTPCptAssocBin);
 
       // check for requested EventPlaneMaker pointer
       if(!EventPlaneMaker) {LOG_WARN<<Form("No EventPlaneMaker bin: %i!", fTPCptAssocBin)<<endm; return kStWarn; }
 
       // get event plane angle for different pt bins
-      double tpc2EP = (EventPlaneMaker) ? (double)EventPlaneMaker->GetTPCEP() : -999;
+      double tpc2EP = (EventPlaneMaker) ? (double)EventPlaneMaker->GetTPCEP(fTPCptAssocBin) : -999;
 
       // assign global event plane to selected pt-dependent bin
       TPC_PSI2 = tpc2EP;
@@ -849,7 +856,7 @@ Int_t StJetShapeAnalysis::Make() {
     //if(fDoEventMixing > 0 && fRunForMB && (!fHaveEmcTrigger)) { // kMB5 or kMB30 - AuAu, kMB - pp (excluding HT)
     if(fDoEventMixing > 0 && fRunForMB) { // kMB5 or kMB30 - AuAu, kMB - pp (don't exclude HT)
       // update pool: create a list of reduced objects. This speeds up processing and reduces memory consumption for the event pool
-      pool->UpdatePool(CloneAndReduceTrackList());
+      pool->UpdatePool(ReduceTrackList());
       hMBvsMult->Fill(refCorr2);                       // MB5 || MB30
       if(fHaveMB5event)  hMB5vsMult->Fill(refCorr2);   // MB5
       if(fHaveMB30event) hMB30vsMult->Fill(refCorr2);  // MB30
@@ -986,17 +993,14 @@ TH1 *StJetShapeAnalysis::FillEmcTriggersHist(TH1 *h) {
 //
 // From CF event mixing code PhiCorrelations
 //_________________________________________________
-TClonesArray *StJetShapeAnalysis::CloneAndReduceTrackList()
+StEventPoolTracks *StJetShapeAnalysis::ReduceTrackList()
 {
-  // clones a track list by using StPicoTrack which uses much less memory (used for event mixing)
-//  TClonesArray *tracksClone = new TClonesArray("StPicoTrack");// original way
-  TClonesArray *tracksClone = new TClonesArray("StFemtoTrack");
-//  tracksClone->SetName("tracksClone");
-//  tracksClone->SetOwner(kTRUE);
+  // reduces the track list to pt, eta, phi, charge columns (used for event mixing)
+  //  - columns are refilled every event and copied into the pool arena: no allocation per track
 
   // construct variables, get # of tracks
   int nMixTracks = mPicoDst->numberOfTracks();
-  int iterTrk = 0;
+  fMixTracks->Clear();
 
   // loop over tracks
   for(int i = 0; i < nMixTracks; i++) { 
@@ -1035,19 +1039,11 @@ TClonesArray *StJetShapeAnalysis::CloneAndReduceTrackList()
       if(fTPCptAssocBin == 7) { if((pt < 4.00) || (pt >= 5.0)) continue; }  // 4.00 - 5.0 GeV assoc bin used for correlations
     }
 
-    // create StFemtoTracks out of accepted tracks - light-weight object for mixing
-    //  StFemtoTrack *t = new StFemtoTrack(pt, eta, phi, charge);
-    StFemtoTrack *t = new StFemtoTrack(trk, Bfield, mVertex, doUsePrimTracks);
-    if(!t) continue;
-
-    // add light-weight tracks passing cuts to TClonesArray
-    ((*tracksClone)[iterTrk]) =  t;
-
-    //delete t;
-    ++iterTrk;
+    // add accepted tracks to light-weight columns for mixing
+    fMixTracks->AddTrack(pt, mTrkMom.PseudoRapidity(), mTrkMom.Phi(), trk->charge());
   } // end of looping through tracks
 
-  return tracksClone;
+  return fMixTracks;
 }
 //
 // basic function to get event plane angle
@@ -1294,24 +1290,29 @@ Bool_t StJetShapeAnalysis::DidTowerConstituentFireTrigger(StJet *jet) {
   // tower constituent fired trigger
   Bool_t mFiredTrigger = kFALSE;
 
-  // loop over constituent towers
-  for(int itow = 0; itow < jet->GetNumberOfClusters(); itow++) {
-    int ArrayIndex = jet->ClusterAt(itow);
+  // tower indices from the event constituent table, or stored with the jet if it has no table span
+  const StJetConstituentTable *table = jet->GetConstituentTable();
+  int nConstit = (table) ? jet->GetConstituentSpanSize() : jet->GetNumberOfTowers();
 
-    // get jet tower pointer
-    StPicoBTowHit *tow = static_cast<StPicoBTowHit*>(mPicoDst->btowHit(ArrayIndex));
-    if(!tow){ continue; }
-    
-    // tower ID: get from index of array shifted by +1
-    int towID = ArrayIndex + 1;
-    int towIDindex = towID - 1;
-    if(towID < 0) continue;
+  // loop over constituent towers
+  for(int ic = 0; ic < nConstit; ic++) {
+    // tower index: tower ID - 1
+    int towIDindex = -1;
+    if(table) {
+      int entry = jet->ConstituentEntryAt(ic);
+      if(!table->IsTower(entry)) continue;
+      towIDindex = table->GetIndex(entry);
+    } else {
+      towIDindex = jet->TowerAt(ic);
+    }
+    if(towIDindex < 0) continue;
 
     // change flag to true if jet tower fired trigger
     if((fEmcTriggerEventType == StJetFrameworkPicoBase::kIsHT1) && fTowerToTriggerTypeHT1[towIDindex]) mFiredTrigger = kTRUE;
     if((fEmcTriggerEventType == StJetFrameworkPicoBase::kIsHT2) && fTowerToTriggerTypeHT2[towIDindex]) mFiredTrigger = kTRUE;
     if((fEmcTriggerEventType == StJetFrameworkPicoBase::kIsHT3) && fTowerToTriggerTypeHT3[towIDindex]) mFiredTrigger = kTRUE;
-  
+    if(mFiredTrigger) break;
+
   } // tower constituent loop
 
   return mFiredTrigger;
@@ -1372,32 +1373,16 @@ void StJetShapeAnalysis::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
     double rsumBG[10] = {0.0};
     //double rsumBG3[10] = {0.0};
 
-    // track loop inside jet loop - loop over ALL tracks in PicoDst
-    Int_t ntracks = mPicoDst->numberOfTracks();
-    for(int itrack = 0; itrack < ntracks; itrack++){
-      // get track pointer
-      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(itrack));
-      if(!trk){ continue; }
-
-      // acceptance and kinematic quality cuts
-      if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
-
-      // primary track switch: get momentum vector of track - global or primary track
-      TVector3 mTrkMom;
-      if(doUsePrimTracks) {
-        // get primary track vector
-        mTrkMom = trk->pMom();
-      } else {
-        // get global track vector
-        mTrkMom = trk->gMom(mVertex, Bfield);
-      }
+    // accepted tracks of the event in an eta-phi grid: filled once per event, queried for each cone
+    StTrackEtaPhiGrid *trackGrid = GetTrackGrid();
+    if(!trackGrid) return;
+    double rAnnuliMax = 10*rbinSize; // outer edge of last annulus
 
+    // track loop inside jet loop - tracks within the outer annulus of the jet axis
+    int nCone = trackGrid->FindInCone(jetEta, jetPhi, rAnnuliMax, fGridEntries, &fGridDeltaR);
+    for(int icone = 0; icone < nCone; icone++){
       // track variables
-      double tpt = mTrkMom.Perp();
-      double tphi = mTrkMom.Phi();
-      if(tphi < 0.0   ) tphi += 2.0*pi; // require 0,2pi interval
-      if(tphi > 2.0*pi) tphi -= 2.0*pi; 
-      double teta = mTrkMom.PseudoRapidity();
+      double tpt = trackGrid->GetPt(fGridEntries[icone]);
 
       // cut on track pt range 
       if(tpt < fJetShapeTrackPtMin) { continue; }
@@ -1416,8 +1401,8 @@ void StJetShapeAnalysis::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
         if(fJetShapePtAssocBin == 8) { if((tpt <  0.5))                 continue; }  //       0.5+ GeV assoc bin used for correlations
       }
 
-      // get radial distance between track and jet axis
-      double deltaR = GetDeltaR(jet, trk);
+      // radial distance between track and jet axis
+      double deltaR = fGridDeltaR[icone];
 
       // get annuli bin
       int annuliBin = GetAnnuliBin(deltaR);
@@ -1509,30 +1494,11 @@ void StJetShapeAnalysis::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
       }
     }
 
-    // track loop inside jet loop - loop over ALL tracks in PicoDst - for BG
-    for(int itrack = 0; itrack < ntracks; itrack++){
-      // get track pointer
-      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(itrack));
-      if(!trk){ continue; }
-
-      // acceptance and kinematic quality cuts
-      if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
-
-      // primary track switch: get momentum vector of track - global or primary track
-      TVector3 mTrkMom;
-      if(doUsePrimTracks) {
-        // get primary track vector
-        mTrkMom = trk->pMom();
-      } else {
-        // get global track vector
-        mTrkMom = trk->gMom(mVertex, Bfield);
-      }
-
+    // track loop inside jet loop - tracks within the outer annulus of the BG cone axis (case 1 or 2)
+    int nConeBG = (case1 || case2) ? trackGrid->FindInCone(jetEtaBG, jetPhiBG, rAnnuliMax, fGridEntries, &fGridDeltaR) : 0;
+    for(int icone = 0; icone < nConeBG; icone++){
       // track variables
-      double tpt = mTrkMom.Perp();
-      double tphi = mTrkMom.Phi();
-      if(tphi < 0.0) tphi += 2.0*pi; // require 0,2pi interval
-      double teta = mTrkMom.PseudoRapidity();
+      double tpt = trackGrid->GetPt(fGridEntries[icone]);
 
       // cut on track pt
       if(tpt < fJetShapeTrackPtMin) { continue; }
@@ -1551,11 +1517,8 @@ void StJetShapeAnalysis::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
         if(fJetShapePtAssocBin == 8) { if((tpt <  0.5))                 continue; }  //       0.5+ GeV assoc bin used for correlations
       }
 
-      // get radial distance between track and jet axis
-      double deltaEtaBG = 1.0*TMath::Abs(jetEtaBG - teta);
-      double deltaPhiBG = 1.0*TMath::Abs(jetPhiBG - tphi);
-      if(deltaPhiBG > 1.0*pi) deltaPhiBG = 2.0*pi - deltaPhiBG;
-      double deltaR = 1.0*TMath::Sqrt(deltaEtaBG*deltaEtaBG + deltaPhiBG*deltaPhiBG);
+      // radial distance between track and BG cone axis
+      double deltaR = fGridDeltaR[icone];
 
       // get annuli bin
       int annuliBin = GetAnnuliBin(deltaR);
@@ -1629,7 +1592,7 @@ void StJetShapeAnalysis::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
     // event mixing for background jet cones
     if(fDoEventMixing > 0){
       // initialize background tracks array
-      TObjArray *bgTracks;
+      StEventPoolTrackView bgTracks;
 
       // do event mixing when Signal Jet is part of event with a HT1 or HT2 or HT3 trigger firing
       if(pool->IsReady() || pool->NTracksInPool() > fNMIXtracks || pool->GetCurrentNEvents() >= fNMIXevents) {
@@ -1645,21 +1608,18 @@ void StJetShapeAnalysis::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
         // Fill mixed-event histos here: loop over nMix events
         for(int jMix = 0; jMix < nMix; jMix++) {
           // get jMix'th event
-          bgTracks = pool->GetEvent(jMix);
-          const Int_t Nbgtrks = bgTracks->GetEntries();
+          bgTracks = pool->GetEventTracks(jMix);
+          const Int_t Nbgtrks = bgTracks.n;
 
           // reset annuli sums here - when NOT normalizing by nMix
           double rsumBG3[10] = {0.0};
 
           // loop over background (mixed event) tracks
           for(int ibg = 0; ibg < Nbgtrks; ibg++) {
-            // get Femto track pointer
-            StFemtoTrack *trk = static_cast<StFemtoTrack*>(bgTracks->At(ibg));
-            if(!trk) continue;
-
-            double Mphi = trk->Phi();
-            double Meta = trk->Eta();
-            double Mpt = trk->Pt();
+            // mixed track variables: columns of pooled event
+            double Mphi = bgTracks.phi[ibg];
+            double Meta = bgTracks.eta[ibg];
+            double Mpt = bgTracks.pt[ibg];
 
             // shift angle (0, 2*pi) 
             if(Mphi < 0.0)    Mphi += 2.0*pi;
@@ -29,6 +29,7 @@ class StRho;
 class StRhoParameter;
 class StEventPoolManager;
 class StEventPool;
+class StEventPoolTracks;
 class StCentMaker;
 
 //class StJetShapeAnalysis : public StMaker {
@@ -227,8 +228,9 @@ class StJetShapeAnalysis : public StJetFrameworkPicoBase {
     Double_t                TPC_raw_pos;
 
     // event pool
-    TClonesArray           *CloneAndReduceTrackList();
+    StEventPoolTracks      *ReduceTrackList();
     StEventPoolManager     *fPoolMgr;//!  // event pool Manager object
+    StEventPoolTracks      *fMixTracks;//! // track columns added to event pool, reused every event
 
   private:
     Int_t                   fRunNumber;
@@ -315,13 +317,6 @@ class StJetShapeAnalysis : public StJetFrameworkPicoBase {
     TH1F *hJetPtProfileBGCase2[4][4][4];//! jet profile case2 histograms in annuli bins
     TH1F *hJetPtProfileBGCase3[4][4][4];//! jet profile case3 histograms in annuli bins
 
-    // bad and dead tower list
-    std::set<Int_t>        badTowers;
-    std::set<Int_t>        deadTowers;
-
-    // bad run list 
-    std::set<Int_t>        badRuns;
-
     // base class pointer object
     StJetFrameworkPicoBase *mBaseMaker;
 
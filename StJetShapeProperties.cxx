@@ -72,7 +72,16 @@ StJetShapeProperties::StJetShapeProperties():
   fSoftDropZg(0),
   fSoftDropdR(0),
   fSoftDropPtfrac(0),
-  fSoftDropDropCount(0)
+  fSoftDropDropCount(0),
+  fOpeningAngle(0),
+  fNsubjettiness1(0),
+  fNsubjettiness2(0),
+  fNsubjettiness3(0),
+  fAngularity(0),
+  fpTD(0),
+  fCircularity(0),
+  fSigma2(0),
+  fLeSub(0)
 {
 }
 
@@ -133,7 +142,16 @@ StJetShapeProperties::StJetShapeProperties(const StJetShapeProperties &jet):
   fSoftDropZg(jet.fSoftDropZg),
   fSoftDropdR(jet.fSoftDropdR),
   fSoftDropPtfrac(jet.fSoftDropPtfrac),
-  fSoftDropDropCount(jet.fSoftDropDropCount)
+  fSoftDropDropCount(jet.fSoftDropDropCount),
+  fOpeningAngle(jet.fOpeningAngle),
+  fNsubjettiness1(jet.fNsubjettiness1),
+  fNsubjettiness2(jet.fNsubjettiness2),
+  fNsubjettiness3(jet.fNsubjettiness3),
+  fAngularity(jet.fAngularity),
+  fpTD(jet.fpTD),
+  fCircularity(jet.fCircularity),
+  fSigma2(jet.fSigma2),
+  fLeSub(jet.fLeSub)
 
 {
 }
@@ -197,6 +215,15 @@ StJetShapeProperties& StJetShapeProperties::operator=(const StJetShapeProperties
   fSoftDropdR = jet.fSoftDropdR;
   fSoftDropPtfrac = jet.fSoftDropPtfrac;
   fSoftDropDropCount = jet.fSoftDropDropCount;
+  fOpeningAngle = jet.fOpeningAngle;
+  fNsubjettiness1 = jet.fNsubjettiness1;
+  fNsubjettiness2 = jet.fNsubjettiness2;
+  fNsubjettiness3 = jet.fNsubjettiness3;
+  fAngularity = jet.fAngularity;
+  fpTD = jet.fpTD;
+  fCircularity = jet.fCircularity;
+  fSigma2 = jet.fSigma2;
+  fLeSub = jet.fLeSub;
 
   return *this;
 }
@@ -164,6 +164,28 @@ public:
   Double_t          GetSoftDropPtfrac()                                 const { return fSoftDropPtfrac               ; }
   Int_t             GetSoftDropDropCount()                              const { return fSoftDropDropCount;           ; }
 
+  // C/A declustering: opening angle of the first splitting, N-subjettiness with exclusive C/A axes
+  void              SetOpeningAngle(Double_t d)                               { fOpeningAngle = d                    ; }
+  void              SetNsubjettiness1(Double_t d)                             { fNsubjettiness1 = d                  ; }
+  void              SetNsubjettiness2(Double_t d)                             { fNsubjettiness2 = d                  ; }
+  void              SetNsubjettiness3(Double_t d)                             { fNsubjettiness3 = d                  ; }
+  Double_t          GetOpeningAngle()                                   const { return fOpeningAngle                 ; }
+  Double_t          GetNsubjettiness1()                                 const { return fNsubjettiness1               ; }
+  Double_t          GetNsubjettiness2()                                 const { return fNsubjettiness2               ; }
+  Double_t          GetNsubjettiness3()                                 const { return fNsubjettiness3               ; }
+
+  // unsubtracted first-order shapes, from one pass over the constituents (StJetShapeKernel)
+  void              SetAngularity(Double_t d)                                 { fAngularity = d                      ; }
+  void              SetpTD(Double_t d)                                        { fpTD = d                             ; }
+  void              SetCircularity(Double_t d)                                { fCircularity = d                     ; }
+  void              SetSigma2(Double_t d)                                     { fSigma2 = d                          ; }
+  void              SetLeSub(Double_t d)                                      { fLeSub = d                           ; }
+  Double_t          GetAngularity()                                     const { return fAngularity                   ; }
+  Double_t          GetpTD()                                            const { return fpTD                          ; }
+  Double_t          GetCircularity()                                    const { return fCircularity                  ; }
+  Double_t          GetSigma2()                                         const { return fSigma2                       ; }
+  Double_t          GetLeSub()                                          const { return fLeSub                        ; }
+
   void              PrintGR() const;
 
 protected:
@@ -232,6 +254,17 @@ protected:
   Double_t          fSoftDropdR;                             //!<!   SoftDrop deltaR
   Double_t          fSoftDropPtfrac;                         //!<!   SoftDrop pt fraction after grooming
   Int_t             fSoftDropDropCount;                      //!<!   SoftDrop number of dropped branches [requires set_verbose_structure(bool enable=true)]
+
+  Double_t          fOpeningAngle;                           //!<!   deltaR of the two prongs of the first C/A splitting
+  Double_t          fNsubjettiness1;                         //!<!   tau_1 with exclusive C/A axes
+  Double_t          fNsubjettiness2;                         //!<!   tau_2 with exclusive C/A axes
+  Double_t          fNsubjettiness3;                         //!<!   tau_3 with exclusive C/A axes
+
+  Double_t          fAngularity;                             //!<!   jet angularity (girth)
+  Double_t          fpTD;                                    //!<!   jet pTD
+  Double_t          fCircularity;                            //!<!   jet circularity
+  Double_t          fSigma2;                                 //!<!   jet sigma2 (minor axis)
+  Double_t          fLeSub;                                  //!<!   leading minus subleading constituent pt
 };
 
 #endif
@@ -0,0 +1,266 @@
+#include "StJetUtilitySubstructure.h"
+
+// my includes
+#include "StJet.h"
+#include "StJetShapeProperties.h"
+
+ClassImp(StJetUtilitySoftDrop)
+ClassImp(StJetUtilityOpeningAngle)
+ClassImp(StJetUtilityNsubjettiness)
+ClassImp(StJetUtilityJetShapes)
+
+//______________________________________________________________________________
+StJetUtilitySoftDrop::StJetUtilitySoftDrop() :
+  StJetUtility(),
+  fZcut(0.1),
+  fBeta(0.),
+  fSoftDrop(0)
+{
+  // Dummy constructor.
+}
+
+//______________________________________________________________________________
+StJetUtilitySoftDrop::StJetUtilitySoftDrop(const char *name, Double_t zcut, Double_t beta) :
+  StJetUtility(name),
+  fZcut(zcut),
+  fBeta(beta),
+  fSoftDrop(0)
+{
+  // Default constructor.
+}
+
+//______________________________________________________________________________
+StJetUtilitySoftDrop::~StJetUtilitySoftDrop()
+{
+  // Destructor.
+  if (fSoftDrop) delete fSoftDrop;
+}
+
+//______________________________________________________________________________
+void StJetUtilitySoftDrop::Init()
+{
+  // Create the groomer once - on a C/A reclustered jet it uses the C/A history and does not recluster.
+  if (fInit) return;
+
+  fSoftDrop = new fastjet::contrib::SoftDrop(fBeta, fZcut);
+  fSoftDrop->set_verbose_structure(kTRUE); // for the number of dropped branches
+
+  fInit = kTRUE;
+}
+
+//______________________________________________________________________________
+void StJetUtilitySoftDrop::InitEvent(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+void StJetUtilitySoftDrop::Prepare(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+void StJetUtilitySoftDrop::ProcessJet(StJet *jet, Int_t ij, StFJWrapper& fjw)
+{
+  // Groom the shared C/A reclustering of jet ij.
+  if (!fInit) return;
+
+  const fastjet::PseudoJet &caJet = fjw.GetReclusteredJet(ij);
+  if (!caJet.has_associated_cluster_sequence()) return;
+
+  fastjet::PseudoJet groomed = (*fSoftDrop)(caJet);
+  if (groomed == 0 || !groomed.has_structure_of<fastjet::contrib::SoftDrop>()) return;
+
+  StJetShapeProperties *shape = jet->GetShapeProperties();
+  shape->SetSoftDropZg(groomed.structure_of<fastjet::contrib::SoftDrop>().symmetry());
+  shape->SetSoftDropdR(groomed.structure_of<fastjet::contrib::SoftDrop>().delta_R());
+  shape->SetSoftDropPtfrac((caJet.perp() > 0) ? groomed.perp() / caJet.perp() : 0.);
+  shape->SetSoftDropDropCount(groomed.structure_of<fastjet::contrib::SoftDrop>().dropped_count());
+}
+
+//______________________________________________________________________________
+void StJetUtilitySoftDrop::Terminate(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+StJetUtilityOpeningAngle::StJetUtilityOpeningAngle() :
+  StJetUtility()
+{
+  // Dummy constructor.
+}
+
+//______________________________________________________________________________
+StJetUtilityOpeningAngle::StJetUtilityOpeningAngle(const char *name) :
+  StJetUtility(name)
+{
+  // Default constructor.
+}
+
+//______________________________________________________________________________
+void StJetUtilityOpeningAngle::Init()
+{
+  fInit = kTRUE;
+}
+
+//______________________________________________________________________________
+void StJetUtilityOpeningAngle::InitEvent(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+void StJetUtilityOpeningAngle::Prepare(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+void StJetUtilityOpeningAngle::ProcessJet(StJet *jet, Int_t ij, StFJWrapper& fjw)
+{
+  // Undo the last step of the shared C/A reclustering of jet ij, 0 for a single constituent jet.
+  const fastjet::PseudoJet &caJet = fjw.GetReclusteredJet(ij);
+  if (!caJet.has_associated_cluster_sequence()) return;
+
+  fastjet::PseudoJet j1, j2;
+  Double_t angle = (caJet.has_parents(j1, j2)) ? j1.delta_R(j2) : 0.;
+
+  jet->GetShapeProperties()->SetOpeningAngle(angle);
+}
+
+//______________________________________________________________________________
+void StJetUtilityOpeningAngle::Terminate(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+StJetUtilityNsubjettiness::StJetUtilityNsubjettiness() :
+  StJetUtility(),
+  fBeta(1.),
+  fR0(0.4)
+{
+  // Dummy constructor.
+}
+
+//______________________________________________________________________________
+StJetUtilityNsubjettiness::StJetUtilityNsubjettiness(const char *name, Double_t beta, Double_t R0) :
+  StJetUtility(name),
+  fBeta(beta),
+  fR0(R0)
+{
+  // Default constructor.
+}
+
+//______________________________________________________________________________
+void StJetUtilityNsubjettiness::Init()
+{
+  fInit = kTRUE;
+}
+
+//______________________________________________________________________________
+void StJetUtilityNsubjettiness::InitEvent(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+void StJetUtilityNsubjettiness::Prepare(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+void StJetUtilityNsubjettiness::ProcessJet(StJet *jet, Int_t ij, StFJWrapper& fjw)
+{
+  // tau_1..3 of jet ij (StJetNsubjettiness), axes are the exclusive subjets of the shared C/A reclustering.
+  // tau_N = 0 for jets with N or less constituents.
+  const fastjet::PseudoJet &caJet = fjw.GetReclusteredJet(ij);
+  if (!caJet.has_associated_cluster_sequence()) return;
+
+  StJetNsubjettiness nSub(StJetNsubjettiness::kCAAxes, fBeta, fR0);
+  Double_t tau[3] = {0., 0., 0.};
+  nSub.Compute(caJet, tau, 3);
+
+  StJetShapeProperties *shape = jet->GetShapeProperties();
+  shape->SetNsubjettiness1(tau[0]);
+  shape->SetNsubjettiness2(tau[1]);
+  shape->SetNsubjettiness3(tau[2]);
+}
+
+//______________________________________________________________________________
+void StJetUtilityNsubjettiness::Terminate(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+StJetUtilityJetShapes::StJetUtilityJetShapes() :
+  StJetUtility(),
+  fRMax(2.),
+  fDRStep(0.04),
+  fNSubBins(10),
+  fKernel(0)
+{
+  // Dummy constructor.
+}
+
+//______________________________________________________________________________
+StJetUtilityJetShapes::StJetUtilityJetShapes(const char *name, Double_t rMax, Double_t drStep, Int_t nSubBins) :
+  StJetUtility(name),
+  fRMax(rMax),
+  fDRStep(drStep),
+  fNSubBins(nSubBins),
+  fKernel(0)
+{
+  // Default constructor.
+}
+
+//______________________________________________________________________________
+StJetUtilityJetShapes::~StJetUtilityJetShapes()
+{
+  // Destructor.
+  if (fKernel) delete fKernel;
+}
+
+//______________________________________________________________________________
+void StJetUtilityJetShapes::Init()
+{
+  // Create the kernel once - the GR kernel tables depend only on rMax, drStep and the number of bins.
+  if (fInit) return;
+
+  fKernel = new StJetShapeKernel(fRMax, fDRStep, fNSubBins);
+
+  fInit = kTRUE;
+}
+
+//______________________________________________________________________________
+void StJetUtilityJetShapes::InitEvent(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+void StJetUtilityJetShapes::Prepare(StFJWrapper& /*fjw*/)
+{
+}
+
+//______________________________________________________________________________
+void StJetUtilityJetShapes::ProcessJet(StJet *jet, Int_t ij, StFJWrapper& fjw)
+{
+  // Shapes and GR of jet ij in one pass over its constituents.
+  if (!fInit) return;
+  if (fjw.JetShapes(ij, *fKernel) < 0) return;
+
+  StJetShapeProperties *shape = jet->GetShapeProperties();
+  shape->SetAngularity(fKernel->GetAngularity());
+  shape->SetpTD(fKernel->GetpTD());
+  shape->SetCircularity(fKernel->GetCircularity());
+  shape->SetSigma2(fKernel->GetSigma2());
+  shape->SetLeSub(fKernel->GetLeSub());
+
+  Int_t nR = fKernel->GetNGR();
+  shape->SetGRNumSize(nR);
+  shape->SetGRDenSize(nR);
+  for (Int_t ir = 0; ir < nR; ir++) {
+    shape->AddGRNumAt(fKernel->GetGRNumerator(ir), ir);
+    shape->AddGRDenAt(fKernel->GetGRDenominator(ir), ir);
+  }
+}
+
+//______________________________________________________________________________
+void StJetUtilityJetShapes::Terminate(StFJWrapper& /*fjw*/)
+{
+}
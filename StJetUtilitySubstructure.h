@@ -0,0 +1,118 @@
+#ifndef STJETUTILITYSUBSTRUCTURE_H
+#define STJETUTILITYSUBSTRUCTURE_H
+
+// jet utilities for substructure observables of the jets of a jet maker (StJetMakerTask::AddUtility)
+// the declustering ones use the C/A reclustering of the jet shared via StFJWrapper::GetReclusteredJet(),
+// so each jet is reclustered once per event however many of these utilities are added
+// results are written to the StJetShapeProperties of the jet
+
+// my includes
+#include "StJetUtility.h"
+
+// SoftDrop grooming of the C/A reclustered jet: zg, Rg, groomed pt fraction, number of dropped branches
+class StJetUtilitySoftDrop : public StJetUtility
+{
+ public:
+  StJetUtilitySoftDrop();
+  StJetUtilitySoftDrop(const char *name, Double_t zcut = 0.1, Double_t beta = 0.);
+  virtual ~StJetUtilitySoftDrop();
+
+  void Init();
+  void InitEvent(StFJWrapper& fjw);
+  void Prepare(StFJWrapper& fjw);
+  void ProcessJet(StJet *jet, Int_t ij, StFJWrapper& fjw);
+  void Terminate(StFJWrapper& fjw);
+
+  void SetZcut(Double_t z)                 { fZcut = z; }
+  void SetBeta(Double_t b)                 { fBeta = b; }
+
+ protected:
+  Double_t                     fZcut;             // SoftDrop condition z > fZcut theta^fBeta
+  Double_t                     fBeta;             // SoftDrop angular exponent
+#if !defined(__CINT__)
+  fastjet::contrib::SoftDrop  *fSoftDrop;         //! groomer
+#endif
+
+ private:
+  StJetUtilitySoftDrop(const StJetUtilitySoftDrop &other);
+  StJetUtilitySoftDrop& operator=(const StJetUtilitySoftDrop &other);
+
+  ClassDef(StJetUtilitySoftDrop, 1) // SoftDrop jet utility
+};
+
+// opening angle: deltaR of the two prongs of the first (ungroomed) C/A splitting
+class StJetUtilityOpeningAngle : public StJetUtility
+{
+ public:
+  StJetUtilityOpeningAngle();
+  explicit StJetUtilityOpeningAngle(const char *name);
+  virtual ~StJetUtilityOpeningAngle() {;}
+
+  void Init();
+  void InitEvent(StFJWrapper& fjw);
+  void Prepare(StFJWrapper& fjw);
+  void ProcessJet(StJet *jet, Int_t ij, StFJWrapper& fjw);
+  void Terminate(StFJWrapper& fjw);
+
+  ClassDef(StJetUtilityOpeningAngle, 1) // opening angle jet utility
+};
+
+// N-subjettiness tau_1, tau_2, tau_3 with exclusive C/A subjets as axes (normalized measure)
+// tau_N = sum_i pt_i min_k dR(i,k)^beta / sum_i pt_i R0^beta
+class StJetUtilityNsubjettiness : public StJetUtility
+{
+ public:
+  StJetUtilityNsubjettiness();
+  StJetUtilityNsubjettiness(const char *name, Double_t beta = 1., Double_t R0 = 0.4);
+  virtual ~StJetUtilityNsubjettiness() {;}
+
+  void Init();
+  void InitEvent(StFJWrapper& fjw);
+  void Prepare(StFJWrapper& fjw);
+  void ProcessJet(StJet *jet, Int_t ij, StFJWrapper& fjw);
+  void Terminate(StFJWrapper& fjw);
+
+  void SetBeta(Double_t b)                 { fBeta = b; }
+  void SetR0(Double_t r)                   { fR0   = r; }   // normalization radius, usually the jet radius
+
+ protected:
+  Double_t                     fBeta;             // angular exponent
+  Double_t                     fR0;               // normalization radius
+
+  ClassDef(StJetUtilityNsubjettiness, 1) // N-subjettiness jet utility
+};
+
+// angularity, pTD, circularity, sigma2, LeSub and the GR numerator/denominator for r = ir*drStep
+// from one pass over the jet constituents (StJetShapeKernel via StFJWrapper::JetShapes), no reclustering
+class StJetUtilityJetShapes : public StJetUtility
+{
+ public:
+  StJetUtilityJetShapes();
+  StJetUtilityJetShapes(const char *name, Double_t rMax = 2., Double_t drStep = 0.04, Int_t nSubBins = 10);
+  virtual ~StJetUtilityJetShapes();
+
+  void Init();
+  void InitEvent(StFJWrapper& fjw);
+  void Prepare(StFJWrapper& fjw);
+  void ProcessJet(StJet *jet, Int_t ij, StFJWrapper& fjw);
+  void Terminate(StFJWrapper& fjw);
+
+  void SetRMax(Double_t r)                 { fRMax = r; }       // max GR radius
+  void SetDRStep(Double_t d)               { fDRStep = d; }     // GR radius step and kernel width
+  void SetNSubBins(Int_t n)                { fNSubBins = n; }   // pair dR bins per GR step
+
+ protected:
+  Double_t                     fRMax;             // max GR radius
+  Double_t                     fDRStep;           // GR radius step
+  Int_t                        fNSubBins;         // pair dR bins per GR step
+#if !defined(__CINT__)
+  StJetShapeKernel            *fKernel;           //! shape kernel, memory kept between jets
+#endif
+
+ private:
+  StJetUtilityJetShapes(const StJetUtilityJetShapes &other);
+  StJetUtilityJetShapes& operator=(const StJetUtilityJetShapes &other);
+
+  ClassDef(StJetUtilityJetShapes, 1) // jet shapes jet utility
+};
+#endif
@@ -48,11 +48,11 @@
 
 // jet-framework includes
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 #include "StRhoParameter.h"
 #include "StRho.h"
 #include "StJetMakerTask.h"
 #include "StEventPoolManager.h"
-#include "StFemtoTrack.h"
 
 // include header that has all the event plane correction headers - with calibration/correction values
 #include "StPicoEPCorrectionsIncludes.h"
@@ -104,6 +104,7 @@ StMyAnalysisMaker::StMyAnalysisMaker(const char *name, StPicoDstMaker *picoMaker
   BBC_raw_comb = 0.; BBC_raw_east = 0.; BBC_raw_west = 0.;
   ZDC_raw_comb = 0.; ZDC_raw_east = 0.; ZDC_raw_west = 0.;
   fPoolMgr = 0x0;
+  fMixTracks = 0x0;
   fJets = 0x0;
   fRunNumber = 0;
   fEPcalibFileName = "$STROOT_CALIB/eventplaneFlat.root"; 
@@ -365,6 +366,7 @@ StMyAnalysisMaker::~StMyAnalysisMaker()
 //  fJets->Clear(); delete fJets;
 //  fRho->Clear(); delete fRho; 
   fPoolMgr->Clear(); delete fPoolMgr;
+  if(fMixTracks) delete fMixTracks;
 
   // track reconstruction efficiency input file
   if(fEfficiencyInputFile) {
@@ -386,6 +388,9 @@ Int_t StMyAnalysisMaker::Init() {
   fEfficiencyInputFile = new TFile(input);
   if(!fEfficiencyInputFile) cout<<Form("do not have input file: %s", input);
 
+  // read all efficiency maps into memory once - no file access per track
+  if(fDoEffCorr) LoadTrackingEfficiency(fEfficiencyInputFile);
+
   // initialize calibration file for event plane
   fCalibFile = new TFile("StRoot/StMyAnalysisMaker/recenter_calib_file.root", "READ");
   if(!fCalibFile) cout<<"recenter_calib_file.root does not exist..."<<endl;
@@ -397,6 +402,9 @@ Int_t StMyAnalysisMaker::Init() {
   //fJets->SetName(fJetsName);
   //fJets->SetOwner(kTRUE);
 
+  // track columns for the event pools - reused every event
+  fMixTracks = new StEventPoolTracks();
+
   // switch on Run Flag to look for firing trigger specifically requested for given run period
   switch(fRunFlag) {
     case StJetFrameworkPicoBase::Run14_AuAu200 : // Run14 AuAu
@@ -453,6 +461,9 @@ Int_t StMyAnalysisMaker::Finish() {
   //  Summarize the run.
   cout << "StMyAnalysisMaker::Finish()\n";
 
+  // event pool memory
+  if(fPoolMgr) fPoolMgr->PrintMemoryUsage();
+
   // close event plane calibration files (if open)
   if(fCalibFile->IsOpen()) fCalibFile->Close();
   if(fCalibFile2->IsOpen()) fCalibFile2->Close();
@@ -1276,10 +1287,11 @@ Int_t StMyAnalysisMaker::Make() {
   if(fDebugLevel == kDebugEmcTrigger) cout<<endl;
 
   // check for MB/HT event
-  bool fHaveMBevent = CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-  bool fHaveEmcTrigger = CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent = HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  bool fHaveEmcTrigger = HasHTTrigger(fTrigMask, fEmcTriggerEventType);
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if(doppAnalysis)  fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;
   if(!doppAnalysis) fRunForMB = (fHaveMB5event || fHaveMB30event) ? kTRUE : kFALSE;
@@ -1307,7 +1319,7 @@ Int_t StMyAnalysisMaker::Make() {
   }
 
   // if we have JetMaker, get jet collection associated with it
-  fJets = static_cast<TClonesArray*>(JetMaker->GetJets());
+  fJets = GetJetArray(JetMaker);
   if(!fJets) {
     LOG_WARN << Form(" No fJets object! Skip! ") << endm;
     return kStWarn;
@@ -1673,7 +1685,7 @@ Int_t StMyAnalysisMaker::Make() {
     if(fDebugLevel == kDebugMixedEvents) cout<<"NtracksInPool = "<<pool->NTracksInPool()<<"  CurrentNEvents = "<<pool->GetCurrentNEvents()<<endl;
 
     // initialize background tracks array
-    TObjArray *bgTracks;
+    StEventPoolTrackView bgTracks;
 
   // do event mixing when Signal Jet is part of event with a HT1 or HT2 or HT3 trigger firing
   if(doJetAnalysis) { // trigger type requested was fired for this event - do mixing
@@ -1718,19 +1730,16 @@ Int_t StMyAnalysisMaker::Make() {
           // Fill mixed-event histos here: loop over nMix events
           for(int jMix = 0; jMix < nMix; jMix++) {
             // get jMix'th event
-            bgTracks = pool->GetEvent(jMix);
-            //TObjArray *bgTracks = pool->GetEvent(jMix);
-            const Int_t Nbgtrks = bgTracks->GetEntries();
+            bgTracks = pool->GetEventTracks(jMix);
+            const Int_t Nbgtrks = bgTracks.n;
 
             // loop over background (mixed event) tracks
             for(int ibg = 0; ibg < Nbgtrks; ibg++) {
-              // get Femto track pointer
-              StFemtoTrack *trk = static_cast<StFemtoTrack*>(bgTracks->At(ibg));
-              if(!trk){ continue; }
-              double Mixphi = trk->Phi();
-              double Mixeta = trk->Eta();
-              double Mixpt = trk->Pt();
-              short Mixcharge = trk->Charge();
+              // mixed track variables: columns of pooled event
+              double Mixphi = bgTracks.phi[ibg];
+              double Mixeta = bgTracks.eta[ibg];
+              double Mixpt = bgTracks.pt[ibg];
+              short Mixcharge = (short)bgTracks.charge[ibg];
 
               // shift angle (0, 2*pi) 
               if(Mixphi < 0.0)    Mixphi += 2.0*pi;
@@ -1779,7 +1788,7 @@ Int_t StMyAnalysisMaker::Make() {
 
       // create a list of reduced objects. This speeds up processing and reduces memory consumption for the event pool
       // update pool if jet in event or not
-      pool->UpdatePool(CloneAndReduceTrackList());
+      pool->UpdatePool(ReduceTrackList());
 
       // fill QA histo's
       hMixEvtStatZVtx->Fill(zVtx);
@@ -2230,16 +2239,14 @@ void StMyAnalysisMaker::GetDimParamsEP(Int_t iEntry, TString &label, Int_t &nbin
 //
 // From CF event mixing code PhiCorrelations
 //__________________________________________________________________________________________
-TClonesArray *StMyAnalysisMaker::CloneAndReduceTrackList()
+StEventPoolTracks *StMyAnalysisMaker::ReduceTrackList()
 {
-  // clones a track list by using StPicoTrack which uses much less memory (used for event mixing)
-  TClonesArray *tracksClone = new TClonesArray("StFemtoTrack");
-//  tracksClone->SetName("tracksClone");
-//  tracksClone->SetOwner(kTRUE);
+  // reduces the track list to pt, eta, phi, charge columns (used for event mixing)
+  //  - columns are refilled every event and copied into the pool arena: no allocation per track
 
   // construct variables, get # of tracks
   int nMixTracks = mPicoDst->numberOfTracks();
-  int iterTrk = 0;
+  fMixTracks->Clear();
   //const double pi = 1.0*TMath::Pi();
 
   // loop over tracks
@@ -2262,25 +2269,17 @@ TClonesArray *StMyAnalysisMaker::CloneAndReduceTrackList()
       mTrkMom = trk->gMom(mVertex, Bfield);
     }
 
-    // track variables - used with alt method below
-    //double pt = mTrkMom.Perp();
-    //double phi = mTrkMom.Phi();
-    //double eta = mTrkMom.PseudoRapidity();
-    //short charge = trk->charge();
-
-    // create StFemtoTracks out of accepted tracks - light-weight object for mixing
-    //  StFemtoTrack *t = new StFemtoTrack(pt, eta, phi, charge);
-    StFemtoTrack *t = new StFemtoTrack(trk, Bfield, mVertex, doUsePrimTracks);
-    if(!t) continue;
-
-    // add light-weight tracks passing cuts to TClonesArray
-    ((*tracksClone)[iterTrk]) =  t;
+    // track variables
+    double pt = mTrkMom.Perp();
+    double phi = mTrkMom.Phi();
+    double eta = mTrkMom.PseudoRapidity();
+    short charge = trk->charge();
 
-    //delete t;
-    ++iterTrk;
+    // add accepted tracks to light-weight columns for mixing
+    fMixTracks->AddTrack(pt, eta, phi, charge);
   } // end of looping through tracks
 
-  return tracksClone;
+  return fMixTracks;
 }
 //
 //
@@ -2859,7 +2858,7 @@ Int_t StMyAnalysisMaker::BBC_EP_Cal(int ref9, int region_vz, int n) { //refmult,
   
   // get run ID, transform to run order for filling histogram of corrections
   int RunId = mPicoEvent->runId();
-  int RunId_Order = GetRunNo(fRunFlag, RunId);// + 1;
+  int RunId_Order = GetRunContext(RunId)->GetRunNo();// + 1;
   if(RunId_Order < -1) return kStOK;
 
   // initialize some BBC parameters
@@ -3033,23 +3032,20 @@ Int_t StMyAnalysisMaker::BBC_EP_Cal(int ref9, int region_vz, int n) { //refmult,
   double bbc_delta_psi = 0.;	
   //double bbc_shift_Aval = 0., bbc_shift_Bval = 0.; // comment in with code chunk below
   if(bbc_apply_corr_switch) { // need to have ran recentering + shift prior
-    for(int nharm = 1; nharm < 21; nharm++){
-      // Method 1: load from *.h file function
-      // perform 'shift' to BBC event plane angle
-      ////bbc_delta_psi += (bbc_shift_A[ref9][region_vz][z-1]*cos(2*z*bPhi_rcd) + bbc_shift_B[ref9][region_vz][z-1]*sin(2*z*bPhi_rcd)); 
-      ///bbc_delta_psi += (bbc_shift_A[ref9][region_vz][nharm-1] * cos(2*nharm*bPhi_rcd) + 
-      ///                  bbc_shift_B[ref9][region_vz][nharm-1] * sin(2*nharm*bPhi_rcd));
-
-      // recentering procedure
-      if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
-        bbc_delta_psi += (bbc_shift_A_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*bPhi_rcd) +
-                          bbc_shift_B_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*bPhi_rcd));
-      } else if(fRunFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
-        bbc_delta_psi += (bbc_shift_A[ref9][region_vz][nharm-1] * cos(2*nharm*bPhi_rcd) +
-                          bbc_shift_B[ref9][region_vz][nharm-1] * sin(2*nharm*bPhi_rcd));
-      }
+    // Method 1: load from *.h file function - all 20 harmonics in one pass
+    // perform 'shift' to BBC event plane angle
+    const Double_t *bbcShiftA = 0x0, *bbcShiftB = 0x0;
+    if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
+      bbcShiftA = bbc_shift_A_Run14[ref9][region_vz];
+      bbcShiftB = bbc_shift_B_Run14[ref9][region_vz];
+    } else if(fRunFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
+      bbcShiftA = bbc_shift_A[ref9][region_vz];
+      bbcShiftB = bbc_shift_B[ref9][region_vz];
+    }
+    bbc_delta_psi = ShiftCorrection(bPhi_rcd, bbcShiftA, bbcShiftB, kMaxShiftHarmonics);
 
 /*
+    for(int nharm = 1; nharm < 21; nharm++){
       if(fCalibFile2 && doReadCalibFile){
         // Method 2: load from *.root calibration file
         TProfile *htempBBC_ShiftA = (TProfile*)fCalibFile2->Get(Form("hBBC_shift_A%i_%i", ref9, region_vz));
@@ -3067,8 +3063,8 @@ Int_t StMyAnalysisMaker::BBC_EP_Cal(int ref9, int region_vz, int n) { //refmult,
         delete htempBBC_ShiftA;
         delete htempBBC_ShiftB;
       }
-*/
     }
+*/
 
   }
 
@@ -3116,7 +3112,7 @@ Int_t StMyAnalysisMaker::ZDC_EP_Cal(int ref9, int region_vz, int n) {
 
   // get the runID
   int RunId = mPicoEvent->runId();
-  int RunId_Order = GetRunNo(fRunFlag, RunId);
+  int RunId_Order = GetRunContext(RunId)->GetRunNo();
   if(RunId_Order < -1) return kStOK;
 
   // initialize some east/west horizontal and vertical values - what are they?
@@ -3263,21 +3259,20 @@ Int_t StMyAnalysisMaker::ZDC_EP_Cal(int ref9, int region_vz, int n) {
   double zdc_delta_psi = 0.;
   //double zdc_shift_Aval = 0., zdc_shift_Bval = 0.; // comment in with below code chunk
   if(zdc_apply_corr_switch) { // need to have ran recentering + shift prior
-    for(int nharm = 1; nharm < 21; nharm++){
-      // Method 1: load from *.h file function
-      // perform 'shift' to ZDC event plane angle
-      ///zdc_delta_psi += (zdc_shift_A[ref9][region_vz][nharm-1] * cos(2*nharm*zPhi_rcd) +
-      ///                  zdc_shift_B[ref9][region_vz][nharm-1] * sin(2*nharm*zPhi_rcd));
-
-      if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
-        zdc_delta_psi += (zdc_shift_A_Run14[ref9][region_vz][nharm-1] * cos(2*nharm*zPhi_rcd) +
-                          zdc_shift_B_Run14[ref9][region_vz][nharm-1] * sin(2*nharm*zPhi_rcd));
-      } else if(fRunFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
-        zdc_delta_psi += (zdc_shift_A[ref9][region_vz][nharm-1] * cos(2*nharm*zPhi_rcd) +
-                          zdc_shift_B[ref9][region_vz][nharm-1] * sin(2*nharm*zPhi_rcd));
-      }
+    // Method 1: load from *.h file function - all 20 harmonics in one pass
+    // perform 'shift' to ZDC event plane angle
+    const Double_t *zdcShiftA = 0x0, *zdcShiftB = 0x0;
+    if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200) {
+      zdcShiftA = zdc_shift_A_Run14[ref9][region_vz];
+      zdcShiftB = zdc_shift_B_Run14[ref9][region_vz];
+    } else if(fRunFlag == StJetFrameworkPicoBase::Run16_AuAu200) {
+      zdcShiftA = zdc_shift_A[ref9][region_vz];
+      zdcShiftB = zdc_shift_B[ref9][region_vz];
+    }
+    zdc_delta_psi = ShiftCorrection(zPhi_rcd, zdcShiftA, zdcShiftB, kMaxShiftHarmonics);
 
 /*
+    for(int nharm = 1; nharm < 21; nharm++){
       if(fCalibFile2 && doReadCalibFile){
         // Method 2: load from *.root calibration file
         TProfile *htempZDC_ShiftA = (TProfile*)fCalibFile2->Get(Form("hZDC_shift_A%i_%i", ref9, region_vz));
@@ -3294,9 +3289,9 @@ Int_t StMyAnalysisMaker::ZDC_EP_Cal(int ref9, int region_vz, int n) {
         // delete temp histos
         delete htempZDC_ShiftA;
         delete htempZDC_ShiftB;
-      }      
-*/
+      }
     }
+*/
   }
 
   int ns = 0;
@@ -3569,6 +3564,11 @@ Int_t StMyAnalysisMaker::EventPlaneCal(int ref9, int region_vz, int n, int ptbin
   double tpc_delta_psi = 0.;
   //double tpc_shift_Aval = 0., tpc_shift_Bval = 0.; // comment in with code chunk below
   if(tpc_apply_corr_switch) { // FIXME: file needs to exist and need to have ran recentering + shift prior
+    if(!doTPCptassocBin) {
+      // standard default method (all pt bins combined for reaction plane calculation) - all 20 harmonics in one pass
+      tpc_delta_psi = ShiftCorrection(tPhi_rcd, tpc_shift_N[ref9][region_vz], tpc_shift_P[ref9][region_vz], kMaxShiftHarmonics);
+    }
+
     // loop over harmonics
     for(int nharm = 1; nharm < 21; nharm++){
       // Method 1: load from *.h file function
@@ -3648,10 +3648,6 @@ Int_t StMyAnalysisMaker::EventPlaneCal(int ref9, int region_vz, int n, int ptbin
         } // METHOD switch
         // add 3 additional pt bins here for later use
 
-      } else {
-        // standard default method (all pt bins combined for reaction plane calculation)
-        tpc_delta_psi += (tpc_shift_N[ref9][region_vz][nharm-1] * cos(2*nharm*tPhi_rcd) +
-                          tpc_shift_P[ref9][region_vz][nharm-1] * sin(2*nharm*tPhi_rcd));
       }
 
 /*
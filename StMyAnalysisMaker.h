@@ -32,6 +32,7 @@ class StJet;
 class StRho;
 class StRhoParameter;
 class StEventPoolManager;
+class StEventPoolTracks;
 
 //class StMyAnalysisMaker : public StMaker {
 class StMyAnalysisMaker : public StJetFrameworkPicoBase {
@@ -277,8 +278,9 @@ class StMyAnalysisMaker : public StJetFrameworkPicoBase {
     Double_t                ZDC_raw_west;
 
     // event pool
-    TClonesArray           *CloneAndReduceTrackList();
+    StEventPoolTracks      *ReduceTrackList();
     StEventPoolManager     *fPoolMgr;//!  // event pool Manager object
+    StEventPoolTracks      *fMixTracks;//! // track columns added to event pool, reused every event
 
     // track efficiency file
     TFile                  *fEfficiencyInputFile;
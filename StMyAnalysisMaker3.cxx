@@ -57,12 +57,16 @@
 // jet-framework includes
 #include "StEventPlaneMaker.h"
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 #include "StRhoParameter.h"
 #include "StRho.h"
 #include "StJetMakerTask.h"
+#include "StJetConstituentTable.h"
 #include "StEventPoolManager.h"
-#include "StFemtoTrack.h"
 #include "StCentMaker.h"
+#include "StTrackCacheMaker.h"
+#include "StTrackEtaPhiGrid.h"
+#include "StSparseFillBuffer.h"
 //#include "trackingEfficiency_Run14.h"
 
 // old file kept
@@ -107,6 +111,7 @@ StMyAnalysisMaker3::StMyAnalysisMaker3(const char *name, StPicoDstMaker *picoMak
   BBC_raw_comb = 0.; BBC_raw_east = 0.; BBC_raw_west = 0.;
   ZDC_raw_comb = 0.; ZDC_raw_east = 0.; ZDC_raw_west = 0.;
   fPoolMgr = 0x0;
+  fMixTracks = 0x0;
   fJets = 0x0;
   fRunNumber = 0;
   fEPTPCn = 0.; fEPTPCp = 0.;
@@ -174,6 +179,7 @@ StMyAnalysisMaker3::StMyAnalysisMaker3(const char *name, StPicoDstMaker *picoMak
   fhnJH = 0x0;
   fhnMixedEvents = 0x0;
   fhnCorr = 0x0;
+  fMixedEventsBuffer = 0x0;
   fAnalysisMakerName = name;
   fJetMakerName = jetMakerName;
   fRhoMakerName = rhoMakerName;
@@ -376,6 +382,7 @@ StMyAnalysisMaker3::~StMyAnalysisMaker3()
   if(fhnJH)          delete fhnJH;
   if(fhnMixedEvents) delete fhnMixedEvents;
   if(fhnCorr)        delete fhnCorr;
+  if(fMixedEventsBuffer) delete fMixedEventsBuffer;
 
   // clear and delete objects
 //  fJets->Clear();    delete fJets;
@@ -384,6 +391,7 @@ StMyAnalysisMaker3::~StMyAnalysisMaker3()
 
   // Clear unnecessary pools before saving - FIXME
   fPoolMgr->ClearPools();
+  if(fMixTracks) delete fMixTracks;
   if(fListOfPools) delete fListOfPools;
 
   // track reconstruction efficiency input file
@@ -411,6 +419,9 @@ Int_t StMyAnalysisMaker3::Init() {
     //fEfficiencyInputFile = new TFile(input);
     fEfficiencyInputFile = new TFile(input, "READ");
     if(!fEfficiencyInputFile) cout<<Form("do not have input file: %s", input);
+
+    // read all efficiency maps into memory once - no file access per track
+    LoadTrackingEfficiency(fEfficiencyInputFile);
   }
 
   // Initialize output list of event pools - TEST
@@ -431,6 +442,9 @@ Int_t StMyAnalysisMaker3::Init() {
   //fJets->SetName(fJetsName);
   //fJets->SetOwner(kTRUE);
 
+  // track columns for the event pools - reused every event
+  fMixTracks = new StEventPoolTracks();
+
   return kStOK;
 }
 //
@@ -440,6 +454,9 @@ Int_t StMyAnalysisMaker3::Finish() {
   //  Summarize the run.
   cout << "StMyAnalysisMaker3::Finish()\n";
 
+  // event pool memory
+  if(fPoolMgr) fPoolMgr->PrintMemoryUsage();
+
   // Write event pool manager object to file and close it
   if(mOutNameME != "") {
     TFile *fOutME = new TFile(mOutNameME.Data(), "RECREATE");
@@ -842,6 +859,13 @@ void StMyAnalysisMaker3::DeclareHistograms() {
   bitcodeMESE = 1<<0 | 1<<1 | 1<<2 | 1<<3 | 1<<4 | 1<<5 | 1<<6 | 1<<7 | 1<<8; // | 1<<9;
   fhnMixedEvents = NewTHnSparseF("fhnMixedEvents", bitcodeMESE);
 
+  // mixed event fills per jet are buffered over the axes that change per track: track pt, deta, dphi, charge
+  // and grouped by pt assoc bin, which fixes the assoc bin and jet - event plane axes
+  if(fDoEventMixing) {
+    Int_t mixDenseAxes[4] = {2, 3, 4, 7};
+    fMixedEventsBuffer = new StSparseFillBuffer(fhnMixedEvents, 4, mixDenseAxes, kNAssocPtBins);
+  }
+
   // jet counter for normalizations in correlation analysis
   UInt_t bitcodeCorr = 0; // bit coded, see GetDimparamsCorr() below
   bitcodeCorr = 1<<0 | 1<<1 | 1<<2 | 1<<3 | 1<<4;
@@ -1139,18 +1163,17 @@ Int_t StMyAnalysisMaker3::Make() {
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-  deadTowers = mBaseMaker->GetDeadTowers();
-  badTowers = mBaseMaker->GetBadTowers();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
     hStats->Fill(2);
   }
 
+  // get shared track cache for this event (mTrackCache = 0x0 if not available)
+  GetTrackCache();
+
   // cut event on max track pt > 30.0 GeV
   if(GetMaxTrackPt() > fMaxEventTrackPt) return kStOK;
   hStats->Fill(3);
@@ -1256,10 +1279,11 @@ Int_t StMyAnalysisMaker3::Make() {
   if(fDebugLevel == kDebugEmcTrigger) cout<<endl;
 
   // check for MB/HT event
-  bool fHaveMBevent = CheckForMB(fRunFlag, fMBEventType);
-  bool fHaveMB5event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-  bool fHaveMB30event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30); 
-  bool fHaveEmcTrigger = CheckForHT(fRunFlag, fEmcTriggerEventType);
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent = HasMBTrigger(fTrigMask, fMBEventType);
+  bool fHaveMB5event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30); 
+  bool fHaveEmcTrigger = HasHTTrigger(fTrigMask, fEmcTriggerEventType);
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if( doppAnalysis) fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;
   if(!doppAnalysis) fRunForMB = (fHaveMB5event || fHaveMB30event) ? kTRUE : kFALSE;
@@ -1289,7 +1313,7 @@ Int_t StMyAnalysisMaker3::Make() {
   }
 
   // get JetMaker collection of jets
-  fJets = static_cast<TClonesArray*>(JetMaker->GetJets());
+  fJets = GetJetArray(JetMaker);
   if(!fJets) {
     LOG_WARN << Form(" No fJets object! Skip! ") << endm;
     return kStWarn;
@@ -1330,7 +1354,7 @@ Int_t StMyAnalysisMaker3::Make() {
     StJet *jet = static_cast<StJet*>(fJetsBGsub->At(ijet));
     if(!jet) continue;
   
-    vector<fastjet::PseudoJet> fConstituents = jet->GetJetConstituents();
+    const vector<fastjet::PseudoJet> &fConstituents = jet->GetJetConstituents();
     for(UInt_t ic = 0; ic < fConstituents.size(); ++ic) {
       // get user defined index
       Int_t uid = fConstituents[ic].user_index();
@@ -1466,9 +1490,8 @@ Int_t StMyAnalysisMaker3::Make() {
 
       // get the generic event plane angle of the event: using tracks 0.2-2.0 GeV for calculation (option 4)
       // for an angle (0, pi)    
-      const char *fEventPlaneMakerNameChTemp = fEventPlaneMakerName;
-      StEventPlaneMaker *EPMaker = static_cast<StEventPlaneMaker*>(GetMaker(Form("%s%i", fEventPlaneMakerNameChTemp, 4)));
-      double psi2 = (EPMaker) ? (double)EPMaker->GetTPCEP() : -999;
+      StEventPlaneMaker *EPMaker = GetEventPlaneMaker(fEventPlaneMakerName, 4);
+      double psi2 = (EPMaker) ? (double)EPMaker->GetTPCEP(4) : -999;
 
       // initialize event pools - different cases for each dataset
       if(fDoUseMultBins) {
@@ -1561,16 +1584,13 @@ Int_t StMyAnalysisMaker3::Make() {
     if(doJetHadronCorrelationAnalysis) {
       // Triggered events and leading/subleading jets - do Jet Hadron Correlation Analysis
       // check for back to back jets: must have leading + subleading jet, subleading jet must be > 10 GeV, subleading jet must be within 0.4 of pi opposite of leading jet
+      // all pt assoc bins are filled in one pass over the tracks
       if(doRequireAjSelection) {
-        for(int ptbin=0; ptbin<5; ptbin++) {
-          if(doAjSelection && fHaveEmcTrigger && fJetAnalysisJetType == kLeadingJets && fLeadingJet)       JetHadronCorrelationAnalysis(fLeadingJet, pool, centbin, ptbin);
-          if(doAjSelection && fHaveEmcTrigger && fJetAnalysisJetType == kSubLeadingJets && fSubLeadingJet) JetHadronCorrelationAnalysis(fSubLeadingJet, pool, centbin, ptbin);
-        }
+        if(doAjSelection && fHaveEmcTrigger && fJetAnalysisJetType == kLeadingJets && fLeadingJet)       JetHadronCorrelationAnalysis(fLeadingJet, pool, centbin);
+        if(doAjSelection && fHaveEmcTrigger && fJetAnalysisJetType == kSubLeadingJets && fSubLeadingJet) JetHadronCorrelationAnalysis(fSubLeadingJet, pool, centbin);
       } else { // don't require back-to-back jets meeting Aj criteria
-        for(int ptbin=0; ptbin<5; ptbin++) {
-          if(fHaveEmcTrigger && fJetAnalysisJetType == kLeadingJets && fLeadingJet)       JetHadronCorrelationAnalysis(fLeadingJet, pool, centbin, ptbin);
-          if(fHaveEmcTrigger && fJetAnalysisJetType == kSubLeadingJets && fSubLeadingJet) JetHadronCorrelationAnalysis(fSubLeadingJet, pool, centbin, ptbin);
-        }
+        if(fHaveEmcTrigger && fJetAnalysisJetType == kLeadingJets && fLeadingJet)       JetHadronCorrelationAnalysis(fLeadingJet, pool, centbin);
+        if(fHaveEmcTrigger && fJetAnalysisJetType == kSubLeadingJets && fSubLeadingJet) JetHadronCorrelationAnalysis(fSubLeadingJet, pool, centbin);
       }
 
       // jet-hadron correlation - case for: inclusive jets
@@ -1581,11 +1601,9 @@ Int_t StMyAnalysisMaker3::Make() {
           StJet *jet = static_cast<StJet*>(fJets->At(ijet));
           if(!jet) continue;
 
-          // loop over pt associated bins for analysis
-          for(int ptbin = 0; ptbin < 5; ptbin++) {
-            if(doRequireAjSelection && doAjSelection) { JetHadronCorrelationAnalysis(jet, pool, centbin, ptbin);
-            } else { JetHadronCorrelationAnalysis(jet, pool, centbin, ptbin); }
-          } // loop over pt bins
+          // all pt associated bins for analysis
+          if(doRequireAjSelection && doAjSelection) { JetHadronCorrelationAnalysis(jet, pool, centbin);
+          } else { JetHadronCorrelationAnalysis(jet, pool, centbin); }
         }   // loop over jets
       }     // inclusive jet case
 
@@ -1604,7 +1622,7 @@ Int_t StMyAnalysisMaker3::Make() {
          (fHaveMB30event && !fHaveMB5event)) {
         ///==///      if(!fHaveMB5event && fHaveMB30event) {
         ///==///      if(fHaveMB5event && !fHaveMB30event) {
-        pool->UpdatePool(CloneAndReduceTrackList());
+        pool->UpdatePool(ReduceTrackList());
       }
 
       // fill QA histo's
@@ -1688,30 +1706,32 @@ Int_t StMyAnalysisMaker3::Make() {
     // loop over tracks
     int nTracks = mPicoDst->numberOfTracks();
     for(int i = 0; i < nTracks; i++) {
-      // get track pointer
-      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(i));
-      if(!trk){ continue; }
-
-      // acceptance and kinematic quality cuts
-      if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
-
-      // get momentum vector of track - global or primary track
-      TVector3 mTrkMom;
-      if(doUsePrimTracks) {
-        if(!(trk->isPrimary())) continue; // check if primary
-        mTrkMom = trk->pMom();                 // get primary track vector
+      // track variables - from shared track cache if available
+      double pt, eta;
+      if(mTrackCache) {
+        if(!AcceptTrack(mTrackCache, i)) { continue; }
+        pt = mTrackCache->GetPt(i);
+        eta = mTrackCache->GetEta(i);
       } else {
-        mTrkMom = trk->gMom(mVertex, Bfield);  // get global track vector
-      }
-
-      // track variables - used with alt method below
-      double pt = mTrkMom.Perp();
-      double eta = mTrkMom.PseudoRapidity();
-      double phi = mTrkMom.Phi();      
+        // get track pointer
+        StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(i));
+        if(!trk){ continue; }
+
+        // acceptance and kinematic quality cuts
+        if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
+
+        // get momentum vector of track - global or primary track
+        TVector3 mTrkMom;
+        if(doUsePrimTracks) {
+          if(!(trk->isPrimary())) continue; // check if primary
+          mTrkMom = trk->pMom();                 // get primary track vector
+        } else {
+          mTrkMom = trk->gMom(mVertex, Bfield);  // get global track vector
+        }
 
-      // shift angle (0, 2*pi) 
-      if(phi < 0.0)    phi += 2.0*pi;
-      if(phi > 2.0*pi) phi -= 2.0*pi;
+        pt = mTrkMom.Perp();
+        eta = mTrkMom.PseudoRapidity();
+      }
 
       // calculate single particle tracking efficiency
       int effCent   = mCentMaker->GetRef16();
@@ -1955,39 +1975,72 @@ void StMyAnalysisMaker3::GetDimParamsCorr(Int_t iEntry, TString &label, Int_t &n
 } // end of Correction (ME) sparse
 //
 // From CF event mixing code PhiCorrelations
-// clones a track list by using StPicoTrack which uses much less memory (used for event mixing)
+// reduces the track list to pt, eta, phi, charge, weight and trigger columns (used for event mixing)
+//  - columns are refilled every event and copied into the pool arena: no allocation per track
 //____________________________________________________________________________
-TClonesArray *StMyAnalysisMaker3::CloneAndReduceTrackList()
+StEventPoolTracks *StMyAnalysisMaker3::ReduceTrackList()
 {
-  // create array for Femto tracks
-  TClonesArray *tracksClone = new TClonesArray("StFemtoTrack");
-//  tracksClone->SetName("tracksClone");
-//  tracksClone->SetOwner(kTRUE);
-
   // construct variables, get # of tracks
   int nMixTracks = mPicoDst->numberOfTracks();
-  int iterTrk = 0;
+  fMixTracks->Clear();
+
+  //==============================================================================================
+  // get trigger to separate correction weight for the min bias events (kVPDMB5 and kVPDMB30)
+  // same for every track in the event - done once before the track loop
+  UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMB5event  = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);
+  bool fHaveMB30event = HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  int fMixMBTrig = 0;
+  if( fHaveMB5event && !fHaveMB30event) fMixMBTrig = 5;
+  if(fHaveMB30event &&  !fHaveMB5event) fMixMBTrig = 30;
+
+  //  - MB30: weight is just 're-weight'
+  //  - MB5: weight is 're-weight' scaled by additional weight for MB5 -> MB30 
+  double refMultReWeightCorr = 1.0;
+  if( fHaveMB5event && !fHaveMB30event) refMultReWeightCorr = mCentMaker->GetMB5toMB30ReWeight();
+  if(fHaveMB30event && !fHaveMB5event)  refMultReWeightCorr = mCentMaker->GetReWeight();
+  //==============================================================================================
+
+  // tracking efficiency is stored with the pooled tracks - computed once at insertion, not per jet when mixing
+  int effCent   = mCentMaker->GetRef16();
+  double fZDCx  = mPicoEvent->ZDCx();
 
   // loop over tracks
   for(int i = 0; i < nMixTracks; i++) { 
-    // get track pointer
-    StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(i));
-    if(!trk){ continue; }
-
-    // acceptance and kinematic quality cuts
-    if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
+    // track pointer not needed when using shared track cache
+    StPicoTrack *trk = 0x0;
 
-    // get momentum vector of track - global or primary track
-    TVector3 mTrkMom;
-    if(doUsePrimTracks) {
-      if(!(trk->isPrimary())) continue; // check if primary
-      mTrkMom = trk->pMom();                 // get primary track vector
+    // track variables - used with alt method below
+    double pt, eta, phi;
+    short charge;
+    if(mTrackCache) {
+      if(!AcceptTrack(mTrackCache, i)) { continue; }
+      pt = mTrackCache->GetPt(i);
+      eta = mTrackCache->GetEta(i);
+      phi = mTrackCache->GetPhi(i);
+      charge = mTrackCache->GetCharge(i);
     } else {
-      mTrkMom = trk->gMom(mVertex, Bfield);  // get global track vector
-    }
+      // get track pointer
+      trk = static_cast<StPicoTrack*>(mPicoDst->track(i));
+      if(!trk){ continue; }
 
-    // track variables - used with alt method below
-    double pt = mTrkMom.Perp();
+      // acceptance and kinematic quality cuts
+      if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
+
+      // get momentum vector of track - global or primary track
+      TVector3 mTrkMom;
+      if(doUsePrimTracks) {
+        if(!(trk->isPrimary())) continue; // check if primary
+        mTrkMom = trk->pMom();                 // get primary track vector
+      } else {
+        mTrkMom = trk->gMom(mVertex, Bfield);  // get global track vector
+      }
+
+      pt = mTrkMom.Perp();
+      eta = mTrkMom.PseudoRapidity();
+      phi = mTrkMom.Phi();
+      charge = trk->charge();
+    }
 
     // 0.20-0.5, 0.5-1.0, 1.0-1.5, 1.5-2.0    - also added 2.0-3.0, 3.0-4.0, 4.0-5.0
     // when doing event plane calculation via pt assoc bin
@@ -2003,35 +2056,14 @@ TClonesArray *StMyAnalysisMaker3::CloneAndReduceTrackList()
       if(fTPCptAssocBin == 7) { if((pt < 4.00) || (pt >= 5.0)) continue; }  // 4.00 - 5.0 GeV assoc bin used for correlations
     }
 
-    //==============================================================================================
-    // get trigger to separate correction weight for the min bias events (kVPDMB5 and kVPDMB30)
-    bool fHaveMB5event  = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);
-    bool fHaveMB30event = CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-    int fMixMBTrig = 0;
-    if( fHaveMB5event && !fHaveMB30event) fMixMBTrig = 5;
-    if(fHaveMB30event &&  !fHaveMB5event) fMixMBTrig = 30;
-
-    //  - MB30: weight is just 're-weight'
-    //  - MB5: weight is 're-weight' scaled by additional weight for MB5 -> MB30 
-    double refMultReWeightCorr = 1.0;
-    if( fHaveMB5event && !fHaveMB30event) refMultReWeightCorr = mCentMaker->GetMB5toMB30ReWeight();
-    if(fHaveMB30event && !fHaveMB5event)  refMultReWeightCorr = mCentMaker->GetReWeight();
-    //==============================================================================================
-
-    // create StFemtoTracks out of accepted tracks - light-weight object for mixing
-    //  StFemtoTrack *t = new StFemtoTrack(pt, eta, phi, charge);
-    //StFemtoTrack *t = new StFemtoTrack(trk, Bfield, mVertex, doUsePrimTracks);
-    StFemtoTrack *t = new StFemtoTrack(trk, Bfield, mVertex, doUsePrimTracks, refMultReWeightCorr, fMixMBTrig);
-    if(!t) continue;
-
-    // add light-weight tracks passing cuts to TClonesArray
-    ((*tracksClone)[iterTrk]) =  t;
-
-    //delete t;
-    ++iterTrk;
+    // single particle tracking efficiency in the pooled event
+    double trkEfficiency = ApplyTrackingEff(fDoEffCorr, pt, eta, effCent, fZDCx, fTrackEfficiencyType, fEfficiencyInputFile);
+
+    // add accepted tracks to light-weight columns for mixing
+    fMixTracks->AddTrack(pt, eta, phi, charge, refMultReWeightCorr, fMixMBTrig, trkEfficiency);
   } // end of looping through tracks
 
-  return tracksClone;
+  return fMixTracks;
 }
 //
 //
@@ -2777,24 +2809,29 @@ Bool_t StMyAnalysisMaker3::DidTowerConstituentFireTrigger(StJet *jet) {
   // tower constituent fired trigger
   Bool_t mFiredTrigger = kFALSE;
 
-  // loop over constituent towers
-  for(int itow = 0; itow < jet->GetNumberOfClusters(); itow++) {
-    int towerIndex = jet->ClusterAt(itow);
+  // tower indices from the event constituent table, or stored with the jet if it has no table span
+  const StJetConstituentTable *table = jet->GetConstituentTable();
+  int nConstit = (table) ? jet->GetConstituentSpanSize() : jet->GetNumberOfTowers();
 
-    // get tower pointer
-    StPicoBTowHit *tow = static_cast<StPicoBTowHit*>(mPicoDst->btowHit(towerIndex));
-    if(!tow) continue;
-    
-    // tower ID: get from index of array shifted by +1
-    int towID = towerIndex + 1;
-    int towIDindex = towID - 1;
-    if(towID < 0) continue;
+  // loop over constituent towers
+  for(int ic = 0; ic < nConstit; ic++) {
+    // tower index: tower ID - 1
+    int towIDindex = -1;
+    if(table) {
+      int entry = jet->ConstituentEntryAt(ic);
+      if(!table->IsTower(entry)) continue;
+      towIDindex = table->GetIndex(entry);
+    } else {
+      towIDindex = jet->TowerAt(ic);
+    }
+    if(towIDindex < 0) continue;
 
     // change flag to true if jet tower fired trigger
     if((fEmcTriggerEventType == StJetFrameworkPicoBase::kIsHT1) && fTowerToTriggerTypeHT1[towIDindex]) mFiredTrigger = kTRUE;
     if((fEmcTriggerEventType == StJetFrameworkPicoBase::kIsHT2) && fTowerToTriggerTypeHT2[towIDindex]) mFiredTrigger = kTRUE;
     if((fEmcTriggerEventType == StJetFrameworkPicoBase::kIsHT3) && fTowerToTriggerTypeHT3[towIDindex]) mFiredTrigger = kTRUE;
-  
+    if(mFiredTrigger) break;
+
   } // tower constituent loop
 
   return mFiredTrigger;
@@ -3019,10 +3056,9 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
     // get StEventPlaneMaker from event
     StEventPlaneMaker *EventPlaneMaker[5];
 
-    // pt-dependent bin mode
-    const char *fEventPlaneMakerNameChTemp = fEventPlaneMakerName;
+    // pt-dependent bin mode: one maker per bin, or one maker for all bins
     for(int i = 0; i < 5; i++) {
-      EventPlaneMaker[i] = static_cast<StEventPlaneMaker*>(GetMaker(Form("%s%i", fEventPlaneMakerNameChTemp, i)));
+      EventPlaneMaker[i] = GetEventPlaneMaker(fEventPlaneMakerName, i);
     }
 
     // event plane bin to use: pt dependent ranges
@@ -3038,13 +3074,13 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
 
     // get event plane angle for different pt bins - assign global event plane to selected pt-dependent bin
     // could also write this as:  tpc2EP_bin = (EventPlaneMaker) ? (double)EventPlaneMaker->GetTPCEP() : -999;
-    double tpc2EP  = (EventPlaneMaker[EPBinToUse]) ? (double)EventPlaneMaker[EPBinToUse]->GetTPCEP() : -999;
-    double jetV2EP = (EventPlaneMaker[EPBinToUse]) ? (double)EventPlaneMaker[EPBinToUse]->GetTPCEP() : -999;
+    double tpc2EP  = (EventPlaneMaker[EPBinToUse]) ? (double)EventPlaneMaker[EPBinToUse]->GetTPCEP(EPBinToUse) : -999;
+    double jetV2EP = (EventPlaneMaker[EPBinToUse]) ? (double)EventPlaneMaker[EPBinToUse]->GetTPCEP(EPBinToUse) : -999;
 
     // if requiring a single event plane angle (non-pt dependent): use charged tracks 0.2-2.0 GeV to calculate EP
     if(doUseMainEPAngle) {
-      tpc2EP  = (EventPlaneMaker[4]) ? (double)EventPlaneMaker[4]->GetTPCEP() : -999;
-      jetV2EP = (EventPlaneMaker[4]) ? (double)EventPlaneMaker[4]->GetTPCEP() : -999;
+      tpc2EP  = (EventPlaneMaker[4]) ? (double)EventPlaneMaker[4]->GetTPCEP(4) : -999;
+      jetV2EP = (EventPlaneMaker[4]) ? (double)EventPlaneMaker[4]->GetTPCEP(4) : -999;
     }
     //cout<<"assocPtBin: "<<assocPtBin<<"  tpc2EP: "<<tpc2EP<<"  jetV2EP: "<<jetV2EP<<endl;
 
@@ -3081,30 +3117,17 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
     double rsumBG[10] = {0.0};
     //double rsumBG3[10] = {0.0};
 
-    // track loop inside jet loop - loop over ALL tracks in PicoDst
-    Int_t ntracks = mPicoDst->numberOfTracks();
-    for(int itrack = 0; itrack < ntracks; itrack++){
-      // get track pointer
-      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(itrack));
-      if(!trk){ continue; }
-
-      // acceptance and kinematic quality cuts
-      if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
-
-      // get momentum vector of track - global or primary track
-      TVector3 mTrkMom;
-      if(doUsePrimTracks) { // get primary track vector
-        mTrkMom = trk->pMom();
-      } else {              // get global track vector
-        mTrkMom = trk->gMom(mVertex, Bfield);
-      }
+    // accepted tracks of the event in an eta-phi grid: filled once per event, queried for each cone
+    StTrackEtaPhiGrid *trackGrid = GetTrackGrid();
+    if(!trackGrid) return;
+    double rAnnuliMax = 10*rbinSize; // outer edge of last annulus
 
+    // track loop inside jet loop - tracks within the outer annulus of the jet axis
+    int nCone = trackGrid->FindInCone(jetEta, jetPhi, rAnnuliMax, fGridEntries, &fGridDeltaR);
+    for(int icone = 0; icone < nCone; icone++){
       // track variables
-      double tpt = mTrkMom.Perp();
-      double tphi = mTrkMom.Phi();
-      if(tphi < 0.0)    tphi += 2.0*pi;   // require 0,2pi interval
-      if(tphi > 2.0*pi) tphi -= 2.0*pi;
-      double teta = mTrkMom.PseudoRapidity();
+      double tpt = trackGrid->GetPt(fGridEntries[icone]);
+      double teta = trackGrid->GetEta(fGridEntries[icone]);
 
       // cut on track pt
       if(tpt < fJetShapeTrackPtMin) { continue; }
@@ -3125,8 +3148,8 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
         //if(thisbin == 4) { if((tpt < 4.00) || (tpt >= 8.0)) continue; } // 4.00 - 8.0 GeV assoc bin used for jet shapes
       }
 
-      // get radial distance between track and jet axis
-      double deltaR = GetDeltaR(jet, trk);
+      // radial distance between track and jet axis
+      double deltaR = fGridDeltaR[icone];
 
       // get annuli bin
       int annuliBin = GetAnnuliBin(deltaR);
@@ -3212,29 +3235,12 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
     }
 
     // BACKGROUND tracks
-    // track loop inside jet loop - loop over ALL tracks in PicoDst - for BG
-    for(int itrack = 0; itrack < ntracks; itrack++){
-      // get track pointer
-      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(itrack));
-      if(!trk){ continue; }
-
-      // acceptance and kinematic quality cuts
-      if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
-
-      // get momentum vector of track - global or primary track
-      TVector3 mTrkMom;
-      if(doUsePrimTracks) { // get primary track vector
-        mTrkMom = trk->pMom();
-      } else {              // get global track vector
-        mTrkMom = trk->gMom(mVertex, Bfield);
-      }
-
+    // track loop inside jet loop - tracks within the outer annulus of the BG cone axis (case 1 or 2)
+    int nConeBG = (case1 || case2) ? trackGrid->FindInCone(jetEtaBG, jetPhiBG, rAnnuliMax, fGridEntries, &fGridDeltaR) : 0;
+    for(int icone = 0; icone < nConeBG; icone++){
       // track variables
-      double tpt = mTrkMom.Perp();
-      double tphi = mTrkMom.Phi();
-      if(tphi < 0.0)    tphi += 2.0*pi; // require 0,2pi interval
-      if(tphi > 2.0*pi) tphi -= 2.0*pi;
-      double teta = mTrkMom.PseudoRapidity();
+      double tpt = trackGrid->GetPt(fGridEntries[icone]);
+      double teta = trackGrid->GetEta(fGridEntries[icone]);
 
       // cut on track pt
       if(tpt < fJetShapeTrackPtMin) { continue; }
@@ -3253,11 +3259,8 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
         if(assocPtBin == 8) { if((tpt <  0.5))                  continue; }  //       0.5+ GeV assoc bin used for correlations
       }
 
-      // get radial distance between track and jet axis
-      double deltaEtaBG = 1.0*TMath::Abs(jetEtaBG - teta);
-      double deltaPhiBG = 1.0*TMath::Abs(jetPhiBG - tphi);
-      if(deltaPhiBG > 1.0*pi) deltaPhiBG = 2.0*pi - deltaPhiBG;
-      double deltaR = 1.0*TMath::Sqrt(deltaEtaBG*deltaEtaBG + deltaPhiBG*deltaPhiBG);
+      // radial distance between track and BG cone axis
+      double deltaR = fGridDeltaR[icone];
       int annuliBin = GetAnnuliBin(deltaR);
       //if(annuliBin < 0) continue;
 
@@ -3305,8 +3308,8 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
     // event mixing for background jet cones
     if(fDoEventMixing > 0){
       // initialize background tracks array
-      TObjArray *bgTracks;
-      TObjArray *bgTracksCheck; // FIXME probably don't need another array to hold the *same* tracks
+      StEventPoolTrackView bgTracks;
+      StEventPoolTrackView bgTracksCheck; // FIXME probably don't need another array to hold the *same* tracks
 
       // do event mixing when Signal Jet is part of event with a HT1 or HT2 or HT3 trigger firing
       if(pool->IsReady() || pool->NTracksInPool() > fNMIXtracks || pool->GetCurrentNEvents() >= fNMIXevents) {
@@ -3326,23 +3329,19 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
           // loop over nMix events: find 'bad' mixed events to drop - dropping events where background jet cone reaches threshold fraction
           for(int jMix = 0; jMix < nMix; jMix++) {
             // get jMix'th event
-            bgTracksCheck = pool->GetEvent(jMix);
-            const Int_t Nbgtrks = bgTracksCheck->GetEntries();
+            bgTracksCheck = pool->GetEventTracks(jMix);
+            const Int_t Nbgtrks = bgTracksCheck.n;
 
             // sum everything in background cone to compare
             double backgroundPtConeSum = 0.0;
 
             // loop over background (mixed event) tracks
             for(int ibg = 0; ibg < Nbgtrks; ibg++) {
-              // slimmed PicoTrack class: StFemtoTrack
-              StFemtoTrack *trk = static_cast<StFemtoTrack*>(bgTracksCheck->At(ibg));
-              if(!trk) continue;
-
               // mixed track variables
-              double Mphi = trk->Phi();
-              double Meta = trk->Eta();
-              double Mpt = trk->Pt();
-              //int mMBTrig = trk->MBTrig(); // FIXME don't need to worry much about this for jet shape
+              double Mphi = bgTracksCheck.phi[ibg];
+              double Meta = bgTracksCheck.eta[ibg];
+              double Mpt = bgTracksCheck.pt[ibg];
+              //int mMBTrig = (int)bgTracksCheck.trig[ibg]; // FIXME don't need to worry much about this for jet shape
             
               // shift angle (0, 2*pi) 
               if(Mphi < 0.0)    Mphi += 2.0*pi;
@@ -3385,8 +3384,8 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
         // loop over nMix events: fill mixed event histos here
         for(int jMix = 0; jMix < nMix; jMix++) {
           // get jMix'th event
-          bgTracks = pool->GetEvent(jMix);
-          const Int_t Nbgtrks = bgTracks->GetEntries();
+          bgTracks = pool->GetEventTracks(jMix);
+          const Int_t Nbgtrks = bgTracks.n;
 
           // reset annuli sums here - when NOT normalizing by nMix
           double rsumBG3[10] = {0.0};
@@ -3407,15 +3406,11 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
 
           // loop over background (mixed event) tracks
           for(int ibg = 0; ibg < Nbgtrks; ibg++) {
-            // slimmed PicoTrack class: StFemtoTrack
-            StFemtoTrack *trk = static_cast<StFemtoTrack*>(bgTracks->At(ibg));
-            if(!trk) continue;
-
             // mixed track variables
-            double Mphi = trk->Phi();
-            double Meta = trk->Eta();
-            double Mpt = trk->Pt();
-            //int mMBTrig = trk->MBTrig(); // FIXME don't need to worry much about this for jet shape
+            double Mphi = bgTracks.phi[ibg];
+            double Meta = bgTracks.eta[ibg];
+            double Mpt = bgTracks.pt[ibg];
+            //int mMBTrig = (int)bgTracks.trig[ibg]; // FIXME don't need to worry much about this for jet shape
 
             // shift angle (0, 2*pi) 
             if(Mphi < 0.0)    Mphi += 2.0*pi;
@@ -3466,14 +3461,14 @@ void StMyAnalysisMaker3::JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_
             //============================================================================================
             // centrality & z-vtx correction to event level: tracks
             // mixed track z-vtx weights based on MB5/MB30
-            ////int mMBTrig = trk->MBTrig();      // mixed event trigger: where track came from
+            ////int mMBTrig = (int)bgTracks.trig[ibg];      // mixed event trigger: where track came from
 
             // combined correction factor - zvtx and RefMultCorr dependency
-            ////double fMixWeightCorrFactor = trk->ReWeightCorr();
+            ////double fMixWeightCorrFactor = bgTracks.weight[ibg];
 
             // get info from first track for scaling/correction of MB5->MB30
             //	- entire mixed event will have same MB trigger (zvtx + RefMultCorr)
-            if(ibg == 0)  fMixEvtWeightCorrFactor = trk->ReWeightCorr();
+            if(ibg == 0)  fMixEvtWeightCorrFactor = bgTracks.weight[ibg];
 
             //=============================================================================================
 
@@ -3592,8 +3587,10 @@ void StMyAnalysisMaker3::AddEventPoolsToOutput(Double_t minCent, Double_t maxCen
 }
 //
 // Jet hadron correlation analysis function
+// all pt assoc bins are done in one pass over the same event and mixed event tracks:
+// each track is routed to its pt assoc bin, which has its own event plane angle
 //______________________________________________________________________________________________________________________________
-void StMyAnalysisMaker3::JetHadronCorrelationAnalysis(StJet *jet, StEventPool *pool, Int_t centbin, Int_t assocPtBin) {
+void StMyAnalysisMaker3::JetHadronCorrelationAnalysis(StJet *jet, StEventPool *pool, Int_t centbin) {
     // get number of jets, tracks, and global tracks in events
     Int_t njets = fJets->GetEntries();
     const Int_t ntracks = mPicoDst->numberOfTracks();
@@ -3658,19 +3655,19 @@ void StMyAnalysisMaker3::JetHadronCorrelationAnalysis(StJet *jet, StEventPool *p
     // check for jets with only 1 constituent
     int nJetConstituents = jet->GetNumberOfConstituents();
     if(nJetConstituents == 1) {
-      if(assocPtBin==0) hStats->Fill(21);
+      hStats->Fill(21);
       if(doSkip1ParticleJets)  return;
     }
 
     // require tower and or track bias for jet
     if(doBiasJetLeadConstituent && (jet->GetMaxTrackPt() < fTrackBias) && (jet->GetMaxTowerEt() < fTowerBias)) {
-      if(assocPtBin==0) hStats->Fill(23);
+      hStats->Fill(23);
       return;
     }
 
     // check that jet contains a tower that fired the trigger
     if(doRequireJetTowFireTrig && !DidTowerConstituentFireTrigger(jet)) {
-      if(assocPtBin==0) hStats->Fill(24);
+      hStats->Fill(24);
       return;
     }
 
@@ -3678,143 +3675,172 @@ void StMyAnalysisMaker3::JetHadronCorrelationAnalysis(StJet *jet, StEventPool *p
     // get StEventPlaneMaker from event
     StEventPlaneMaker *EventPlaneMaker[5];
 
-    // pt-dependent bin mode
-    const char *fEventPlaneMakerNameChTemp = fEventPlaneMakerName;
+    // pt-dependent bin mode: one maker per bin, or one maker for all bins
     for(int i = 0; i < 5; i++) {
-      EventPlaneMaker[i] = static_cast<StEventPlaneMaker*>(GetMaker(Form("%s%i", fEventPlaneMakerNameChTemp, i)));
-    }
-
-    // event plane bin to use: pt dependent ranges
-    int ptAssocBins[9] = {0, 1, 2, 3, 4, 4,4,4,4};
-    int EPBinToUse = ptAssocBins[assocPtBin];
-
-    // check for requested EventPlaneMaker pointer
-    if(!EventPlaneMaker[EPBinToUse]) { LOG_WARN<<Form("No EventPlaneMaker bin: %i!", EPBinToUse)<<endm; return; }
-
-    // get event plane angle for different pt bins - assign global event plane to selected pt-dependent bin
-    // could also write this as:  tpc2EP_bin = (EventPlaneMaker) ? (double)EventPlaneMaker->GetTPCEP() : -999;
-    double tpc2EP  = (EventPlaneMaker[EPBinToUse]) ? (double)EventPlaneMaker[EPBinToUse]->GetTPCEP() : -999;
-
-    // if requiring a single event plane angle (non-pt dependent): use charged tracks 0.2-2.0 GeV to calculate EP
-    if(doUseMainEPAngle) {
-      tpc2EP  = (EventPlaneMaker[4]) ? (double)EventPlaneMaker[4]->GetTPCEP() : -999;
+      EventPlaneMaker[i] = GetEventPlaneMaker(fEventPlaneMakerName, i);
     }
 
-    // get relative angle between jet and event plane
-    double dEP = (!doppAnalysis) ? RelativeEPJET(jetPhi, tpc2EP) : -99.; // CORRECTED event plane angle - STEP3
-
-    // get relative jet-event plane bin
-    int EPBin = (!doppAnalysis) ? GetJetEPBin(dEP) : 0; // this secures it will still run for pp, and use EP bin = 0
-    if(EPBin < 0) return;
-
-    // =======================================================================================================================================
-    // =======================================================================================================================================
-
-    // fill some jet histograms
-    if(assocPtBin == 0) { // fill only once, so do it for lowest pt assoc bin
-      hJetPt->Fill(jetPt);
-      hJetCorrPt->Fill(corrjetPt);
-      hJetE->Fill(jetE);
-      hJetEta->Fill(jetEta);
-      hJetPhi->Fill(jetPhi);
-      hJetNEF->Fill(jetNEF);
-      hJetArea->Fill(jetArea);
-      hJetMass->Fill(jetMass);
-      hJetPtvsArea->Fill(jetPt, jetArea);
+    // event plane angle and jet - event plane angle for each pt assoc bin
+    // a bin without event plane (or jet - event plane bin) is not filled
+    bool doAssocPtBin[kNAssocPtBins];
+    double dEPBin[kNAssocPtBins];
+    int nAssocPtBinsUsed = 0;
+    for(int assocPtBin = 0; assocPtBin < kNAssocPtBins; assocPtBin++) {
+      doAssocPtBin[assocPtBin] = kFALSE;
+      dEPBin[assocPtBin] = -99.;
+
+      // event plane bin to use: pt dependent ranges
+      int ptAssocBins[9] = {0, 1, 2, 3, 4, 4,4,4,4};
+      int EPBinToUse = ptAssocBins[assocPtBin];
+
+      // check for requested EventPlaneMaker pointer
+      if(!EventPlaneMaker[EPBinToUse]) { LOG_WARN<<Form("No EventPlaneMaker bin: %i!", EPBinToUse)<<endm; continue; }
+
+      // get event plane angle for different pt bins - assign global event plane to selected pt-dependent bin
+      // could also write this as:  tpc2EP_bin = (EventPlaneMaker) ? (double)EventPlaneMaker->GetTPCEP() : -999;
+      double tpc2EP  = (EventPlaneMaker[EPBinToUse]) ? (double)EventPlaneMaker[EPBinToUse]->GetTPCEP(EPBinToUse) : -999;
+
+      // if requiring a single event plane angle (non-pt dependent): use charged tracks 0.2-2.0 GeV to calculate EP
+      if(doUseMainEPAngle) {
+        tpc2EP  = (EventPlaneMaker[4]) ? (double)EventPlaneMaker[4]->GetTPCEP(4) : -999;
+      }
 
-      hJetHTrigMaxTowEt->Fill(jet->GetMaxTowerEt());
-      hJetHTrigMaxTrkPt->Fill(jet->GetMaxTrackPt());
-    }
-    hJetEventEP[assocPtBin]->Fill(tpc2EP);
-    hJetPhivsEP[assocPtBin]->Fill(jetPhi, tpc2EP);
-
-    // fill some jet QA plots for each orientation
-    if(dEP >= 0.0*pi/6.0 && dEP < 1.0*pi/6.0) {
-      hJetPtIn[assocPtBin]->Fill(jetPt);
-      hJetPhiIn[assocPtBin]->Fill(jetPhi);
-      hJetEtaIn[assocPtBin]->Fill(jetEta);
-      hJetEventEPIn[assocPtBin]->Fill(tpc2EP);
-      hJetPhivsEPIn[assocPtBin]->Fill(jetPhi, tpc2EP);
-    } else if(dEP >= 1.0*pi/6.0 && dEP < 2.0*pi/6.0) {
-      hJetPtMid[assocPtBin]->Fill(jetPt);
-      hJetPhiMid[assocPtBin]->Fill(jetPhi);
-      hJetEtaMid[assocPtBin]->Fill(jetEta);
-      hJetEventEPMid[assocPtBin]->Fill(tpc2EP);
-      hJetPhivsEPMid[assocPtBin]->Fill(jetPhi, tpc2EP);
-    } else if(dEP >= 2.0*pi/6.0 && dEP <= 3.0*pi/6.0) {
-      hJetPtOut[assocPtBin]->Fill(jetPt);
-      hJetPhiOut[assocPtBin]->Fill(jetPhi);
-      hJetEtaOut[assocPtBin]->Fill(jetEta);
-      hJetEventEPOut[assocPtBin]->Fill(tpc2EP);
-      hJetPhivsEPOut[assocPtBin]->Fill(jetPhi, tpc2EP);
-    }
+      // get relative angle between jet and event plane
+      double dEP = (!doppAnalysis) ? RelativeEPJET(jetPhi, tpc2EP) : -99.; // CORRECTED event plane angle - STEP3
+
+      // get relative jet-event plane bin
+      int EPBin = (!doppAnalysis) ? GetJetEPBin(dEP) : 0; // this secures it will still run for pp, and use EP bin = 0
+      if(EPBin < 0) continue;
+
+      // pt assoc bin is used: keep its jet - event plane angle
+      doAssocPtBin[assocPtBin] = kTRUE;
+      dEPBin[assocPtBin] = dEP;
+      nAssocPtBinsUsed++;
+
+      // =======================================================================================================================================
+      // =======================================================================================================================================
+
+      // fill some jet histograms
+      if(assocPtBin == 0) { // fill only once, so do it for lowest pt assoc bin
+        hJetPt->Fill(jetPt);
+        hJetCorrPt->Fill(corrjetPt);
+        hJetE->Fill(jetE);
+        hJetEta->Fill(jetEta);
+        hJetPhi->Fill(jetPhi);
+        hJetNEF->Fill(jetNEF);
+        hJetArea->Fill(jetArea);
+        hJetMass->Fill(jetMass);
+        hJetPtvsArea->Fill(jetPt, jetArea);
+
+        hJetHTrigMaxTowEt->Fill(jet->GetMaxTowerEt());
+        hJetHTrigMaxTrkPt->Fill(jet->GetMaxTrackPt());
+      }
+      hJetEventEP[assocPtBin]->Fill(tpc2EP);
+      hJetPhivsEP[assocPtBin]->Fill(jetPhi, tpc2EP);
+
+      // fill some jet QA plots for each orientation
+      if(dEP >= 0.0*pi/6.0 && dEP < 1.0*pi/6.0) {
+        hJetPtIn[assocPtBin]->Fill(jetPt);
+        hJetPhiIn[assocPtBin]->Fill(jetPhi);
+        hJetEtaIn[assocPtBin]->Fill(jetEta);
+        hJetEventEPIn[assocPtBin]->Fill(tpc2EP);
+        hJetPhivsEPIn[assocPtBin]->Fill(jetPhi, tpc2EP);
+      } else if(dEP >= 1.0*pi/6.0 && dEP < 2.0*pi/6.0) {
+        hJetPtMid[assocPtBin]->Fill(jetPt);
+        hJetPhiMid[assocPtBin]->Fill(jetPhi);
+        hJetEtaMid[assocPtBin]->Fill(jetEta);
+        hJetEventEPMid[assocPtBin]->Fill(tpc2EP);
+        hJetPhivsEPMid[assocPtBin]->Fill(jetPhi, tpc2EP);
+      } else if(dEP >= 2.0*pi/6.0 && dEP <= 3.0*pi/6.0) {
+        hJetPtOut[assocPtBin]->Fill(jetPt);
+        hJetPhiOut[assocPtBin]->Fill(jetPhi);
+        hJetEtaOut[assocPtBin]->Fill(jetEta);
+        hJetEventEPOut[assocPtBin]->Fill(tpc2EP);
+        hJetPhivsEPOut[assocPtBin]->Fill(jetPhi, tpc2EP);
+      }
+    } // pt assoc bin loop
+    if(nAssocPtBinsUsed == 0) return;
 
     // get nTracks and maxTrackPt
     double maxtrackPt = jet->GetMaxTrackPt();
     int NtrackConstit = jet->GetNumberOfTracks();
     if(fDebugLevel == kDebugJetConstituents) cout<<"JetPt = "<<jetPt<<"  JetE = "<<jetE<<"   MaxtrackPt = "<<maxtrackPt<<"  NtrackConstit = "<<NtrackConstit<<endl;
     
+    // to limit filling unused entries in sparse: only fill for selected centrality
+    bool fillSparse = (fReduceStatsCent <= 0 || cbin == fReduceStatsCent);
+
     // ====================================================================================
     // set up and fill jet THnSparse for trigger jet normalization
-    Double_t CorrEntries[5] = {centBinToUse, jetPtselected, dEP, zVtx, (double)assocPtBin};
-    if(fReduceStatsCent > 0) {
-      if(cbin == fReduceStatsCent) fhnCorr->Fill(CorrEntries); // fill Sparse Histo with trigger Jets entries
-    } else fhnCorr->Fill(CorrEntries);                         // fill Sparse Histo with trigger Jets entries
+    for(int assocPtBin = 0; assocPtBin < kNAssocPtBins; assocPtBin++) {
+      if(!doAssocPtBin[assocPtBin]) continue;
+      Double_t CorrEntries[5] = {centBinToUse, jetPtselected, dEPBin[assocPtBin], zVtx, (double)assocPtBin};
+      if(fillSparse) fhnCorr->Fill(CorrEntries); // fill Sparse Histo with trigger Jets entries
+    }
     // ======================================================================================
 
+    // single particle tracking efficiency inputs of the event
+    int effCent   = mCentMaker->GetRef16();
+    double fZDCx  = mPicoEvent->ZDCx();
+
     // track loop inside jet loop - loop over ALL tracks in PicoDst
     for(int itrack = 0; itrack < ntracks; itrack++){
-      // get track pointer
-      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(itrack));
-      if(!trk) continue; 
-
-      // acceptance and kinematic quality cuts
-      if(!AcceptTrack(trk, Bfield, mVertex)) continue;
-
-      // get momentum vector of track - global or primary track
-      TVector3 mTrkMom;
-      if(doUsePrimTracks) { mTrkMom = trk->pMom();                  // primary track vector
-      } else {              mTrkMom = trk->gMom(mVertex, Bfield); } // global track vector
-
-      // track variables
-      double pt = mTrkMom.Perp();
-      double phi = mTrkMom.Phi();
-      double eta = mTrkMom.PseudoRapidity();
-      short charge = trk->charge();
-
-      // shift angle (0, 2*pi)
-      if(phi < 0.0)    phi += 2.0*pi;
-      if(phi > 2.0*pi) phi -= 2.0*pi;
+      // track variables - from shared track cache if available
+      double pt, phi, eta;
+      short charge;
+      if(mTrackCache) {
+        if(!AcceptTrack(mTrackCache, itrack)) continue;
+        pt = mTrackCache->GetPt(itrack);
+        phi = mTrackCache->GetPhi(itrack);   // (0, 2pi)
+        eta = mTrackCache->GetEta(itrack);
+        charge = mTrackCache->GetCharge(itrack);
+      } else {
+        // get track pointer
+        StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(itrack));
+        if(!trk) continue; 
+
+        // acceptance and kinematic quality cuts
+        if(!AcceptTrack(trk, Bfield, mVertex)) continue;
+
+        // get momentum vector of track - global or primary track
+        TVector3 mTrkMom;
+        if(doUsePrimTracks) { mTrkMom = trk->pMom();                  // primary track vector
+        } else {              mTrkMom = trk->gMom(mVertex, Bfield); } // global track vector
+
+        pt = mTrkMom.Perp();
+        phi = mTrkMom.Phi();
+        eta = mTrkMom.PseudoRapidity();
+        charge = trk->charge();
+
+        // shift angle (0, 2*pi)
+        if(phi < 0.0)    phi += 2.0*pi;
+        if(phi > 2.0*pi) phi -= 2.0*pi;
+      }
 
       // get jet - track variables
       //deta = eta - jetEta;                    // eta betweeen hadron and jet
       double deta = jetEta - eta;               // eta betweeen jet and hadron
       double dphijh = RelativePhi(jetPhi, phi); // angle between jet and hadron
 
-      // exclusion of track pt ranges from filling - need to use specific EP value
-      // 0.20-0.5, 0.5-1.0, 1.0-1.5, 1.5-2.0, 2.0-20.0 GeV - when doing event plane calculation via pt assoc bin
-      // when doing event plane calculation via pt assoc bin
-      // 	if(assocPtBin == 0) { if(pt < 0.20 || pt >= 0.5) continue; }  // 0.20 - 0.5 GeV assoc bin used for correlations
+      // route track to its pt assoc bin: 0.20-0.5, 0.5-1.0, 1.0-1.5, 1.5-2.0, 2.0-20.0 GeV
+      // when doing event plane calculation via pt assoc bin - otherwise the track is used for every bin
+      int firstBin = 0, lastBin = kNAssocPtBins - 1;
       if(doTPCptassocBin) {
-        if(assocPtBin == 0) { if(pt < 0.20 || pt >= 0.5) continue; }  // 0.20 - 0.5 GeV assoc bin used for correlations
-        if(assocPtBin == 1) { if(pt < 0.50 || pt >= 1.0) continue; }  // 0.50 - 1.0 GeV assoc bin used for correlations
-        if(assocPtBin == 2) { if(pt < 1.00 || pt >= 1.5) continue; }  // 1.00 - 1.5 GeV assoc bin used for correlations
-        if(assocPtBin == 3) { if(pt < 1.50 || pt >= 2.0) continue; }  // 1.50 - 2.0 GeV assoc bin used for correlations
-        if(assocPtBin == 4) { if(pt < 2.00 || pt >= 20.) continue; }  // 2.00 - MAX GeV assoc bin used for correlations
+        firstBin = lastBin = GetAssocPtBin(pt);
+        if(firstBin < 0) continue;
       }
 
-      // calculate single particle tracking efficiency of mixed events for correlations
-      int effCent   = mCentMaker->GetRef16();
-      double fZDCx  = mPicoEvent->ZDCx();
+      // calculate single particle tracking efficiency for correlations
       double trkEfficiency = ApplyTrackingEff(fDoEffCorr, pt, eta, effCent, fZDCx, fTrackEfficiencyType, fEfficiencyInputFile);
- 
-      // fill jet sparse (signal jets correlated with tracks from the same event)
-      double triggerEntries[9] = {centBinToUse, jetPtselected, pt, deta, dphijh, dEP, zVtx, (double)charge, (double)assocPtBin};
-      if(fReduceStatsCent > 0) {
-        if(cbin == fReduceStatsCent) fhnJH->Fill(triggerEntries, 1.0/trkEfficiency);  // fill Sparse Histo with trigger entries
-      } else fhnJH->Fill(triggerEntries, 1.0/trkEfficiency);
 
-      fHistJetHEtaPhi->Fill(deta, dphijh); // fill jet-hadron  eta--phi distribution
+      for(int assocPtBin = firstBin; assocPtBin <= lastBin; assocPtBin++) {
+        if(!doAssocPtBin[assocPtBin]) continue;
+
+        // fill jet sparse (signal jets correlated with tracks from the same event)
+        double triggerEntries[9] = {centBinToUse, jetPtselected, pt, deta, dphijh, dEPBin[assocPtBin], zVtx, (double)charge, (double)assocPtBin};
+        if(fillSparse) fhnJH->Fill(triggerEntries, 1.0/trkEfficiency);  // fill Sparse Histo with trigger entries
+
+        fHistJetHEtaPhi->Fill(deta, dphijh); // fill jet-hadron  eta--phi distribution
+      }
     } // track loop
 
     // ***************************************************************************************************************
@@ -3822,7 +3848,7 @@ void StMyAnalysisMaker3::JetHadronCorrelationAnalysis(StJet *jet, StEventPool *p
     // ***************************************************************************************************************
     if(fDoEventMixing) {
       // initialize background tracks array
-      TObjArray *bgTracks;
+      StEventPoolTrackView bgTracks;
 
       // check for readiness of using the event pool
       if(pool->IsReady() || pool->NTracksInPool() > fNMIXtracks || pool->GetCurrentNEvents() >= fNMIXevents) {
@@ -3834,21 +3860,21 @@ void StMyAnalysisMaker3::JetHadronCorrelationAnalysis(StJet *jet, StEventPool *p
         int nMix = pool->GetCurrentNEvents();
 
         // QA histogram
-        if(assocPtBin == 0) hNMixEvents->Fill(nMix);
+        hNMixEvents->Fill(nMix);
         //double sumMixTrkPt = 0.0;
 
         //----------------------==---------------------==
         // correction factors generated for MB5 and MB30 mixed event triggered events
         // bins 4-17 (-28 cm < z < +28 cm)
         // === z-vtx event weight ===
-        double mCorrEvtMB5[] = {0.,0.,0., 187.641, 186.714, 54.9565, 9.34451, 2.15293, 0.509046, 0.279472, 0.375596, 1.2418, 8.87955, 55.0963, 219.312, 222.645, 100.253, 0.,0.,0.};
-        double mCorrEvtMB30[]= {0.,0.,0., 0.965911, 0.944671, 0.961855, 0.969395, 0.992681, 1.00764, 1.01291, 1.01672, 1.02394, 1.01706, 1.01427, 1.02102, 0.995457, 0.933781, 0.,0.,0. };
+        static const double mCorrEvtMB5[] = {0.,0.,0., 187.641, 186.714, 54.9565, 9.34451, 2.15293, 0.509046, 0.279472, 0.375596, 1.2418, 8.87955, 55.0963, 219.312, 222.645, 100.253, 0.,0.,0.};
+        static const double mCorrEvtMB30[]= {0.,0.,0., 0.965911, 0.944671, 0.961855, 0.969395, 0.992681, 1.00764, 1.01291, 1.01672, 1.02394, 1.01706, 1.01427, 1.02102, 0.995457, 0.933781, 0.,0.,0. };
         // === z-vtx pair weight ===
-        double mCorrPairMB5[]  = {0.,0.,0., 77.7527, 118.323, 19.5824, 3.22157, 1.10644, 0.618831, 0.57329, 0.596431, 0.787707, 4.03378, 22.5516, 83.528, 60.2196, 61.6985, 0.,0.,0.};
-        double mCorrPairMB30[] = {0.,0.,0., 0.487022, 0.485908, 0.496887, 0.5761, 0.906906, 2.91743, 4.85915, 3.59698, 1.40364, 0.554785, 0.495122, 0.486797, 0.487971, 0.48787, 0.,0.,0.};
+        static const double mCorrPairMB5[]  = {0.,0.,0., 77.7527, 118.323, 19.5824, 3.22157, 1.10644, 0.618831, 0.57329, 0.596431, 0.787707, 4.03378, 22.5516, 83.528, 60.2196, 61.6985, 0.,0.,0.};
+        static const double mCorrPairMB30[] = {0.,0.,0., 0.487022, 0.485908, 0.496887, 0.5761, 0.906906, 2.91743, 4.85915, 3.59698, 1.40364, 0.554785, 0.495122, 0.486797, 0.487971, 0.48787, 0.,0.,0.};
 
         // refMultCorr weight
-        double corrWeightMB5[400] = { 1, 1, 1, 1, 0.463132, 0.447399, 0.456894, 0.457888, 0.467025, 0.467753, 0.477598, 0.481366, 0.484178, 0.493661, 0.496542, 0.49247, 0.509866, 0.510392, 0.521268, 0.518482, 0.518401, 0.526676, 0.532358, 0.533281, 0.530995, 0.550151, 0.549585, 0.554638, 0.567733, 0.56153, 0.573564, 0.572213, 0.585449, 0.577954, 0.585248, 0.59389, 0.597588, 0.611146, 0.609299, 0.617343, 0.628944, 0.615209, 0.617127, 0.625614, 0.633712, 0.639474, 0.647667, 0.648651, 0.656923, 0.656513, 0.673715, 0.671305, 0.677296, 0.673676, 0.695857, 0.687348, 0.684638, 0.685504, 0.706412, 0.703819, 0.71537, 0.710097, 0.725844, 0.723751, 0.72968, 0.737968, 0.730032, 0.755147, 0.734857, 0.747815, 0.761912, 0.774854, 0.783057, 0.776158, 0.78032, 0.791162, 0.809159, 0.7881, 0.803188, 0.81818, 0.801941, 0.8227, 0.820565, 0.827572, 0.842145, 0.853173, 0.843049, 0.866117, 0.850376, 0.85609, 0.885141, 0.89255, 0.916774, 0.899683, 0.89318, 0.895233, 0.907137, 0.905279, 0.912297, 0.915815, 0.948379, 0.962052, 0.957042, 0.941978, 0.959425, 0.981227, 0.969597, 0.990494, 0.977178, 0.970842, 0.977962, 0.989116, 0.984259, 1.00604, 1.00933, 1.03903, 1.02118, 1.01738, 1.04185, 1.06259, 1.06095, 1.06253, 1.08362, 1.08336, 1.07505, 1.10287, 1.10887, 1.13512, 1.11754, 1.1389, 1.12494, 1.14724, 1.12168, 1.13811, 1.18041, 1.14112, 1.16631, 1.16014, 1.1974, 1.18266, 1.21974, 1.20836, 1.20947, 1.24196, 1.2366, 1.30608, 1.25214, 1.27501, 1.29812, 1.29725, 1.32099, 1.30637, 1.31007, 1.35369, 1.32903, 1.34519, 1.35968, 1.38831, 1.37858, 1.40441, 1.37679, 1.42124, 1.41042, 1.44202, 1.43458, 1.51292, 1.42363, 1.46818, 1.47146, 1.4959, 1.51551, 1.54003, 1.54928, 1.56103, 1.56671, 1.55361, 1.61416, 1.63908, 1.6406, 1.62072, 1.63858, 1.64112, 1.66592, 1.6472, 1.65476, 1.69166, 1.72988, 1.70032, 1.78666, 1.73831, 1.77935, 1.77891, 1.82334, 1.84147, 1.89095, 1.81703, 1.81755, 1.84787, 1.88709, 1.98063, 1.8915, 1.94406, 1.95225, 2.01096, 1.9701, 1.96114, 2.05686, 2.04201, 2.07128, 2.05617, 2.0701, 2.13762, 2.1401, 2.16123, 2.19201, 2.17974, 2.17145, 2.21869, 2.22246, 2.19042, 2.20791, 2.23285, 2.26786, 2.29109, 2.31364, 2.32266, 2.29967, 2.30896, 2.46165, 2.37093, 2.41638, 2.4304, 2.43803, 2.46856, 2.47553, 2.48636, 2.53278, 2.44217, 2.55204, 2.53229, 2.57215, 2.60888, 2.61448, 2.63351, 2.63772, 2.64363, 2.69693, 2.60885, 2.74891, 2.66265, 2.73691, 2.81716, 2.73062, 2.74717, 2.81193, 2.89897, 2.76424, 2.92959, 2.88237, 2.86829, 2.92863, 3.07455, 3.12348, 2.9811, 2.99424, 2.88269, 3.03216, 3.13267, 3.09151, 3.00951, 3.15617, 3.14428, 3.17672, 3.10598, 3.28992, 3.30476, 3.20371, 3.25868, 3.15695, 3.32213, 3.38476, 3.24909, 3.24376, 3.21991, 3.18219, 3.31691, 3.4702, 3.42831, 3.68671, 3.69256, 3.35984, 3.53007, 3.05662, 3.50486, 3.23201, 3.62708, 3.49475, 3.70496, 3.22615, 3.1339, 3.82289, 3.82499, 3.49086, 4.21653, 3.7773, 3.94624, 3.45887, 4.11111, 3.96686, 3.73737, 3.47863, 2.50356, 2.14591, 2.89886, 4.51771, 2.24003, 3.68946, 6.32479, 3.86515, 2.63533, 6.85185, 6.32479, 4.74359, 3.16239, 1, 4.21653, 1.5812, 1, 1, 1, 1, 0.263533, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+        static const double corrWeightMB5[400] = { 1, 1, 1, 1, 0.463132, 0.447399, 0.456894, 0.457888, 0.467025, 0.467753, 0.477598, 0.481366, 0.484178, 0.493661, 0.496542, 0.49247, 0.509866, 0.510392, 0.521268, 0.518482, 0.518401, 0.526676, 0.532358, 0.533281, 0.530995, 0.550151, 0.549585, 0.554638, 0.567733, 0.56153, 0.573564, 0.572213, 0.585449, 0.577954, 0.585248, 0.59389, 0.597588, 0.611146, 0.609299, 0.617343, 0.628944, 0.615209, 0.617127, 0.625614, 0.633712, 0.639474, 0.647667, 0.648651, 0.656923, 0.656513, 0.673715, 0.671305, 0.677296, 0.673676, 0.695857, 0.687348, 0.684638, 0.685504, 0.706412, 0.703819, 0.71537, 0.710097, 0.725844, 0.723751, 0.72968, 0.737968, 0.730032, 0.755147, 0.734857, 0.747815, 0.761912, 0.774854, 0.783057, 0.776158, 0.78032, 0.791162, 0.809159, 0.7881, 0.803188, 0.81818, 0.801941, 0.8227, 0.820565, 0.827572, 0.842145, 0.853173, 0.843049, 0.866117, 0.850376, 0.85609, 0.885141, 0.89255, 0.916774, 0.899683, 0.89318, 0.895233, 0.907137, 0.905279, 0.912297, 0.915815, 0.948379, 0.962052, 0.957042, 0.941978, 0.959425, 0.981227, 0.969597, 0.990494, 0.977178, 0.970842, 0.977962, 0.989116, 0.984259, 1.00604, 1.00933, 1.03903, 1.02118, 1.01738, 1.04185, 1.06259, 1.06095, 1.06253, 1.08362, 1.08336, 1.07505, 1.10287, 1.10887, 1.13512, 1.11754, 1.1389, 1.12494, 1.14724, 1.12168, 1.13811, 1.18041, 1.14112, 1.16631, 1.16014, 1.1974, 1.18266, 1.21974, 1.20836, 1.20947, 1.24196, 1.2366, 1.30608, 1.25214, 1.27501, 1.29812, 1.29725, 1.32099, 1.30637, 1.31007, 1.35369, 1.32903, 1.34519, 1.35968, 1.38831, 1.37858, 1.40441, 1.37679, 1.42124, 1.41042, 1.44202, 1.43458, 1.51292, 1.42363, 1.46818, 1.47146, 1.4959, 1.51551, 1.54003, 1.54928, 1.56103, 1.56671, 1.55361, 1.61416, 1.63908, 1.6406, 1.62072, 1.63858, 1.64112, 1.66592, 1.6472, 1.65476, 1.69166, 1.72988, 1.70032, 1.78666, 1.73831, 1.77935, 1.77891, 1.82334, 1.84147, 1.89095, 1.81703, 1.81755, 1.84787, 1.88709, 1.98063, 1.8915, 1.94406, 1.95225, 2.01096, 1.9701, 1.96114, 2.05686, 2.04201, 2.07128, 2.05617, 2.0701, 2.13762, 2.1401, 2.16123, 2.19201, 2.17974, 2.17145, 2.21869, 2.22246, 2.19042, 2.20791, 2.23285, 2.26786, 2.29109, 2.31364, 2.32266, 2.29967, 2.30896, 2.46165, 2.37093, 2.41638, 2.4304, 2.43803, 2.46856, 2.47553, 2.48636, 2.53278, 2.44217, 2.55204, 2.53229, 2.57215, 2.60888, 2.61448, 2.63351, 2.63772, 2.64363, 2.69693, 2.60885, 2.74891, 2.66265, 2.73691, 2.81716, 2.73062, 2.74717, 2.81193, 2.89897, 2.76424, 2.92959, 2.88237, 2.86829, 2.92863, 3.07455, 3.12348, 2.9811, 2.99424, 2.88269, 3.03216, 3.13267, 3.09151, 3.00951, 3.15617, 3.14428, 3.17672, 3.10598, 3.28992, 3.30476, 3.20371, 3.25868, 3.15695, 3.32213, 3.38476, 3.24909, 3.24376, 3.21991, 3.18219, 3.31691, 3.4702, 3.42831, 3.68671, 3.69256, 3.35984, 3.53007, 3.05662, 3.50486, 3.23201, 3.62708, 3.49475, 3.70496, 3.22615, 3.1339, 3.82289, 3.82499, 3.49086, 4.21653, 3.7773, 3.94624, 3.45887, 4.11111, 3.96686, 3.73737, 3.47863, 2.50356, 2.14591, 2.89886, 4.51771, 2.24003, 3.68946, 6.32479, 3.86515, 2.63533, 6.85185, 6.32479, 4.74359, 3.16239, 1, 4.21653, 1.5812, 1, 1, 1, 1, 0.263533, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
 
         // get z-vtx and corresponding bins
         int zbin = GetZVertex4cmBin(zVtx);
@@ -3856,89 +3882,104 @@ void StMyAnalysisMaker3::JetHadronCorrelationAnalysis(StJet *jet, StEventPool *p
         if(ZvtxBin < 0) return;
         //----------------------==---------------------==
 
+        // quantities of the current event - the same for every pooled event and track
+        UInt_t fTrigMask = GetTriggerMask(fRunFlag);  // trigger bits of this event
+        bool fEmcTrigger = HasHTTrigger(fTrigMask, fEmcTriggerEventType);
+
         // fill mixed-event histos here: loop over nMix events
+        // sparse fills are accumulated in fMixedEventsBuffer and added once per jet, QA histos once per pooled event
         for(int jMix = 0; jMix < nMix; jMix++) {
           // get jMix'th event
-          bgTracks = pool->GetEvent(jMix);
-          //TObjArray *bgTracks = pool->GetEvent(jMix);
-          const Int_t Nbgtrks = bgTracks->GetEntries();
-
-          // loop over background (mixed event) tracks
+          bgTracks = pool->GetEventTracks(jMix);
+          const Int_t Nbgtrks = bgTracks.n;
+          if(Nbgtrks == 0) continue;
+
+          // mixed event z-vtx weight based on MB5/MB30: trigger is stored per track but set per pooled event
+          int mMBTrig = (int)bgTracks.trig[0];      // mixed event trigger: where tracks came from
+          double mMBTrigZWeight = 1.;
+          if(mMBTrig ==  5) mMBTrigZWeight = mCorrEvtMB5[zbin];  // weight for MB5:  corr(z)
+          if(mMBTrig == 30) mMBTrigZWeight = mCorrEvtMB30[zbin]; // weight for MB30: corr(z)
+
+          // get jet - track relations for all tracks of the pooled event (no branches, vectorizes)
+          if((int)fMixDEta.size() < Nbgtrks) { fMixDEta.resize(Nbgtrks); fMixDPhi.resize(Nbgtrks); fMixAssocBin.resize(Nbgtrks); }
+          double *dMixeta = &fMixDEta[0];
+          double *dMixphijh = &fMixDPhi[0];
+          const Float_t *mixEta = bgTracks.eta;
+          const Float_t *mixPhi = bgTracks.phi;
           for(int ibg = 0; ibg < Nbgtrks; ibg++) {
-            // get Femto track pointer
-            StFemtoTrack *trk = static_cast<StFemtoTrack*>(bgTracks->At(ibg));
-            if(!trk) continue;
+            // shift angle (0, 2*pi)
+            double Mixphi = mixPhi[ibg];
+            Mixphi += (Mixphi < 0.0)    ? 2.0*pi : 0.0;
+            Mixphi -= (Mixphi > 2.0*pi) ? 2.0*pi : 0.0;
 
-            // mixed track variables
-            double Mixphi = trk->Phi();       // mixed event track phi
-            double Mixeta = trk->Eta();     
-            double Mixpt = trk->Pt();
-            short Mixcharge = trk->Charge();
+            // angle between jet and hadron in [-0.5Pi, 1.5Pi] - as RelativePhi()
+            double dphi = jetPhi - Mixphi;
+            dphi += (dphi < -0.5*pi) ? 2.0*pi : 0.0;
+            dphi -= (dphi >  1.5*pi) ? 2.0*pi : 0.0;
 
-            // shift angle (0, 2*pi)
-            if(Mixphi < 0.0)    Mixphi += 2.0*pi;
-            if(Mixphi > 2.0*pi) Mixphi -= 2.0*pi;
+            dMixeta[ibg] = jetEta - mixEta[ibg];    // eta betweeen jet and hadron
+            dMixphijh[ibg] = dphi;
+          }
 
-            // get jet - track relations
-            //double deta = eta - jetEta;                   // eta betweeen hadron and jet
-            double dMixeta = jetEta - Mixeta;               // eta betweeen jet and hadron
-            double dMixphijh = RelativePhi(jetPhi, Mixphi); // angle between jet and hadron
+          // pt assoc bin of tracks - only when doing event plane calculation via pt assoc bin
+          int *mixAssocBin = &fMixAssocBin[0];
+          if(doTPCptassocBin) {
+            for(int ibg = 0; ibg < Nbgtrks; ibg++) mixAssocBin[ibg] = GetAssocPtBin(bgTracks.pt[ibg]);
+          }
+
+          // loop over background (mixed event) tracks
+          double sumw = 0., sumw2 = 0.;
+          int nPairs = 0;
+          for(int ibg = 0; ibg < Nbgtrks; ibg++) {
+            double Mixpt = bgTracks.pt[ibg];
+            int firstBin = 0, lastBin = kNAssocPtBins - 1;
+            if(doTPCptassocBin) {
+              firstBin = lastBin = mixAssocBin[ibg];
+              if(firstBin < 0) continue;
+            }
+            short Mixcharge = (short)bgTracks.charge[ibg];
 
             // print tracks outside of acceptance somehow and track characteristics
             if(fDebugLevel == kDebugMixedEvents) {
-              cout<<"itrack = "<<ibg<<"  phi = "<<Mixphi<<"  eta = "<<Mixeta<<"  pt = "<<Mixpt<<"  q = "<<Mixcharge<<endl;
-              if(TMath::Abs(dMixeta > 1.6)) cout<<"DELTA ETA out of bounds... deta = "<<dMixeta<<"   iTrack = "<<ibg<<"  jetEta = "<<jetEta<<"  trk eta = "<<Mixeta<<endl;
+              cout<<"itrack = "<<ibg<<"  phi = "<<bgTracks.phi[ibg]<<"  eta = "<<bgTracks.eta[ibg]<<"  pt = "<<Mixpt<<"  q = "<<Mixcharge<<endl;
+              if(TMath::Abs(dMixeta[ibg] > 1.6)) cout<<"DELTA ETA out of bounds... deta = "<<dMixeta[ibg]<<"   iTrack = "<<ibg<<"  jetEta = "<<jetEta<<"  trk eta = "<<bgTracks.eta[ibg]<<endl;
             }
 
-            // exclusion of track pt ranges from filling - need to use specific EP value
-            // 0.20-0.5, 0.5-1.0, 1.0-1.5, 1.5-2.0, 2.0-20.0 - when doing event plane calculation via pt assoc bin
-            //        if(assocPtBin == 0) { if(pt < 0.20 || pt >= 0.5) continue; }  // 0.20 - 0.5 GeV assoc bin used for correlations
-            if(doTPCptassocBin) {
-              if(assocPtBin == 0) { if(Mixpt < 0.20 || Mixpt >= 0.5) continue; }  // 0.20 - 0.5 GeV assoc bin used for correlations
-              if(assocPtBin == 1) { if(Mixpt < 0.50 || Mixpt >= 1.0) continue; }  // 0.50 - 1.0 GeV assoc bin used for correlations
-              if(assocPtBin == 2) { if(Mixpt < 1.00 || Mixpt >= 1.5) continue; }  // 1.00 - 1.5 GeV assoc bin used for correlations
-              if(assocPtBin == 3) { if(Mixpt < 1.50 || Mixpt >= 2.0) continue; }  // 1.50 - 2.0 GeV assoc bin used for correlations
-              if(assocPtBin == 4) { if(Mixpt < 2.00 || Mixpt >= 20.) continue; }  // 2.00 - MAX GeV assoc bin used for correlations
+            // single particle tracking efficiency of mixed events for correlations: stored at pool insertion
+            double mixtrkEfficiency = (bgTracks.eff && bgTracks.eff[ibg] >= 0.) ? bgTracks.eff[ibg] :
+              ApplyTrackingEff(fDoEffCorr, Mixpt, bgTracks.eta[ibg], effCent, fZDCx, fTrackEfficiencyType, fEfficiencyInputFile);
+            double mixWeight = 1./(nMix*mixtrkEfficiency);
+
+            // buffer mixed event sparse entry (signal jets correlated with tracks from mixed events) - one group per pt assoc bin
+            // combined correction factor: bgTracks.weight
+            double mixEntries[4] = {Mixpt, dMixeta[ibg], dMixphijh[ibg], (double)Mixcharge};
+            for(int assocPtBin = firstBin; assocPtBin <= lastBin; assocPtBin++) {
+              if(!doAssocPtBin[assocPtBin]) continue;
+              if(fillSparse) fMixedEventsBuffer->Fill(mixEntries, mixWeight * bgTracks.weight[ibg], assocPtBin);
+
+              sumw += mixWeight;
+              sumw2 += mixWeight*mixWeight;
+              nPairs++;
             }
-
-            //============================================================================================
-            // centrality & z-vtx correction to event level: tracks
-
-            // mixed track z-vtx weights based on MB5/MB30
-            int mMBTrig = trk->MBTrig();      // mixed event trigger: where track came from
-            double mMBTrigZWeight = 1.;
-            if(mMBTrig ==  5) mMBTrigZWeight = mCorrEvtMB5[zbin];  // mCorrPairMB5[zbin];   // weight for MB5:  corr(z)
-            if(mMBTrig == 30) mMBTrigZWeight = mCorrEvtMB30[zbin]; // mCorrPairMB30[zbin];  // weight for MB30: corr(z)
-
-            // combined correction factor
-            double fMixWeightCorrFactor = trk->ReWeightCorr();
-
-            //=============================================================================================
-
-            // calculate single particle tracking efficiency of mixed events for correlations (-999)
-            int effCent   = mCentMaker->GetRef16();
-            double fZDCx  = mPicoEvent->ZDCx();
-            double mixtrkEfficiency = ApplyTrackingEff(fDoEffCorr, Mixpt, Mixeta, effCent, fZDCx, fTrackEfficiencyType, fEfficiencyInputFile);
-
-            // create / fill mixed event sparse  (centbin*5.0) - (signal jets correlated with tracks from mixed events)
-            double triggerEntries[9] = {centBinToUse, jetPtselected, Mixpt, dMixeta, dMixphijh, dEP, zVtx, (double)Mixcharge, (double)assocPtBin};
-            if(fReduceStatsCent > 0) {
-              if(cbin == fReduceStatsCent) fhnMixedEvents->Fill(triggerEntries, 1./(nMix*mixtrkEfficiency) * fMixWeightCorrFactor);
-            } else fhnMixedEvents->Fill(triggerEntries, 1./(nMix*mixtrkEfficiency) * fMixWeightCorrFactor);   // fill Sparse histo of mixed events
-
-            // testing QA for trigger weights - Jan 2021
-            //if(assocPtBin == 0) {
-              bool fEmcTrigger = CheckForHT(fRunFlag, fEmcTriggerEventType);              
-
-              if(mMBTrig ==  5) hNPairsvsZvtxMB5->Fill(zVtx,  1./(nMix*mixtrkEfficiency));
-              if(mMBTrig == 30) hNPairsvsZvtxMB30->Fill(zVtx, 1./(nMix*mixtrkEfficiency));
-              if(fEmcTrigger)   hNPairsvsZvtxHT2->Fill(zVtx,  1./(nMix*mixtrkEfficiency));
-              if(mMBTrig ==  5) hNPairsvsZvtxMB5Wt->Fill(zVtx,  mMBTrigZWeight * 1./(nMix*mixtrkEfficiency));
-              if(mMBTrig == 30) hNPairsvsZvtxMB30Wt->Fill(zVtx, mMBTrigZWeight * 1./(nMix*mixtrkEfficiency));
-            //}
-
           } // end of background track loop
+
+          // testing QA for trigger weights - Jan 2021: one fill per pooled event with summed weights
+          if(mMBTrig ==  5) StSparseFillBuffer::FillSum(hNPairsvsZvtxMB5,  zVtx, sumw, sumw2, nPairs);
+          if(mMBTrig == 30) StSparseFillBuffer::FillSum(hNPairsvsZvtxMB30, zVtx, sumw, sumw2, nPairs);
+          if(fEmcTrigger)   StSparseFillBuffer::FillSum(hNPairsvsZvtxHT2,  zVtx, sumw, sumw2, nPairs);
+          if(mMBTrig ==  5) StSparseFillBuffer::FillSum(hNPairsvsZvtxMB5Wt,  zVtx, mMBTrigZWeight*sumw, mMBTrigZWeight*mMBTrigZWeight*sumw2, nPairs);
+          if(mMBTrig == 30) StSparseFillBuffer::FillSum(hNPairsvsZvtxMB30Wt, zVtx, mMBTrigZWeight*sumw, mMBTrigZWeight*mMBTrigZWeight*sumw2, nPairs);
         }   // end of filling mixed-event histo's:  jth mix event loop
+
+        // add buffered entries to mixed event sparse: (centbin*5.0), jet pt, dEP, z-vtx and assoc pt bin are fixed for the jet and bin
+        if(fillSparse) {
+          double triggerEntries[kNAssocPtBins][9];
+          for(int assocPtBin = 0; assocPtBin < kNAssocPtBins; assocPtBin++) {
+            double binEntries[9] = {centBinToUse, jetPtselected, 0., 0., 0., dEPBin[assocPtBin], zVtx, 0., (double)assocPtBin};
+            for(int i = 0; i < 9; i++) triggerEntries[assocPtBin][i] = binEntries[i];
+          }
+          fMixedEventsBuffer->Flush(&triggerEntries[0][0]);
+        }
       }     // end of check for pool being ready
     }       // end of fDoEventMixing
  
@@ -3990,121 +4031,13 @@ void StMyAnalysisMaker3::FillTriggerIDs(TH1 *h) {
 
 }
 // Returns correction for tracking efficiency
-//
-//Double_t StJetFrameworkPicoBase::ApplyTrackingEffpp(StPicoTrack *trk)
-//Double_t StJetFrameworkPicoBase::ApplyTrackingEffAuAu(StPicoTrack *trk)
+// - efficiency of the base class (StJetFrameworkPicoBase), scaled for the tracking efficiency systematic
 //____________________________________________________________________________________________
 Double_t StMyAnalysisMaker3::ApplyTrackingEff(Bool_t applyEff, Double_t tpt, Double_t teta, Int_t cbin, Double_t ZDCx, Int_t effType, TFile *infile)
 {
-  // initialize effieciency - check we want to apply it
-  double trkEff = 1.0;
-  if(!applyEff) return trkEff;
-
-  // x-variable = track pt, y-variable = track eta
-  double x = tpt;
-  double y = teta;
-  //y = TMath::Abs(teta);
-  double pi = 1.0*TMath::Pi();
-  double effBinContent = -99; // value extracted from histogram
-  const char *species =  "pion"; // FIXME
-  int lumiBin = GetLuminosityBin(ZDCx);
-
-  //const int nspecies = 3;
-  //std::string species[nspecies] = {"pion", "kaon", "proton"};
-  //std::string leg_species[nspecies] = {"#pion", "K", "p"};
-  //std::string particles[nparticles] = {"piplus", "piminus", "kaonplus", "kaonminus", "proton", "antiproton"};
-  //std::string leg_particles[nparticles] = {"#pi^{+}", "#pi^{-}", "K^{+}", "K^{-}", "p", "#bar{p}"};
-  //hTrack_Efficiency_pTEta[is][ic][il] = new TH2D(Form("hTrack_%s_Efficiency_pTEta_%s_centbin%d", species[is].c_str(), lumi[il].c_str(), ic), "", 100, 0, 10, 10, -1, 1);
-
-  // ========== AuAu Run14 ===========
-  if(fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200 || fRunFlag == StJetFrameworkPicoBase::Run14_AuAu200_MB) {
-    // cut on pt: 0.2 - 30.0 GeV
-    // cut on eta: -1.0 < eta < 1.0
-    // pt is flat for AuAu above 5.0 (4.5) GeV
-    if(x > 4.5) x = 4.5;  // for pt > 4.5 use value at 4.5
-    int effBin = -99;
-
-    // 2-D pt/eta dependent efficiency
-    if(effType == StJetFrameworkPicoBase::kNormalPtEtaBased) {
-      // get 2D pTEta efficiency histo
-      //const char *histName = Form("hTrack_%s_Efficiency_pTEta_centbin%d_lumibin%d", species, cbin, lumiBin);
-      const char *histName = Form("hTrack_%s_Efficiency_pTEta_final_centbin%d_lumibin%d", species, cbin, lumiBin);
-      TH2F *h = static_cast<TH2F*>(infile->Get(Form("%s", histName)));
-      if(!h) cout<<"don't have requested histogram! "<<Form("%s", histName)<<endl;
-      h->SetName(Form("%s", histName));
-
-      // get efficiency 
-      effBin = h->FindBin(x, y); // pt, eta
-      effBinContent = h->GetBinContent(effBin);
-      //double effBinContentErr = h->GetBinError(effBin);
-      //cout<<"effBinContent: "<<effBinContent<<"   effBinErr: "<<effBinContentErr<<endl;
-
-      // delete histo and close input file
-      delete h;
-    }
-
-    // test statement
-    //cout<<"efficiency: "<<effBinContent<<"  pt: "<<x<<"  eta: "<<y<<"   cbin: "<<cbin<<"  lumi: "<<ZDCx<<endl;
-  } // Run14 AuAu
-
-  // =========================================================================================================
-  // =========================================================================================================
-  // =========  Run12 pp tracking efficiency: ========
-  if(fRunFlag == StJetFrameworkPicoBase::Run12_pp200) { // the below is probably true of all pp datasets 
-    // cut on pt: 0.2 - 30.0 GeV
-    // cut on eta: -1.0 < eta < 1.0
-    // pt is flat for pp above 2.0 (1.8) GeV 
-    if(x > 1.8) x = 1.8;  // for pt > 1.8 use value at 1.8
-
-    // some of the below is not used for the current pp parametrization
-    int effBin = -99;
-
-    // 2-D pt/eta dependent efficiency
-    if(effType == StJetFrameworkPicoBase::kNormalPtEtaBased) {
-      // get 2D pTEta efficiency histo
-      const char *histName = Form("hppRun12_PtEtaEfficiency_data_aacuts");
-
-      // changed from double to float
-      TH2F *h = static_cast<TH2F*>(infile->Get(Form("%s", histName)));
-      if(!h) cout<<"don't have requested histogram! "<<Form("%s", histName)<<endl;
-      h->SetName(Form("%s", histName));
-
-      // get efficiency 
-      effBin = h->FindBin(x, y); // pt, eta
-      effBinContent = h->GetBinContent(effBin);
-      double effBinContentErr = h->GetBinError(effBin);
-      //cout<<"effBinContent: "<<effBinContent<<"   effBinErr: "<<effBinContentErr<<endl;
-
-      // delete histo and close input file
-      delete h;
-    }
-
-    // test statement
-    //cout<<"efficiency: "<<effBinContent<<"  pt: "<<x<<"  eta: "<<y<<"  lumi: "<<ZDCx<<endl;
-  } // Run12 AuAu
-
-  // track efficiency has pt, eta, and centrality dependence
-  // RunFlag switch
-  switch(fRunFlag) {
-    case StJetFrameworkPicoBase::Run12_pp200 :   // Run12 pp        
-        // pp function is flat (and reliable per Raghav) from 2.0 - 30.0 GeV
-        trkEff = effBinContent;
-        break;
-
-    case StJetFrameworkPicoBase::Run14_AuAu200 : // Run14 AuAu
-        trkEff = effBinContent;
-        break;
-
-    case StJetFrameworkPicoBase::Run14_AuAu200_MB : // Run14 AuAu - HFT dataset (MB triggers)
-        trkEff = effBinContent;
-        break;
-
-    case StJetFrameworkPicoBase::Run16_AuAu200 : // Run16 AuAu
-        // don't have parametrization for Run16
-        trkEff = 1.0;
-        break;
-
-  } // RunFlag switch
+  // check we want to apply it
+  if(!applyEff) return 1.0;
+  double trkEff = StJetFrameworkPicoBase::ApplyTrackingEff(applyEff, tpt, teta, cbin, ZDCx, effType, infile);
 
   // return the single track reconstruction efficiency for the corresponding dataset
   if(fSysUncType == kDoNothing) { trkEff = 1.00*trkEff; } 
@@ -4214,14 +4147,15 @@ void StMyAnalysisMaker3::RunJetQA()
 */
 
 /*
-    // this is for jet constituents
-    vector<fastjet::PseudoJet> fConstituents = jet->GetJetConstituents();
-    for(UInt_t ic = 0; ic < fConstituents.size(); ++ic) {
+    // this is for jet constituents - from the event constituent table
+    const StJetConstituentTable *table = jet->GetConstituentTable();
+    for(int ic = 0; table && ic < jet->GetConstituentSpanSize(); ++ic) {
       // get user defined index
-      Int_t uid = fConstituents[ic].user_index();
-      double cpt = fConstituents[ic].perp();
-      double ceta = fConstituents[ic].eta();
-      double cphi = fConstituents[ic].phi();
+      int entry = jet->ConstituentEntryAt(ic);
+      Int_t uid = table->GetUserIndex(entry);
+      double cpt = table->GetPt(entry);
+      double ceta = table->GetEta(entry);
+      double cphi = table->GetPhi(entry);
       cout<<"ic = "<<ic<<", uid = "<<uid<<", cpt = "<<cpt<<", ceta = "<<ceta<<", cphi = "<<cphi<<endl;
     }
 */
@@ -4374,3 +4308,15 @@ Int_t StMyAnalysisMaker3::GetZvtxBin(Double_t zvertex) const
 
   return zBin;
 }
+//
+// function to get pt assoc bin of a track: 0.20-0.5, 0.5-1.0, 1.0-1.5, 1.5-2.0, 2.0-20.0 GeV, -1 outside
+//__________________________________________________________________________________
+Int_t StMyAnalysisMaker3::GetAssocPtBin(Double_t pt)
+{
+  static const double assocPtEdges[kNAssocPtBins + 1] = {0.20, 0.50, 1.00, 1.50, 2.00, 20.0};
+  if(!(pt >= assocPtEdges[0] && pt < assocPtEdges[kNAssocPtBins])) return -1;
+
+  int bin = 0;
+  while(pt >= assocPtEdges[bin + 1]) bin++;
+  return bin;
+}
@@ -3,6 +3,7 @@
 
 #include "StJetFrameworkPicoBase.h"
 #include <set>
+#include <vector>
 
 class StJetFrameworkPicoBase;
 
@@ -31,6 +32,8 @@ class StRho;
 class StRhoParameter;
 class StEventPoolManager;
 class StEventPool;
+class StEventPoolTracks;
+class StSparseFillBuffer;
 class StCentMaker;
 
 class StMyAnalysisMaker3 : public StJetFrameworkPicoBase {
@@ -65,6 +68,9 @@ class StMyAnalysisMaker3 : public StJetFrameworkPicoBase {
       kTrkEffMax
     };
 
+    // number of pt assoc bins of the jet-hadron correlation: 0.20-0.5, 0.5-1.0, 1.0-1.5, 1.5-2.0, 2.0-20.0 GeV
+    enum { kNAssocPtBins = 5 };
+
     StMyAnalysisMaker3(const char *name, StPicoDstMaker *picoMaker, const char *outName, bool mDoComments, double minJetPtCut, const char *jetMakerName, const char *rhoMakerName);
     virtual ~StMyAnalysisMaker3();
    
@@ -204,7 +210,8 @@ class StMyAnalysisMaker3 : public StJetFrameworkPicoBase {
     Bool_t                  DidTowerConstituentFireTrigger(StJet *jet);
     Bool_t                  DidBadTowerFireTrigger();
     Bool_t                  DidBadTowerFireHTTrigger(); // TEST - August 2019
-    void                    JetHadronCorrelationAnalysis(StJet *jet, StEventPool *pool, Int_t centbin, Int_t assocPtBin);
+    void                    JetHadronCorrelationAnalysis(StJet *jet, StEventPool *pool, Int_t centbin); // all pt assoc bins in one pass
+    static Int_t            GetAssocPtBin(Double_t pt);
     void                    JetShapeAnalysis(StJet *jet, StEventPool *pool, Double_t refCorr2, Int_t assocPtBin);
     void                    GetJetV2(StJet *jet, Double_t EPangle, Int_t ptAssocBin);
     void                    FillTriggerIDs(TH1 *h);
@@ -292,12 +299,16 @@ class StMyAnalysisMaker3 : public StJetFrameworkPicoBase {
     Double_t                ZDC_raw_west;
 
     // event pool
-    TClonesArray           *CloneAndReduceTrackList();
+    StEventPoolTracks      *ReduceTrackList();
     StEventPoolManager     *fPoolMgr;//!  // event pool Manager object
+    StEventPoolTracks      *fMixTracks;//! // track columns added to event pool, reused every event
+    std::vector<Double_t>   fMixDEta;//!    // jet - mixed track deta of one pooled event, reused
+    std::vector<Double_t>   fMixDPhi;//!    // jet - mixed track dphi of one pooled event, reused
+    std::vector<Int_t>      fMixAssocBin;//! // pt assoc bin of mixed tracks of one pooled event, reused
     
     // track efficiency file and function
     TFile                  *fEfficiencyInputFile;
-    Double_t                ApplyTrackingEff(Bool_t applyEff, Double_t tpt, Double_t teta, Int_t cbin, Double_t ZDCx, Int_t effType, TFile *infile); // single-track reconstruction efficiency 
+    Double_t                ApplyTrackingEff(Bool_t applyEff, Double_t tpt, Double_t teta, Int_t cbin, Double_t ZDCx, Int_t effType, TFile *infile); // base class efficiency with systematic scale
   private:
     Int_t                   fRunNumber;
     TString                 fEPcalibFileName; 
@@ -476,6 +487,7 @@ class StMyAnalysisMaker3 : public StJetFrameworkPicoBase {
     THnSparse             *fhnJH;//!           // jet hadron events matrix
     THnSparse             *fhnMixedEvents;//!  // mixed events matrix
     THnSparse             *fhnCorr;//!         // sparse to get # jet triggers
+    StSparseFillBuffer    *fMixedEventsBuffer;//! // fill buffer for fhnMixedEvents (one group per pt assoc bin), flushed once per jet
 
     // maker names
     TString                fAnalysisMakerName;
@@ -484,13 +496,6 @@ class StMyAnalysisMaker3 : public StJetFrameworkPicoBase {
     // base class pointer
     StJetFrameworkPicoBase *mBaseMaker;
 
-    // bad and dead tower list functions and arrays
-    std::set<Int_t>        badTowers;
-    std::set<Int_t>        deadTowers;
-
-    // bad run list 
-    std::set<Int_t>        badRuns;
-
     // Event pool variables - TEST
     vector<vector<Double_t> >   fEventPoolOutputList; // vector representing a list of pools (given by value range) that will be saved
     Bool_t                      fUsePtBinnedEventPool; // uses event pool in pt bins
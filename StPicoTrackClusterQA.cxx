@@ -42,7 +42,12 @@
 #include "runlistRun14AuAu_P18ih.h" // new Run14 AuAu
 #include "runlistRun14AuAu_P16id_SL18f_xrootd_MB.h" // Run14 AuAu used by HF group for MB
 #include "StEmcPosition2.h"
+#include "StBemcTowerGeometry.h"
+#include "StTowerMatchMap.h"
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
+#include "StEventSelectionMaker.h"
+#include "StJetMakerTask.h"
 #include "StCentMaker.h"
 
 // tower includes
@@ -73,6 +78,8 @@ StPicoTrackClusterQA::StPicoTrackClusterQA() :
   fAnalysisMakerName(""),
   fTracksName(""),
   fCaloName(""),
+  fEventSelectionMakerName("EventSelectionMaker"),
+  fJetMakerName(""),
   fTrackPtMinCut(0.2),
   fTrackPtMaxCut(30.0),
   fTrackPhiMinCut(0.0),
@@ -108,6 +115,8 @@ StPicoTrackClusterQA::StPicoTrackClusterQA() :
   mCentMaker(0x0),
   mBaseMaker(0x0),
   mEmcPosition(0x0),
+  mTowerGeom(0x0),
+  mTowerMatchMap(0x0),
   grefmultCorr(0x0),
   fhnTrackQA(0x0),
   fhnTowerQA(0x0)
@@ -143,6 +152,8 @@ StPicoTrackClusterQA::StPicoTrackClusterQA(const char *name, bool doHistos = kFA
   fAnalysisMakerName(name),
   fTracksName("Tracks"),
   fCaloName("Clusters"),
+  fEventSelectionMakerName("EventSelectionMaker"),
+  fJetMakerName(""),
   fTrackPtMinCut(0.2),
   fTrackPtMaxCut(30.0), 
   fTrackPhiMinCut(0.0),
@@ -178,6 +189,8 @@ StPicoTrackClusterQA::StPicoTrackClusterQA(const char *name, bool doHistos = kFA
   mCentMaker(0x0),
   mBaseMaker(0x0),
   mEmcPosition(0x0),
+  mTowerGeom(0x0),
+  mTowerMatchMap(0x0),
   grefmultCorr(0x0),
   fhnTrackQA(0x0),
   fhnTowerQA(0x0)
@@ -312,6 +325,7 @@ StPicoTrackClusterQA::~StPicoTrackClusterQA()
   if(fhnTrackQA)           delete fhnTrackQA;
   if(fhnTowerQA)           delete fhnTowerQA;
   if(mEmcPosition)         delete mEmcPosition;
+  if(mTowerMatchMap)       delete mTowerMatchMap;
 }
 //
 //_____________________________________________________________________________
@@ -322,6 +336,9 @@ Int_t StPicoTrackClusterQA::Init() {
   // position object for Emc
   mEmcPosition = new StEmcPosition2();
 
+  // track-tower match map - filled per event if the jet maker's map is not available
+  mTowerMatchMap = new StTowerMatchMap();
+
   return kStOK;
 }
 //
@@ -694,15 +711,14 @@ int StPicoTrackClusterQA::Make()
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-  deadTowers = mBaseMaker->GetDeadTowers();
-  badTowers = mBaseMaker->GetBadTowers();
+  // tower positions - geometry is owned by the base maker and shared, vertex-corrected arrays are filled per event
+  mTowerGeom = mBaseMaker->GetTowerGeometry();
 
   // get run number, check bad runs list if desired (kFALSE if bad)
   fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 30.0 GeV
@@ -721,6 +737,9 @@ int StPicoTrackClusterQA::Make()
   // Z-vertex cut - per the Aj analysis (-40, 40)
   if((zVtx < fEventZVtxMinCut) || (zVtx > fEventZVtxMaxCut)) return kStOk;
 
+  // tower eta, phi, 1/cosh(eta) and direction for this vertex - one pass over all towers
+  mTowerGeom->SetVertex(mVertex);
+
   // ============================ CENTRALITY ============================== //
   // get CentMaker pointer
   mCentMaker = static_cast<StCentMaker*>(GetMaker("CentMaker"));
@@ -795,19 +814,20 @@ int StPicoTrackClusterQA::Make()
 */
 
   // switches for QA analysis
-  bool fHaveMBevent = mBaseMaker->CheckForMB(fRunFlag, fMBEventType);                           // generic MB, set in readMacro
-  bool fHaveMB5event = mBaseMaker->CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB5);       // MB5
-  bool fHaveMB30event = mBaseMaker->CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);     // MB30
-  bool fHaveEmcTrigger = mBaseMaker->CheckForHT(fRunFlag, fEmcTriggerEventType);                // HT trigger, set in readMacro
+  UInt_t fTrigMask = mBaseMaker->GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMBevent = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, fMBEventType);                           // generic MB, set in readMacro
+  bool fHaveMB5event = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB5);       // MB5
+  bool fHaveMB30event = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);     // MB30
+  bool fHaveEmcTrigger = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, fEmcTriggerEventType);                // HT trigger, set in readMacro
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if(doppAnalysis)  fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;                    // pp analysis
   if(!doppAnalysis) fRunForMB = (fHaveMB5event || fHaveMB30event) ? kTRUE : kFALSE; // NON-pp analysis
 
   // check for HT event - only used for below historgrams
-  int RunId_Order = mBaseMaker->GetRunNo(fRunFlag, fRunNumber);
-  bool fHaveHT1   = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT1);  // HT1
-  bool fHaveHT2   = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT2);  // HT2
-  bool fHaveHT3   = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT3);  // HT3
+  int RunId_Order = runContext->GetRunNo();
+  bool fHaveHT1   = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT1);  // HT1
+  bool fHaveHT2   = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT2);  // HT2
+  bool fHaveHT3   = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT3);  // HT3
   bool fHaveAnyHT = (fHaveHT1 || fHaveHT2 || fHaveHT3) ? kTRUE : kFALSE;   // any HT (1,2,3)
 
   // for comparison to Hanseul
@@ -928,18 +948,19 @@ void StPicoTrackClusterQA::RunTrackQA()
   double pi = 1.0*TMath::Pi();
   double pi0mass = Pico::mMass[0]; // GeV
   int fRunId = mPicoEvent->runId();
-  int RunId_Order = mBaseMaker->GetRunNo(fRunFlag, fRunId);
+  int RunId_Order = mBaseMaker->GetRunContext(fRunId, fRunFlag)->GetRunNo();
 
   // check for MB/HT event
-  bool fHaveMB30 = mBaseMaker->CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-  bool fHaveHT1  = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT1);
-  bool fHaveHT2  = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT2);
-  bool fHaveHT3  = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT3);
+  UInt_t fTrigMask = mBaseMaker->GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMB30 = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  bool fHaveHT1  = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT1);
+  bool fHaveHT2  = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT2);
+  bool fHaveHT3  = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT3);
   bool fHaveAnyHT= kFALSE;
   if(fHaveHT1 || fHaveHT2 || fHaveHT3) fHaveAnyHT = kTRUE;
 
   // switches for QA analysis
-  bool fHaveMBevent = mBaseMaker->CheckForMB(fRunFlag, fMBEventType);
+  bool fHaveMBevent = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, fMBEventType);
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if(doppAnalysis)  fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;
   if(!doppAnalysis) fRunForMB = (fHaveMB30) ? kTRUE : kFALSE;
@@ -986,6 +1007,7 @@ void StPicoTrackClusterQA::RunTrackQA()
     fHistNTrackvsPhi->Fill(phi);
     fHistNTrackvsEta->Fill(eta);
     fHistNTrackvsPhivsEta->Fill(phi, eta);
+    fHistTrackToTowerIndex->Fill(trk->bemcTowerIndex()); // towerIndex = towerID - 1
     fProfEventTrackPt->Fill(RunId_Order + 1., pt);
 
     // MB30 histograms filled for QA - pp or AuAu
@@ -1033,7 +1055,7 @@ void StPicoTrackClusterQA::RunBEmcPidTraitsQA() {
     if(towID < 0) continue;
 
     // cluster and tower position - from vertex and ID
-    towPosition = mEmcPosition->getPosFromVertex(mVertex, towID);
+    towPosition = mTowerGeom->GetPosFromVertex(towID);
 
     // index of associated track in the event
     int trackIndex = cluster->trackIndex();
@@ -1245,11 +1267,8 @@ Bool_t StPicoTrackClusterQA::AcceptTower(StPicoBTowHit *tower, Int_t towerID) {
   if(towerID < 0) return kFALSE;
 
   // cluster and tower position - from vertex and ID: shouldn't need additional eta correction
-  TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-  double phi = towerPosition.Phi();
-  if(phi < 0.0)    phi += 2.0*pi; // force to be 0-2pi
-  if(phi > 2.0*pi) phi -= 2.0*pi; // force to be 0-2pi
-  double eta = towerPosition.PseudoRapidity();
+  double phi = mTowerGeom->GetPhi(towerID);  // (0, 2pi)
+  double eta = mTowerGeom->GetEta(towerID);
   //int towerADC = tower->adc();
   //double towerEunCorr = tower->energy();  // uncorrected energy
 
@@ -1654,11 +1673,6 @@ void StPicoTrackClusterQA::RunHadCorrTowerQA()
   double pi = 1.0*TMath::Pi();
   double pi0mass = Pico::mMass[0]; // GeV
 
-  // towerStatus array
-  double mTowerMatchTrkIndex[4800][7] = { -1 };
-  int mTowerStatusArr[4800] = { 0 };
-  int matchedTowerTrackCounter = 0;
-
   // print
   //int nTrigs = mPicoDst->numberOfEmcTriggers();
   //int nBTowHits = mPicoDst->numberOfBTOWHits();
@@ -1666,36 +1680,48 @@ void StPicoTrackClusterQA::RunHadCorrTowerQA()
   //cout<<"nTracks = "<<nTracks<<"  nTrigs = "<<nTrigs<<"  nBTowHits = "<<nBTowHits<<"  nBEmcPidTraits = "<<nBEmcPidTraits<<endl;
   //matchedTowerTrackCounter++;
 
-  unsigned int ntracks = mPicoDst->numberOfTracks();
-  for(unsigned short iTracks = 0; iTracks < ntracks; iTracks++){
-    // get track pointer
-    StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(iTracks));
-    if(!trk){ continue; }
-
-    // acceptance and kinematic quality cuts
-    if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
-
-    // get momentum vector of track - global or primary track
-    TVector3 mTrkMom;
-    if(doUsePrimTracks) {   // get primary track vector
-      mTrkMom = trk->pMom();
-    } else {                // get global track vector
-      mTrkMom = trk->gMom(mVertex, Bfield);
-    }
-
-    // track variables + fill QA histograms
-    int matchedTowerIndex = trk->bemcTowerIndex(); // towerIndex = towerID - 1 
-    fHistTrackToTowerIndex->Fill(matchedTowerIndex);
-
-    //====  matched track index ===
-    int trackIndex = iTracks;
-    if(trackIndex < 0) { continue; } // can't happen
-    //cout<<"matchedTowerIndex: "<<matchedTowerIndex<<"  mTowerStatusArr[]: "<<mTowerStatusArr[matchedTowerIndex]<<"  trackIndex: "<<trackIndex<<endl;
-    if(matchedTowerIndex < 0) continue; // no matches
-
-    mTowerMatchTrkIndex[ matchedTowerIndex ][ mTowerStatusArr[ matchedTowerIndex ]] = trackIndex;
-    mTowerStatusArr[ matchedTowerIndex ] = mTowerStatusArr[ matchedTowerIndex ] + 1;  // 1+ means match, 0 for no match
-  } // track loop
+  // track-tower matches: use the jet maker's map if it was built for this event with the same track cuts, else build it here
+  const StTowerMatchMap *matchMap = GetJetMakerTowerMatchMap();
+  if(!matchMap) {
+    // reset towers matched in previous event
+    mTowerMatchMap->Clear();
+
+    unsigned int ntracks = mPicoDst->numberOfTracks();
+    for(unsigned short iTracks = 0; iTracks < ntracks; iTracks++){
+      // get track pointer
+      StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(iTracks));
+      if(!trk){ continue; }
+
+      // acceptance and kinematic quality cuts
+      if(!AcceptTrack(trk, Bfield, mVertex)) { continue; }
+
+      // get momentum vector of track - global or primary track
+      TVector3 mTrkMom;
+      if(doUsePrimTracks) {   // get primary track vector
+        mTrkMom = trk->pMom();
+      } else {                // get global track vector
+        mTrkMom = trk->gMom(mVertex, Bfield);
+      }
+
+      // matched tower: towerIndex = towerID - 1
+      int matchedTowerIndex = trk->bemcTowerIndex();
+
+      //====  matched track index ===
+      int trackIndex = iTracks;
+      if(trackIndex < 0) { continue; } // can't happen
+      if(matchedTowerIndex < 0) continue; // no matches
+
+      // track E for hadronic correction - sum and max accumulated per tower
+      double p = mTrkMom.Mag();
+      double E = 1.0*TMath::Sqrt(p*p + pi0mass*pi0mass);
+      mTowerMatchMap->AddMatch(matchedTowerIndex, trackIndex, E);
+    } // track loop
+
+    // CSR offsets for matched tracks of each tower
+    mTowerMatchMap->Build();
+    mTowerMatchMap->SetEvent(mPicoEvent->runId(), mPicoEvent->eventId());
+    matchMap = mTowerMatchMap;
+  }
 
   // print statment on matches
   //cout<<"Matched Tracks passing cuts (with tower): "<<matchedTowerTrackCounter<<"  nBTowHits = ";
@@ -1720,15 +1746,13 @@ void StPicoTrackClusterQA::RunHadCorrTowerQA()
     if(!AcceptTower(tower, towerID)) { continue; }
 
     // cluster and tower position - from vertex and ID: shouldn't need additional eta correction
-    TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-    double towerPhi = towerPosition.Phi();
-    if(towerPhi < 0.0)    towerPhi += 2.0*pi;  // force to be 0-2pi
-    if(towerPhi > 2.0*pi) towerPhi -= 2.0*pi;  // force to be 0-2pi
-    double towerEta = towerPosition.PseudoRapidity();
+    double towerPhi = mTowerGeom->GetPhi(towerID);          // (0, 2pi)
+    double towerEta = mTowerGeom->GetEta(towerID);
+    double towerInvCosh = mTowerGeom->GetInvCosh(towerID);  // 1/cosh(eta)
     //int towerADC = tower->adc();
     double towerEunCorr = tower->energy();  // uncorrected energy
     double towerE = tower->energy();        // corrected energy (hadronically - done below)
-    double towEtunCorr = towerEunCorr / (1.0*TMath::CosH(towerEta));
+    double towEtunCorr = towerEunCorr * towerInvCosh;
 
     // cut on min tower energy after filling histos - FIXME fix this cut
     if(towerEunCorr < mTowerEnergyMin) continue; // if we don't have enough E to start with, why mess around
@@ -1745,61 +1769,38 @@ void StPicoTrackClusterQA::RunHadCorrTowerQA()
     // if tower was is matched to a track or multiple, add up the matched track energies 
     //     (mult opt.) to then subtract from the corresponding tower
     // August 15, 2020: if *have* 1+ matched trk-tow AND uncorrected energy of tower is at least your tower constituent cut, then CONTINUE 
-    if(mTowerStatusArr[towerIndex] > 0.5 && towerEunCorr > mTowerEnergyMin) {
-      double maxE = 0.0;
-      double sumE = 0.0;
-
-      // --- finds max E track matched to tower *AND* the sum of all matched track E and subtract from said tower
+    int nMatchedTracks = matchMap->GetNMatched(towerIndex);
+    if(nMatchedTracks > 0 && towerEunCorr > mTowerEnergyMin) {
+      // --- max E track matched to tower *AND* the sum of all matched track E, to subtract from said tower
       //     USER provides readMacro.C which method to use for their analysis via SetJetHadCorrType(type);
-      // loop over ALL matched tracks
-      for(int itrk = 0; itrk < mTowerStatusArr[towerIndex]; itrk++) {
-        StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track( mTowerMatchTrkIndex[towerIndex][itrk] ));
-        if(!trk) { cout<<"No track pointer..."<<endl; continue; }
-        if(!AcceptTrack(trk, Bfield, mVertex)) { cout<<"track matched back doesn't pass cuts"<<endl; continue; }
-
-        // get track variables to matched tower from 3-vector
-        TVector3 mTrkMom;
-        if(doUsePrimTracks) { // get primary track vector
-          mTrkMom = trk->pMom();
-        } else {              // get global track vector
-          mTrkMom = trk->gMom(mVertex, Bfield);
-        }
-
-        // track variables
-        double p = mTrkMom.Mag();
-        double E = 1.0*TMath::Sqrt(p*p + pi0mass*pi0mass);
-        if(E > maxE) maxE = E;
-        sumE = sumE + E;
-
-        // test statement
-        //cout<<itrk<<"  itrkE: "<<E<<"  sumtrkE: "<<sumE<<endl;
-      } // track loop
+      double maxE = matchMap->GetMaxE(towerIndex);
+      double sumE = matchMap->GetSumE(towerIndex);
 
       // apply hadronic correction to tower
-      maxEt  = (towerEunCorr - (mHadronicCorrFrac * maxE))/(1.0*TMath::CosH(towerEta));
-      sumEt  = (towerEunCorr - (mHadronicCorrFrac * sumE))/(1.0*TMath::CosH(towerEta));
+      maxEt  = (towerEunCorr - (mHadronicCorrFrac * maxE)) * towerInvCosh;
+      sumEt  = (towerEunCorr - (mHadronicCorrFrac * sumE)) * towerInvCosh;
     } // have a track-tower match
     // else - no match so treat towers on their own
 
     // Et - hadronic correction comparison
-    double fMaxEt = (maxEt == 0) ? towerEunCorr / (1.0*TMath::CosH(towerEta)) : maxEt;
-    double fSumEt = (sumEt == 0) ? towerEunCorr / (1.0*TMath::CosH(towerEta)) : sumEt;
-    //if(mTowerStatusArr[towerIndex] > 0.5) cout<<"towerEunCorr = "<<towerEunCorr<<"  CosH: "<<1.0*TMath::CosH(towerEta)<<"   fMaxEt: "<<fMaxEt<<"   fSumEt: "<<fSumEt<<endl;
+    double fMaxEt = (maxEt == 0) ? towEtunCorr : maxEt;
+    double fSumEt = (sumEt == 0) ? towEtunCorr : sumEt;
+    //if(nMatchedTracks > 0) cout<<"towerEunCorr = "<<towerEunCorr<<"  CosH: "<<1.0*TMath::CosH(towerEta)<<"   fMaxEt: "<<fMaxEt<<"   fSumEt: "<<fSumEt<<endl;
 
     // cut on transverse tower energy (more uniform)
     double towerEt = 0.0;
-    if(mTowerStatusArr[towerIndex] < 1) { // no matches, use towers uncorrected energy
-      towerEt = towerEunCorr / (1.0*TMath::CosH(towerEta));
+    if(nMatchedTracks < 1) { // no matches, use towers uncorrected energy
+      towerEt = towEtunCorr;
     } else {
-        if(fJetHadCorrType == StJetFrameworkPicoBase::kHighestEMatchedTrack) {  towerEt = fMaxEt;  towerE = fMaxEt  * 1.0*TMath::CosH(towerEta); }
-        if(fJetHadCorrType == StJetFrameworkPicoBase::kAllMatchedTracks)     {  towerEt = fSumEt;  towerE = fSumEt  * 1.0*TMath::CosH(towerEta); }
+        if(fJetHadCorrType == StJetFrameworkPicoBase::kHighestEMatchedTrack) {  towerEt = fMaxEt;  towerE = fMaxEt / towerInvCosh; }
+        if(fJetHadCorrType == StJetFrameworkPicoBase::kAllMatchedTracks)     {  towerEt = fSumEt;  towerE = fSumEt / towerInvCosh; }
     }
     if(towerEt == 0) { cout<<"fJetHadCorrType - or - towerE actually 0"<<endl; }  // it was unset, because you provided wrong fJetHadCorrType
     if(towerEt < 0) towerEt = 0.0;
     if(towerEt < mTowerEnergyMin) continue;
 
     // print
-    //cout<<"itow: "<<itow<<"  towerID = "<<towerID<<"  towerPhi = "<<towerPhi<<"  towerEta = "<<towerEta<<"  towerADC = "<<towerADC<<"  towerE = "<<towerE<<"  towerEunCorr = "<<towerEunCorr<<"  mIndex = "<<mTowerMatchTrkIndex[towerIndex]<<endl;
+    //cout<<"itow: "<<itow<<"  towerID = "<<towerID<<"  towerPhi = "<<towerPhi<<"  towerEta = "<<towerEta<<"  towerADC = "<<towerADC<<"  towerE = "<<towerE<<"  towerEunCorr = "<<towerEunCorr<<"  nMatched = "<<nMatchedTracks<<endl;
 
     // fill QA histos for towers
     fHistNHadCorrTowervsE->Fill(towerE);
@@ -1836,14 +1837,11 @@ void StPicoTrackClusterQA::RunTowerQA()
     //if(!AcceptTower(tower, towerID)) { continue; }  // TURN this off for RAW QA of towers
 
     // cluster and tower position - from vertex and ID: shouldn't need additional eta correction
-    TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-    double towerPhi = towerPosition.Phi();
-    if(towerPhi < 0.0)    towerPhi += 2.0*pi;  // force to be 0-2pi
-    if(towerPhi > 2.0*pi) towerPhi -= 2.0*pi;  // force to be 0-2pi
-    double towerEta = towerPosition.PseudoRapidity();
+    double towerPhi = mTowerGeom->GetPhi(towerID);  // (0, 2pi)
+    double towerEta = mTowerGeom->GetEta(towerID);
     int towerADC = tower->adc();
     double towerE = tower->energy();
-    double towerEt = towerE / (1.0*TMath::CosH(towerEta));
+    double towerEt = towerE * mTowerGeom->GetInvCosh(towerID);
 
     // fill for fired triggers - NEW July1, 2019 - looking for triggers meeting thresholds
     // want this filled before any energy corrections
@@ -1965,11 +1963,11 @@ void StPicoTrackClusterQA::RunFiredTriggerQA()
     if(towerID < 0) { cout<<"tower ID < 0, tower ID = "<<towerID<<endl; continue; } // double check these aren't still in the event list
 
     // cluster and tower position - from vertex and ID: shouldn't need additional eta correction
-    TVector3 towerPosition = mEmcPosition->getPosFromVertex(mVertex, towerID);
-    //double towerPhi = towerPosition.Phi();
-    double towerEta = towerPosition.PseudoRapidity();
+    // (invalid tower IDs have no position: eta = 0)
+    bool validID = (towerID >= 1 && towerID <= StBemcTowerGeometry::kNTowers);
+    double towerEta = validID ? mTowerGeom->GetEta(towerID) : 0.;
     double towerE = tower->energy();
-    double towerEt = towerE / (1.0*TMath::CosH(towerEta));
+    double towerEt = validID ? towerE * mTowerGeom->GetInvCosh(towerID) : towerE;
     // if(towerEt < 0) cout<<"emcTrigID = "<<emcTrigID<<"  towerID = "<<towerID<<"  towerEta = "<<towerEta<<"  towerE = "<<towerE<<"  towerEt = "<<towerEt<<"  ADC = "<<tower->adc()<<endl;
 
     // fill some histograms for QA when have a zero energy entry
@@ -2018,9 +2016,44 @@ void StPicoTrackClusterQA::RunFiredTriggerQA()
   } // trigger loop
 }
 //
+// Get the shared event selection (StEventSelectionMaker)
+// returns 0x0 if it is not in the chain, did not run for the current event,
+// or used a different track type (primary/global) than this maker uses
+//______________________________________________________________________________________________
+StEventSelectionMaker *StPicoTrackClusterQA::GetEventSelection() {
+  StEventSelectionMaker *sel = static_cast<StEventSelectionMaker*>(GetMaker(fEventSelectionMakerName));
+  if(!sel || !mPicoEvent) return 0x0;
+  if(!sel->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) return 0x0;
+  if(sel->GetUsePrimaryTracks() != doUsePrimTracks) return 0x0;
+
+  return sel;
+}
+//
+// Get the track-tower match map of the jet maker (StJetMakerTask)
+// returns 0x0 if no jet maker is set or in the chain, its map was not built for the current event,
+// or it used different track cuts (track type, pt range and quality cuts) than this maker uses
+//______________________________________________________________________________________________
+const StTowerMatchMap *StPicoTrackClusterQA::GetJetMakerTowerMatchMap() {
+  if(fJetMakerName.IsNull() || !mPicoEvent) return 0x0;
+  StJetMakerTask *jetMaker = static_cast<StJetMakerTask*>(GetMaker(fJetMakerName));
+  if(!jetMaker) return 0x0;
+  if(!jetMaker->HasTowerMatchMapCuts(doUsePrimTracks, fTrackPtMinCut, fTrackPtMaxCut, fTrackEtaMinCut, fTrackEtaMaxCut,
+                                     fTrackPhiMinCut, fTrackPhiMaxCut, fTrackDCAcut, fTracknHitsFit, fTracknHitsRatio)) return 0x0;
+
+  const StTowerMatchMap *matchMap = jetMaker->GetTowerMatchMap();
+  if(!matchMap || !matchMap->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) return 0x0;
+
+  return matchMap;
+}
+//
 // Returns pt of hardest track in the event
 //______________________________________________________________________________________________
 Double_t StPicoTrackClusterQA::GetMaxTrackPt() {
+  // use shared event selection if it already ran for this event with the same track cuts
+  StEventSelectionMaker *sel = GetEventSelection();
+  if(sel && sel->HasMaxTrackPtCuts(doUsePrimTracks, fTrackPtMinCut, fTrackPtMaxCut, fTrackEtaMinCut, fTrackEtaMaxCut,
+                                   fTrackPhiMinCut, fTrackPhiMaxCut, fTrackDCAcut, fTracknHitsFit, fTracknHitsRatio)) return sel->GetCachedMaxTrackPt();
+
   // get # of tracks
   int nTrack = mPicoDst->numberOfTracks();
   double fMaxTrackPt = -99.;
@@ -2136,7 +2169,7 @@ void StPicoTrackClusterQA::RunEventQA() {
   // get run ID, transform to run order for filling histogram of corrections
   int fEventId = mPicoEvent->eventId();
   int fRunId = mPicoEvent->runId();
-  int RunId_Order = mBaseMaker->GetRunNo(fRunFlag, fRunId);// + 1;
+  int RunId_Order = mBaseMaker->GetRunContext(fRunId, fRunFlag)->GetRunNo();// + 1;
   //if(RunId_Order < -1) return kStOK;
 
   // centrality, refmult
@@ -2158,14 +2191,15 @@ void StPicoTrackClusterQA::RunEventQA() {
 
   // =======================================================================================
   // check for MB/HT event
-  bool fHaveMB30 = mBaseMaker->CheckForMB(fRunFlag, StJetFrameworkPicoBase::kVPDMB30);
-  bool fHaveHT1  = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT1);
-  bool fHaveHT2  = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT2);
-  bool fHaveHT3  = mBaseMaker->CheckForHT(fRunFlag, StJetFrameworkPicoBase::kIsHT3);
+  UInt_t fTrigMask = mBaseMaker->GetTriggerMask(fRunFlag);  // trigger bits of this event
+  bool fHaveMB30 = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, StJetFrameworkPicoBase::kVPDMB30);
+  bool fHaveHT1  = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT1);
+  bool fHaveHT2  = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT2);
+  bool fHaveHT3  = StJetFrameworkPicoBase::HasHTTrigger(fTrigMask, StJetFrameworkPicoBase::kIsHT3);
   bool fHaveAnyHT= kFALSE;
   if(fHaveHT1 || fHaveHT2 || fHaveHT3) fHaveAnyHT = kTRUE; 
 
-  bool fHaveMBevent = mBaseMaker->CheckForMB(fRunFlag, fMBEventType);
+  bool fHaveMBevent = StJetFrameworkPicoBase::HasMBTrigger(fTrigMask, fMBEventType);
   bool fRunForMB = kFALSE;  // used to differentiate pp and AuAu
   if(doppAnalysis)  fRunForMB = (fHaveMBevent) ? kTRUE : kFALSE;
   if(!doppAnalysis) fRunForMB = (fHaveMB30) ? kTRUE : kFALSE;
@@ -40,7 +40,10 @@ class StEmcGeom;
 // star jet-frameworks classes
 class StJetFrameworkPicoBase;
 class StEmcPosition2;
+class StBemcTowerGeometry;
+class StTowerMatchMap;
 class StCentMaker;
+class StEventSelectionMaker;
 
 // centrality class
 class StRefMultCorr;
@@ -134,6 +137,8 @@ class StPicoTrackClusterQA : public StMaker {
   // common setters
   void                 SetClusName(const char *n)       { fCaloName      = n;  }
   void                 SetTracksName(const char *n)     { fTracksName    = n;  }
+  void                 SetEventSelectionMakerName(const char *n) { fEventSelectionMakerName = n; }
+  void                 SetJetMakerName(const char *n)   { fJetMakerName  = n;  } // jet maker sharing its track-tower match map
 
   /* set the minimum tower energy to be reconstructed (default = 0.15) */
   void                 SetTowerEnergyMin(double mMin)     { mTowerEnergyMin = mMin; }
@@ -156,6 +161,8 @@ class StPicoTrackClusterQA : public StMaker {
   TH1                 *FillEmcTriggersHist(TH1 *h);                              // EmcTrigger counter histo
   TH1                 *FillEventTriggerQA(TH1 *h);                               // fill event trigger QA plots
   Bool_t               DoComparison(int myarr[], int elems);
+  StEventSelectionMaker *GetEventSelection();         // shared event selection, 0x0 if not valid for this event
+  const StTowerMatchMap *GetJetMakerTowerMatchMap();  // jet maker track-tower matches, 0x0 if not valid for this event
   Double_t             GetMaxTrackPt();               // find max track pt in event
   Double_t             GetMaxTowerEt();               // find max tower Et in event
   void                 FillTriggerIDs(TH1 *h);
@@ -184,6 +191,8 @@ class StPicoTrackClusterQA : public StMaker {
   TString              fAnalysisMakerName;      // name of this analysis maker
   TString              fTracksName;             // name of track collection
   TString              fCaloName;               // name of calo cluster collection
+  TString              fEventSelectionMakerName; // name of shared event selection maker
+  TString              fJetMakerName;           // name of jet maker providing the track-tower match map
 
   Double_t             fTrackPtMinCut;          // min track pt cut
   Double_t             fTrackPtMaxCut;          // max track pt cut
@@ -243,6 +252,8 @@ class StPicoTrackClusterQA : public StMaker {
 
   // position object
   StEmcPosition2      *mEmcPosition;
+  StBemcTowerGeometry *mTowerGeom;    // precomputed tower eta/phi/cosh for current vertex - owned by the base maker
+  StTowerMatchMap     *mTowerMatchMap; // track-tower matches for hadronic correction
 
   // centrality objects
   StRefMultCorr       *grefmultCorr;
@@ -366,13 +377,6 @@ class StPicoTrackClusterQA : public StMaker {
   THnSparse      *fhnTrackQA;//!      // sparse of track info
   THnSparse      *fhnTowerQA;//!      // sparse of tower info
 
-  // bad and dead tower list
-  std::set<Int_t>        badTowers;
-  std::set<Int_t>        deadTowers;
-
-  // bad run list 
-  std::set<Int_t>        badRuns;
-
   StPicoTrackClusterQA(const StPicoTrackClusterQA&);            // not implemented
   StPicoTrackClusterQA &operator=(const StPicoTrackClusterQA&); // not implemented
 
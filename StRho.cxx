@@ -1,5 +1,6 @@
 // $Id$
-// Calculation of rho from a collection of jets.
+// Calculation of rho from a collection of jets,
+// or (kGridMedian) from the jet maker input vectors summed in eta-phi grid cells.
 // If scale function is given the scaled rho will be exported
 // with the name as "fOutRhoName".Apppend("_Scaled").
 //
@@ -9,6 +10,7 @@
 // ROOT includes
 #include <TClonesArray.h>
 #include <TMath.h>
+#include <algorithm>
 #include "TH2.h"
 #include "TH2F.h"
 #include "TVector3.h"
@@ -18,6 +20,8 @@
 #include "StRhoParameter.h"
 #include "StJetMakerTask.h"
 #include "StCentMaker.h"
+#include "StRunContext.h"
+#include "StJetInput.h"
 
 // STAR includes
 #include "StRoot/StPicoEvent/StPicoDst.h"
@@ -36,6 +40,13 @@ StRho::StRho() : StRhoBase("")
   fNExclLeadJets = 0;
   fJets = 0x0;
   fHistMultvsRho = 0x0;
+  fRhoMethod = kJetMedian;
+  fGridCellSize = 0.5;
+  fGridEtaMin = -1.0;
+  fGridEtaMax = 1.0;
+  fGridNEta = 0;
+  fGridNPhi = 0;
+  fGridCellArea = 0.;
   mOutName = ""; 
   fJetMakerName = "";
   fRhoMakerName = "";
@@ -48,6 +59,13 @@ StRho::StRho(const char *name, Bool_t histo, const char *outName, const char *je
   fNExclLeadJets = 0;
   fJets = 0x0;
   fHistMultvsRho = 0x0;
+  fRhoMethod = kJetMedian;
+  fGridCellSize = 0.5;
+  fGridEtaMin = -1.0;
+  fGridEtaMax = 1.0;
+  fGridNEta = 0;
+  fGridNPhi = 0;
+  fGridCellArea = 0.;
   mBaseMaker = 0x0;
   mOutName = outName;
   fJetMakerName = jetMakerName;
@@ -80,6 +98,12 @@ Int_t StRho::Init()
   fJets = new TClonesArray("StJet");
   //fJets->SetName(fJetsName);      
 
+  // grid for kGridMedian: cells of fGridCellSize, phi cells rounded to fill 2pi
+  fGridNEta = TMath::Max(1, TMath::Nint((fGridEtaMax - fGridEtaMin) / fGridCellSize));
+  fGridNPhi = TMath::Max(1, TMath::Nint(TMath::TwoPi() / fGridCellSize));
+  fGridCellArea = (fGridEtaMax - fGridEtaMin) / fGridNEta * TMath::TwoPi() / fGridNPhi;
+  fGridCellPt.reserve(fGridNEta * fGridNPhi);
+
   return kStOk;
 }
 
@@ -158,13 +182,11 @@ Int_t StRho::Make()
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   int fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 30.0 GeV
@@ -190,7 +212,7 @@ Int_t StRho::Make()
 
   // if we have JetMaker, get jet collection associated with it
   if(JetMaker) {
-    fJets =  JetMaker->GetJets();
+    fJets =  GetJetArray(JetMaker);
     //fJets->SetName("BGJetsRho");  // name is set by Maker who created it
   }
   if(!fJets) return kStWarn;
@@ -229,6 +251,19 @@ Int_t StRho::Make()
   fOutRho->SetVal(0);
   if(fOutRhoScaled) fOutRhoScaled->SetVal(0);
 
+  // grid median: input vectors the jet maker prepared for this event, no jets needed
+  if(fRhoMethod == kGridMedian) {
+    const StJetInput *input = JetMaker->GetJetInput();
+    if(!input || !input->IsCurrent(mPicoEvent->runId(), mPicoEvent->eventId())) {
+      LOG_WARN << Form(" No input vectors of %s for this event! Skip! ", fJetMakerNameCh) << endm;
+      return kStWarn;
+    }
+
+    SetRhoVal(GetGridMedianRho(input), multiplicity);
+    StRhoBase::FillHistograms();
+    return kStOk;
+  }
+
   // get number of jets, initialize arrays
   const Int_t Njets   = fJets->GetEntries();
   Int_t maxJetIds[]   = {-1, -1};
@@ -296,20 +331,57 @@ Int_t StRho::Make()
   if(NjetAcc > 0) {
     // find median value
     Double_t rho = TMath::Median(NjetAcc, rhovec);
-    fOutRho->SetVal(rho);
-
-    // fill histo
-    fHistMultvsRho->Fill(multiplicity, rho);
-
-    // if we want scaled Rho from charged -> ch+ne
-    if(fOutRhoScaled) {
-      //Double_t rhoScaled = rho * GetScaleFactor(fCent); //Don't need yet, fCent is in 5% bins
-      Double_t rhoScaled = rho * 1.0;
-      fOutRhoScaled->SetVal(rhoScaled);
-    }
+    SetRhoVal(rho, multiplicity);
   }
 
   StRhoBase::FillHistograms();
 
   return kStOk;
+}
+//
+// Function: set rho (and scaled rho), fill histogram
+//________________________________________________________________________
+void StRho::SetRhoVal(Double_t rho, Double_t multiplicity)
+{
+  fOutRho->SetVal(rho);
+
+  // fill histo
+  fHistMultvsRho->Fill(multiplicity, rho);
+
+  // if we want scaled Rho from charged -> ch+ne
+  if(fOutRhoScaled) {
+    //Double_t rhoScaled = rho * GetScaleFactor(fCent); //Don't need yet, fCent is in 5% bins
+    Double_t rhoScaled = rho * 1.0;
+    fOutRhoScaled->SetVal(rhoScaled);
+  }
+}
+//
+// Function: grid median rho - median of pt/area over all eta-phi cells (empty cells included)
+// the input vectors are the jet constituents after cuts and hadronic correction
+//________________________________________________________________________
+Double_t StRho::GetGridMedianRho(const StJetInput *input)
+{
+  // sum pt per cell - vector keeps its memory
+  const Int_t ncells = fGridNEta * fGridNPhi;
+  fGridCellPt.assign(ncells, 0.);
+
+  const std::vector<fastjet::PseudoJet> &vectors = input->GetVectors();
+  for(UInt_t i = 0; i < vectors.size(); i++) {
+    double eta = vectors[i].eta();
+    if(eta < fGridEtaMin || eta >= fGridEtaMax) continue;
+
+    // PseudoJet::phi() is in [0, 2pi)
+    int ieta = (int)((eta - fGridEtaMin) / (fGridEtaMax - fGridEtaMin) * fGridNEta);
+    int iphi = (int)(vectors[i].phi() / TMath::TwoPi() * fGridNPhi);
+    if(ieta >= fGridNEta) ieta = fGridNEta - 1;
+    if(iphi >= fGridNPhi) iphi = fGridNPhi - 1;
+    fGridCellPt[ieta * fGridNPhi + iphi] += vectors[i].perp();
+  }
+
+  // median, as TMath::Median: mean of the two middle values for an even number of cells
+  std::nth_element(fGridCellPt.begin(), fGridCellPt.begin() + ncells/2, fGridCellPt.end());
+  Double_t median = fGridCellPt[ncells/2];
+  if(ncells % 2 == 0) median = 0.5 * (median + *std::max_element(fGridCellPt.begin(), fGridCellPt.begin() + ncells/2));
+
+  return median / fGridCellArea;
 } 
@@ -8,6 +8,7 @@
 
 // additional includes
 #include "StMaker.h"
+#include <vector>
 
 // ROOT classes
 class TH2;
@@ -16,10 +17,17 @@ class TClonesArray;
 
 // STAR classes
 class StMaker;
+class StJetInput;
 
 class StRho : public StRhoBase {
 
  public:
+  // rho method
+  enum ERhoMethod_t {
+    kJetMedian,      // median of jet pt/area of the jet maker's jets (kt jets for background)
+    kGridMedian      // median of pt/area of eta-phi grid cells filled from the jet maker's input vectors, no clustering
+  };
+
   StRho();
   StRho(const char *name, Bool_t histo=kFALSE, const char *outName="", const char *jetMakerName="");
   //virtual ~StRho() {}
@@ -35,9 +43,23 @@ class StRho : public StRhoBase {
   void    WriteHistograms();
 
   void    SetExcludeLeadJets(UInt_t n)    { fNExclLeadJets = n    ; }
+  void    SetRhoMethod(Int_t m)           { fRhoMethod     = m    ; }
+  void    SetGridCellSize(Double_t s)     { fGridCellSize  = s    ; }   // eta and phi, phi rounded to fill 2pi
+  void    SetGridEtaRange(Double_t emi, Double_t ema) { fGridEtaMin = emi; fGridEtaMax = ema; }
 
  protected:
   UInt_t            fNExclLeadJets;                 // number of leading jets to be excluded from the median calculation
+  Int_t             fRhoMethod;                     // rho method, see ERhoMethod_t
+  Double_t          fGridCellSize;                  // grid cell size in eta and phi
+  Double_t          fGridEtaMin;                    // grid acceptance in eta
+  Double_t          fGridEtaMax;
+  Int_t             fGridNEta;                      //! number of grid cells in eta
+  Int_t             fGridNPhi;                      //! number of grid cells in phi
+  Double_t          fGridCellArea;                  //! eta-phi area of a grid cell
+  std::vector<Double_t> fGridCellPt;                //! pt sum per grid cell, kept allocated
+
+  Double_t          GetGridMedianRho(const StJetInput *input);
+  void              SetRhoVal(Double_t rho, Double_t multiplicity);
 
   TClonesArray     *fJets;//!jet collection
 
@@ -47,6 +69,6 @@ class StRho : public StRhoBase {
   StRho(const StRho&);             // not implemented
   StRho& operator=(const StRho&);  // not implemented
   
-  ClassDef(StRho, 2); // Rho task
+  ClassDef(StRho, 3); // Rho task
 };
 #endif
@@ -24,6 +24,7 @@
 #include "StJet.h"
 #include "StJetMakerTask.h"
 #include "StCentMaker.h"
+#include "StRunContext.h"
 
 // STAR includes
 #include "StMaker.h"
@@ -427,13 +428,11 @@ Int_t StRhoBase::Make()
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   int fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 30.0 GeV
@@ -458,7 +457,7 @@ Int_t StRhoBase::Make()
 
   // if we have JetMaker, get jet collection associated with it
   if(JetMaker) {
-    fJets =  static_cast<TClonesArray*>(JetMaker->GetJets());
+    fJets =  GetJetArray(JetMaker);
     //fJets->SetName("BGJetsRho"); // name will be that set by specific Maker task
   }
   if(!fJets) return kStWarn;
@@ -121,9 +121,6 @@ class StRhoBase : public StJetFrameworkPicoBase {
   // base class pointer
   StJetFrameworkPicoBase *mBaseMaker;
 
-  // bad run list set
-  std::set<Int_t>        badRuns;
-
 /*
   // maker names
   TString                mOutName;
@@ -23,6 +23,7 @@
 #include "StRhoParameter.h"
 #include "StJetMakerTask.h"
 #include "StJetFrameworkPicoBase.h"
+#include "StRunContext.h"
 #include "StCentMaker.h"
 
 ClassImp(StRhoSparse)
@@ -201,13 +202,11 @@ Int_t StRhoSparse::Make()
     return kStWarn;
   }
 
-  // get bad run, dead & bad tower lists
-  badRuns = mBaseMaker->GetBadRuns();
-
   // get run number, check bad runs list if desired (kFALSE if bad)
   int fRunNumber = mPicoEvent->runId();
+  const StRunContext *runContext = mBaseMaker->GetRunContext(fRunNumber, fRunFlag);
   if(doRejectBadRuns) {
-    if( !mBaseMaker->IsRunOK(fRunNumber) ) return kStOK;
+    if( !runContext->IsRunOK() ) return kStOK;
   }
 
   // cut event on max track pt > 30.0 GeV
@@ -236,7 +235,7 @@ Int_t StRhoSparse::Make()
   if(!JetMaker) { return kStWarn; }
 
   // if we have signal JetMaker, get jet collection associated with it
-  fJets = static_cast<TClonesArray*>(JetMaker->GetJets());
+  fJets = GetJetArray(JetMaker);
   if(!fJets) { return kStWarn; }
 
   // # of jets
@@ -0,0 +1,67 @@
+//******************************************************************************
+//
+// StRunContext.cxx
+//
+// Authors: Joel Mazer
+//
+// Per-run quantities shared by all makers
+//
+//******************************************************************************
+
+#include "StRunContext.h"
+#include "StJetPicoDefinitions.h"
+
+ClassImp(StRunContext)
+
+//_________________________________________________________________________________________
+StRunContext::StRunContext() : TObject()
+{
+  Reset();
+}
+
+//_________________________________________________________________________________________
+StRunContext::~StRunContext()
+{ /*  */
+  // destructor
+}
+//
+// Function: set quantities of new run
+//_________________________________________________________________________________________
+void StRunContext::Set(Int_t runId, Int_t runFlag, Int_t runNo, Int_t nRuns, Bool_t hasBadRunList, Bool_t runOK, UInt_t trigLists)
+{
+  fValid = kTRUE;
+  fRunId = runId;
+  fRunFlag = runFlag;
+  fRunNo = runNo;
+  fNRuns = nRuns;
+  fHasBadRunList = hasBadRunList;
+  fRunOK = runOK;
+  fTrigLists = trigLists;
+}
+//
+// Function: clear context - next call of GetRunContext() refills it
+//_________________________________________________________________________________________
+void StRunContext::Reset()
+{
+  fValid = kFALSE;
+  fRunId = -1;
+  fRunFlag = -1;
+  fRunNo = -999;
+  fNRuns = 0;
+  fHasBadRunList = kFALSE;
+  fRunOK = kTRUE;
+  fTrigLists = 0;
+}
+//
+// Function: bad run status - called by makers rejecting bad runs, same as StJetFrameworkPicoBase::IsRunOK()
+// it is an error to ask without a bad run list loaded
+//_________________________________________________________________________________________
+Bool_t StRunContext::IsRunOK() const
+{
+  if(!fHasBadRunList) {
+    __ERROR("StRunContext::IsRunOK: WARNING: You're trying to run without a bad run list. If you know what you're doing, deactivate this throw and recompile.");
+    throw ( -1 );
+  }
+
+  return fRunOK;
+}
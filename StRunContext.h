@@ -0,0 +1,51 @@
+//******************************************************************************
+//
+// StRunContext.h
+//
+// Authors: Joel Mazer
+//
+// Per-run quantities shared by all makers: run index in the dataset run list,
+// bad run status and trigger lists of the dataset. Filled by
+// StJetFrameworkPicoBase::GetRunContext() when the run ID changes, so the
+// run list scans are done once per run instead of once per event
+//
+//******************************************************************************
+
+#ifndef StRunContext_H
+#define StRunContext_H
+
+// ROOT includes
+#include "TObject.h"
+
+class StRunContext : public TObject
+{
+   public:
+             StRunContext();
+    virtual  ~StRunContext();
+
+    void              Set(Int_t runId, Int_t runFlag, Int_t runNo, Int_t nRuns, Bool_t hasBadRunList, Bool_t runOK, UInt_t trigLists);
+    void              Reset();
+
+    // run context filled for this run and dataset
+    Bool_t            IsValid(Int_t runId, Int_t runFlag) const { return (fValid && fRunId == runId && fRunFlag == runFlag); }
+
+    Int_t             GetRunId() const                   { return fRunId; }
+    Int_t             GetRunFlag() const                 { return fRunFlag; }
+    Int_t             GetRunNo() const                   { return fRunNo; }            // index in dataset run list, -999 if not listed
+    Int_t             GetNDataSetRuns() const            { return fNRuns; }
+    Bool_t            IsRunOK() const;                                                 // kFALSE if on bad run list, throws without bad run list
+    UInt_t            GetTriggerListMask() const         { return fTrigLists; }        // trigger mask bits with own trigger list
+
+   private:
+    Bool_t            fValid;                       // filled
+    Int_t             fRunId;                       // run ID
+    Int_t             fRunFlag;                     // dataset, see StJetFrameworkPicoBase::fRunFlagEnum
+    Int_t             fRunNo;                       // index of run in dataset run list
+    Int_t             fNRuns;                       // number of runs in dataset run list
+    Bool_t            fHasBadRunList;               // bad run list was loaded
+    Bool_t            fRunOK;                       // not on bad run list
+    UInt_t            fTrigLists;                   // trigger mask bits with own trigger list for the dataset
+
+    ClassDef(StRunContext, 2)
+};
+#endif
@@ -0,0 +1,194 @@
+//******************************************************************************
+//
+// StSparseFillBuffer.cxx
+//
+// Authors: Joel Mazer
+//
+// Fill buffer in front of a THnSparse
+//
+//******************************************************************************
+
+#include "StSparseFillBuffer.h"
+
+// C++ includes
+#include <iostream>
+#include <algorithm>
+
+// ROOT includes
+#include "TAxis.h"
+#include "TArrayD.h"
+#include "TH1.h"
+#include "THnSparse.h"
+
+using std::cout;
+using std::endl;
+
+ClassImp(StSparseFillBuffer)
+
+//_______________________________________________________________________________________________
+StSparseFillBuffer::StSparseFillBuffer() : TObject(),
+  fSparse(0x0),
+  fNDense(0),
+  fNDenseBins(0),
+  fNGroups(0)
+{
+}
+//_______________________________________________________________________________________________
+StSparseFillBuffer::StSparseFillBuffer(THnSparse *h, Int_t nDense, const Int_t *denseAxes, Int_t nGroups) : TObject(),
+  fSparse(0x0),
+  fNDense(0),
+  fNDenseBins(0),
+  fNGroups(0)
+{
+  Init(h, nDense, denseAxes, nGroups);
+}
+//_______________________________________________________________________________________________
+StSparseFillBuffer::~StSparseFillBuffer()
+{
+}
+//
+// Function: set sparse, dense axes and groups
+//_______________________________________________________________________________________________
+void StSparseFillBuffer::Init(THnSparse *h, Int_t nDense, const Int_t *denseAxes, Int_t nGroups)
+{
+  fSparse = h;
+  fNDense = 0;
+  fNDenseBins = 0;
+  fNGroups = 0;
+  fFills.clear();
+  if(!h || nDense <= 0 || nDense > kMaxDim || nDense > h->GetNdimensions() || nGroups <= 0) {
+    cout<<"StSparseFillBuffer::Init(): no sparse, bad number of dense axes or groups - buffer not used!"<<endl;
+    return;
+  }
+
+  Long64_t nBins = 1;
+  for(Int_t i = nDense - 1; i >= 0; i--) {
+    TAxis *axis = h->GetAxis(denseAxes[i]);
+    fDenseAxis[i] = denseAxes[i];
+    fNBins[i] = axis->GetNbins();
+    fXmin[i] = axis->GetXmin();
+    fXmax[i] = axis->GetXmax();
+    fFixBins[i] = (axis->GetXbins()->GetSize() == 0);
+    fStride[i] = nBins;
+    nBins *= fNBins[i] + 2;
+  }
+  fNDense = nDense;
+  fNDenseBins = nBins;
+  fNGroups = nGroups;
+
+  fFills.reserve(10000);
+}
+//
+// Function: bin of dense axis i - same as TAxis::FindFixBin()
+//_______________________________________________________________________________________________
+inline Int_t StSparseFillBuffer::FindBin(Int_t i, Double_t x) const
+{
+  if(!fFixBins[i]) return fSparse->GetAxis(fDenseAxis[i])->FindFixBin(x);
+
+  if(x < fXmin[i])   return 0;
+  if(!(x < fXmax[i])) return fNBins[i] + 1;
+  return 1 + int(fNBins[i]*(x - fXmin[i])/(fXmax[i] - fXmin[i]));
+}
+//
+// Function: add weight to dense bin of group
+//_______________________________________________________________________________________________
+void StSparseFillBuffer::Fill(const Double_t *x, Double_t w, Int_t group)
+{
+  if(fNDense == 0 || group < 0 || group >= fNGroups) return;
+
+  Entry e;
+  e.key = group*fNDenseBins;
+  for(Int_t i = 0; i < fNDense; i++) e.key += FindBin(i, x[i])*fStride[i];
+  e.w = w;
+  fFills.push_back(e);
+}
+//
+// Function: add filled bins to sparse - one bin lookup per filled bin instead of one per fill
+//_______________________________________________________________________________________________
+void StSparseFillBuffer::Flush(const Double_t *x)
+{
+  if(fNDense == 0 || fFills.empty()) return;
+
+  // fills of the same bin are next to each other after sorting
+  std::sort(fFills.begin(), fFills.end());
+
+  // SetBinContent() counts entries - restore afterwards
+  const Int_t dim = fSparse->GetNdimensions();
+  Double_t entries = fSparse->GetEntries();
+  Bool_t calcErrors = fSparse->GetCalculateErrors();
+  Int_t idx[kMaxDim];
+  Int_t group = -1;
+  for(UInt_t first = 0; first < fFills.size(); ) {
+    // sum of fills of this bin
+    Long64_t key = fFills[first].key;
+    Double_t sumw = 0., sumw2 = 0.;
+    UInt_t last = first;
+    for(; last < fFills.size() && fFills[last].key == key; last++) {
+      sumw += fFills[last].w;
+      sumw2 += fFills[last].w*fFills[last].w;
+    }
+    first = last;
+
+    // sparse bin index: fixed axes from x of the group, dense axes from bin key
+    if(key/fNDenseBins != group) {
+      group = key/fNDenseBins;
+      for(Int_t d = 0; d < dim && d < kMaxDim; d++) idx[d] = fSparse->GetAxis(d)->FindFixBin(x[group*dim + d]);
+    }
+    Long64_t rest = key%fNDenseBins;
+    for(Int_t i = 0; i < fNDense; i++) {
+      idx[fDenseAxis[i]] = rest/fStride[i];
+      rest %= fStride[i];
+    }
+
+    Long64_t sparseBin = fSparse->GetBin(idx);
+    if(calcErrors) fSparse->SetBinError2(sparseBin, fSparse->GetBinError2(sparseBin) + sumw2);
+    fSparse->SetBinContent(sparseBin, fSparse->GetBinContent(sparseBin) + sumw);
+  }
+  fSparse->SetEntries(entries + fFills.size());
+
+  Reset();
+}
+//
+// Function: reset - buffer memory stays allocated
+//_______________________________________________________________________________________________
+void StSparseFillBuffer::Reset()
+{
+  fFills.clear();
+}
+//
+// Function: bytes held by the buffer
+//_______________________________________________________________________________________________
+ULong64_t StSparseFillBuffer::GetMemoryUsage() const
+{
+  return (ULong64_t)fFills.capacity()*sizeof(Entry);
+}
+//
+// Function: add n fills at x with summed weights sumw and sumw2 to a TH1
+// bin content, error^2, entries and statistics are the same as for n calls of h->Fill(x, w_i)
+//_______________________________________________________________________________________________
+void StSparseFillBuffer::FillSum(TH1 *h, Double_t x, Double_t sumw, Double_t sumw2, Int_t n)
+{
+  if(!h || n <= 0) return;
+
+  // weighted fills need the sum of squares of weights (as TH1::Fill(x, w) with w != 1)
+  // enable it before changing the content so earlier unit weight fills are carried over
+  if(!h->GetSumw2N() && sumw2 != sumw && !h->TestBit(TH1::kIsNotW)) h->Sumw2();
+
+  Int_t bin = h->GetXaxis()->FindFixBin(x);
+  Double_t entries = h->GetEntries();
+
+  // statistics only from bins in range (as TH1::Fill()) - get before changing the content
+  if(bin > 0 && bin <= h->GetNbinsX()) {
+    Double_t stats[4];
+    h->GetStats(stats);
+    stats[0] += sumw;
+    stats[1] += sumw2;
+    stats[2] += sumw*x;
+    stats[3] += sumw*x*x;
+    h->PutStats(stats);
+  }
+
+  h->AddBinContent(bin, sumw);
+  if(h->GetSumw2N()) h->GetSumw2()->fArray[bin] += sumw2;
+  h->SetEntries(entries + n);
+}
@@ -0,0 +1,82 @@
+//******************************************************************************
+//
+// StSparseFillBuffer.h
+//
+// Authors: Joel Mazer
+//
+// Fill buffer in front of a THnSparse: the axes that change from fill to fill
+// (dense axes) are binned into one flat bin key per fill, the remaining axes are
+// fixed for the whole block of fills - per group - and given at Flush(), when
+// the fills are sorted by key and each filled bin is added to the sparse once
+// (content, error^2 and entries)
+//
+// usage:
+//   Int_t axes[3] = {2, 3, 4};
+//   StSparseFillBuffer buf(hSparse, 3, axes, nGroups);
+//   buf.Fill(xDense, w, group);  // xDense[3]: values of axes 2, 3, 4
+//   buf.Flush(xSparse);          // xSparse[nGroups][dim]: values of all other axes per group, dense axes ignored
+//
+//******************************************************************************
+
+#ifndef StSparseFillBuffer_H
+#define StSparseFillBuffer_H
+
+// ROOT includes
+#include "TObject.h"
+#include <vector>
+
+class THnSparse;
+class TH1;
+
+class StSparseFillBuffer : public TObject
+{
+   public:
+
+    enum { kMaxDim = 20 };
+
+             StSparseFillBuffer();
+             StSparseFillBuffer(THnSparse *h, Int_t nDense, const Int_t *denseAxes, Int_t nGroups = 1);
+    virtual  ~StSparseFillBuffer();
+
+    // set sparse, dense axes and number of groups - binning of dense axes is taken from the sparse
+    void              Init(THnSparse *h, Int_t nDense, const Int_t *denseAxes, Int_t nGroups = 1);
+
+    // add w to the dense bin of x[nDense] in group - same binning as TAxis::FindFixBin()
+    void              Fill(const Double_t *x, Double_t w, Int_t group = 0);
+
+    // add buffer to the sparse at the fixed coordinates x[nGroups*dim] of each group, then reset
+    void              Flush(const Double_t *x);
+    void              Reset();
+
+    Int_t             GetNFills() const               { return (Int_t)fFills.size(); }
+    Int_t             GetNGroups() const              { return fNGroups; }
+    ULong64_t         GetMemoryUsage() const;
+
+    // add a block of fills at x with summed w, w^2 to a TH1 - equal to n calls of h->Fill(x, w_i)
+    static void       FillSum(TH1 *h, Double_t x, Double_t sumw, Double_t sumw2, Int_t n);
+
+   private:
+    Int_t             FindBin(Int_t i, Double_t x) const;
+
+    THnSparse        *fSparse;                      //! sparse filled at Flush()
+    Int_t             fNDense;                      // number of dense axes
+    Int_t             fDenseAxis[kMaxDim];          // sparse axis of each dense axis
+    Int_t             fNBins[kMaxDim];              // bins of dense axis, without under/overflow
+    Double_t          fXmin[kMaxDim];               // lower edge of dense axis
+    Double_t          fXmax[kMaxDim];               // upper edge of dense axis
+    Bool_t            fFixBins[kMaxDim];            // dense axis has fixed bin width
+    Long64_t          fStride[kMaxDim];             // stride of dense axis in bin key
+    Long64_t          fNDenseBins;                  // dense bins per group, incl. under/overflow
+    Int_t             fNGroups;                     // number of groups of fixed coordinates
+
+    // one fill: bin key = group*fNDenseBins + dense bin
+    struct Entry {
+      Long64_t        key;
+      Double_t        w;
+      bool operator<(const Entry &e) const    { return key < e.key; }
+    };
+    std::vector<Entry> fFills;                      //! fills since last Flush()
+
+    ClassDef(StSparseFillBuffer, 1)
+};
+#endif
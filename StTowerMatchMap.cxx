@@ -0,0 +1,97 @@
+//******************************************************************************
+//
+// StTowerMatchMap.cxx
+//
+// Authors: Joel Mazer
+//
+// Compact track-to-tower match map for the hadronic correction
+//
+//******************************************************************************
+
+#include "StTowerMatchMap.h"
+
+ClassImp(StTowerMatchMap)
+
+//_______________________________________________________________________________________________
+StTowerMatchMap::StTowerMatchMap() : TObject(),
+  fBuilt(kFALSE),
+  fRunId(-99),
+  fEventId(-99)
+{
+  for(int i = 0; i < kNTowers; i++) {
+    fNMatched[i] = 0;
+    fOffset[i] = 0;
+    fSumE[i] = 0.;
+    fMaxE[i] = 0.;
+  }
+
+  // typical number of matched towers/tracks in a central Au+Au event - grows as needed
+  fMatchedTowers.reserve(1000);
+  fPairTower.reserve(1000);
+  fPairTrack.reserve(1000);
+  fTrackIndex.reserve(1000);
+}
+//_______________________________________________________________________________________________
+StTowerMatchMap::~StTowerMatchMap()
+{
+}
+//
+// Function: reset - only towers matched in the previous event are touched
+//_______________________________________________________________________________________________
+void StTowerMatchMap::Clear(Option_t * /*opt*/)
+{
+  for(unsigned int i = 0; i < fMatchedTowers.size(); i++) {
+    int itow = fMatchedTowers[i];
+    fNMatched[itow] = 0;
+    fOffset[itow] = 0;
+    fSumE[itow] = 0.;
+    fMaxE[itow] = 0.;
+  }
+
+  fMatchedTowers.clear();
+  fPairTower.clear();
+  fPairTrack.clear();
+  fTrackIndex.clear();
+  fBuilt = kFALSE;
+  fRunId = -99;
+  fEventId = -99;
+}
+//
+// Function: add a track matched to a tower
+// - all matches are counted, only tracks used for the correction enter the E sum and max
+//_______________________________________________________________________________________________
+void StTowerMatchMap::AddMatch(Int_t towerIndex, Int_t trackIndex, Double_t trackE, Bool_t useForCorrection)
+{
+  if(towerIndex < 0 || towerIndex >= kNTowers) return;
+
+  if(fNMatched[towerIndex] == 0) fMatchedTowers.push_back(towerIndex);
+  fNMatched[towerIndex]++;
+  fPairTower.push_back(towerIndex);
+  fPairTrack.push_back(trackIndex);
+
+  if(useForCorrection) {
+    fSumE[towerIndex] += trackE;
+    if(trackE > fMaxE[towerIndex]) fMaxE[towerIndex] = trackE;
+  }
+}
+//
+// Function: build CSR arrays - matched tracks of a tower are kept in the order they were added
+//_______________________________________________________________________________________________
+void StTowerMatchMap::Build()
+{
+  // offsets: point to the end of each tower's block first
+  int offset = 0;
+  for(unsigned int i = 0; i < fMatchedTowers.size(); i++) {
+    int itow = fMatchedTowers[i];
+    offset += fNMatched[itow];
+    fOffset[itow] = offset;
+  }
+
+  // fill blocks back to front, leaving fOffset at the start of each block
+  fTrackIndex.resize(fPairTrack.size());
+  for(int i = (int)fPairTrack.size() - 1; i >= 0; i--) {
+    fTrackIndex[--fOffset[fPairTower[i]]] = fPairTrack[i];
+  }
+
+  fBuilt = kTRUE;
+}
@@ -0,0 +1,67 @@
+//******************************************************************************
+//
+// StTowerMatchMap.h
+//
+// Authors: Joel Mazer
+//
+// Compact track-to-tower match map for the hadronic correction:
+// matched track indices are stored per tower in CSR (offset + index) format
+// and the matched track energy sum and max are accumulated while filling
+//
+//******************************************************************************
+
+#ifndef StTowerMatchMap_H
+#define StTowerMatchMap_H
+
+// ROOT includes
+#include "TObject.h"
+#include <vector>
+
+class StTowerMatchMap : public TObject
+{
+   public:
+
+    enum { kNTowers = 4800 };  // number of BEMC towers, towerIndex = towerID - 1
+
+             StTowerMatchMap();
+    virtual  ~StTowerMatchMap();
+
+    // per event: Clear(), AddMatch() for each matched track, then Build()
+    void              Clear(Option_t *opt = "");
+    void              AddMatch(Int_t towerIndex, Int_t trackIndex, Double_t trackE, Bool_t useForCorrection = kTRUE);
+    void              Build();
+
+    // identify the event the map was built for (to share it between makers)
+    void              SetEvent(Int_t runId, Int_t eventId)          { fRunId = runId; fEventId = eventId; }
+    Bool_t            IsCurrent(Int_t runId, Int_t eventId) const   { return (fBuilt && fRunId == runId && fEventId == eventId); }
+
+    // accessors by tower index (towerID - 1)
+    Int_t             GetNMatched(Int_t towerIndex) const   { return fNMatched[towerIndex]; }  // all matched tracks
+    Bool_t            HasMatch(Int_t towerIndex) const      { return (fNMatched[towerIndex] > 0); }
+    Int_t             GetMatchedTrack(Int_t towerIndex, Int_t i) const { return fTrackIndex[fOffset[towerIndex] + i]; }
+    Double_t          GetSumE(Int_t towerIndex) const       { return fSumE[towerIndex]; }      // sum of E of tracks used for correction
+    Double_t          GetMaxE(Int_t towerIndex) const       { return fMaxE[towerIndex]; }      // max E of tracks used for correction
+
+    // towers with at least one match
+    const std::vector<Int_t> &GetMatchedTowers() const      { return fMatchedTowers; }
+    Int_t             GetNMatches() const                   { return (Int_t)fPairTrack.size(); }
+
+   private:
+    Bool_t            fBuilt;                       // CSR arrays built for current event
+    Int_t             fRunId;                       // run ID of event the map was built for
+    Int_t             fEventId;                     // event ID of event the map was built for
+
+    // per tower - only entries of fMatchedTowers are non-zero
+    Int_t             fNMatched[kNTowers];          // number of matched tracks
+    Int_t             fOffset[kNTowers];            // start of matched tracks in fTrackIndex
+    Double_t          fSumE[kNTowers];              // sum of matched track E
+    Double_t          fMaxE[kNTowers];              // max matched track E
+
+    std::vector<Int_t> fMatchedTowers;              // towers touched this event - used for sparse reset
+    std::vector<Int_t> fPairTower;                  // (tower, track) pairs in fill order
+    std::vector<Int_t> fPairTrack;
+    std::vector<Int_t> fTrackIndex;                 // CSR: matched track indices grouped by tower
+
+    ClassDef(StTowerMatchMap, 1)
+};
+#endif
@@ -0,0 +1,199 @@
+// ################################################################
+// Author:  Joel Mazer for the STAR Collaboration
+// Affiliation: Rutgers University
+//
+// event-scoped track cache: computes track kinematics, charge,
+// matched tower index and quality variables once per event
+// and shares them with the other makers in the chain
+//
+// ################################################################
+
+#include "StTrackCacheMaker.h"
+#include "StRoot/StarRoot/StMemStat.h"
+
+// ROOT includes
+#include "TVector3.h"
+
+// STAR includes
+#include "StRoot/StPicoEvent/StPicoDst.h"
+#include "StRoot/StPicoDstMaker/StPicoDstMaker.h"
+#include "StMaker.h"
+#include "StRoot/StPicoEvent/StPicoEvent.h"
+#include "StRoot/StPicoEvent/StPicoTrack.h"
+
+// jet-framework includes
+#include "StJetFrameworkPicoBase.h"
+
+// old file kept
+#include "StPicoConstants.h"
+#include "StJetPicoDefinitions.h"
+
+ClassImp(StTrackCacheMaker)
+
+//______________________________________________________________________________
+StTrackCacheMaker::StTrackCacheMaker(const char* name, StPicoDstMaker *picoMaker, bool mDoComments = kFALSE)
+  : StJetFrameworkPicoBase(name)
+{
+  fDebugLevel = 0;
+  mPicoDstMaker = 0x0;
+  mPicoDst = 0x0;
+  mPicoEvent = 0x0;
+  fCachedRunId = -99;
+  fCachedEventId = -99;
+  fNTracks = 0;
+  fMaxAcceptedPt = -99.;
+  doComments = mDoComments;
+}
+
+//_____________________________________________________________________________
+StTrackCacheMaker::~StTrackCacheMaker()
+{ /*  */
+  // destructor
+}
+
+//_____________________________________________________________________________
+Int_t StTrackCacheMaker::Init() {
+  // reserve for a typical central Au+Au event, arrays grow as needed
+  fPx.reserve(2000); fPy.reserve(2000); fPz.reserve(2000);
+  fP.reserve(2000);  fE.reserve(2000);
+  fPt.reserve(2000); fEta.reserve(2000); fPhi.reserve(2000);
+  fDca.reserve(2000); fnHitsRatio.reserve(2000); fnHitsFit.reserve(2000);
+  fCharge.reserve(2000); fTowerIndex.reserve(2000); fFlags.reserve(2000);
+  fAccepted.reserve(2000);
+
+  return kStOK;
+}
+//
+// Function: clear or delete objects after running
+//_____________________________________________________________________________
+Int_t StTrackCacheMaker::Finish() {
+  cout << "StTrackCacheMaker::Finish()\n";
+
+  return kStOK;
+}
+//
+// OTHER functions are written below
+//_____________________________________________________________________________
+void StTrackCacheMaker::Clear(Option_t *opt) {
+  // keep capacity, only invalidate the cache
+  fCachedRunId = -99;
+  fCachedEventId = -99;
+}
+//
+// Function: resize arrays without releasing capacity
+//_____________________________________________________________________________
+void StTrackCacheMaker::Resize(Int_t n) {
+  fPx.resize(n); fPy.resize(n); fPz.resize(n);
+  fP.resize(n);  fE.resize(n);
+  fPt.resize(n); fEta.resize(n); fPhi.resize(n);
+  fDca.resize(n); fnHitsRatio.resize(n); fnHitsFit.resize(n);
+  fCharge.resize(n); fTowerIndex.resize(n); fFlags.resize(n);
+  fAccepted.clear();
+  fNTracks = n;
+}
+//
+//  This method is called every event.
+//_____________________________________________________________________________
+Int_t StTrackCacheMaker::Make() {
+  fNTracks = 0;
+  fMaxAcceptedPt = -99.;
+
+  // get PicoDstMaker
+  mPicoDstMaker = static_cast<StPicoDstMaker*>(GetMaker("picoDst"));
+  if(!mPicoDstMaker) {
+    LOG_WARN << " No PicoDstMaker! Skip! " << endm;
+    return kStWarn;
+  }
+
+  // get PicoDst object from maker
+  mPicoDst = static_cast<StPicoDst*>(mPicoDstMaker->picoDst());
+  if(!mPicoDst) {
+    LOG_WARN << " No PicoDst! Skip! " << endm;
+    return kStWarn;
+  }
+
+  // get pointer to PicoEvent
+  mPicoEvent = static_cast<StPicoEvent*>(mPicoDst->event());
+  if(!mPicoEvent) {
+    LOG_WARN << " No PicoEvent! Skip! " << endm;
+    return kStWarn;
+  }
+
+  // get event B (magnetic) field and vertex 3-vector
+  Bfield = mPicoEvent->bField();
+  mVertex = mPicoEvent->primaryVertex();
+  zVtx = mVertex.z();
+
+  // constants: assume neutral pion mass
+  double pi = 1.0*TMath::Pi();
+  double pi0mass = Pico::mMass[0]; // GeV
+
+  // size arrays to number of tracks
+  int nTracks = mPicoDst->numberOfTracks();
+  Resize(nTracks);
+
+  // loop over ALL tracks in PicoDst once
+  for(int i = 0; i < nTracks; i++) {
+    fFlags[i] = 0;
+    fPx[i] = 0.; fPy[i] = 0.; fPz[i] = 0.; fP[i] = 0.; fE[i] = 0.;
+    fPt[i] = 0.; fEta[i] = -999.; fPhi[i] = -999.;
+    fDca[i] = 999.; fnHitsRatio[i] = 0.; fnHitsFit[i] = 0;
+    fCharge[i] = 0; fTowerIndex[i] = -1;
+
+    // get track pointer
+    StPicoTrack *trk = static_cast<StPicoTrack*>(mPicoDst->track(i));
+    if(!trk) { continue; }
+
+    // quality variables and matched tower - independent of track type
+    bool isPrimary = trk->isPrimary();
+    int nHitsFit = trk->nHitsFit();
+    int nHitsMax = trk->nHitsMax();
+    fDca[i] = trk->gDCA(mVertex).Mag();
+    fnHitsFit[i] = nHitsFit;
+    fnHitsRatio[i] = (nHitsMax > 0) ? 1.0*nHitsFit/nHitsMax : 0.;
+    fCharge[i] = trk->charge();
+    fTowerIndex[i] = trk->bemcTowerIndex(); // towerIndex = towerID - 1
+    if(isPrimary)             fFlags[i] |= kIsPrimary;
+    if(fTowerIndex[i] >= 0)   fFlags[i] |= kHasTowerMatch;
+
+    // primary track switch: get momentum vector of track - global or primary track
+    TVector3 mTrkMom;
+    if(doUsePrimTracks) {
+      if(!isPrimary) continue;          // no momentum for non-primary tracks
+      mTrkMom = trk->pMom();            // get primary track vector
+    } else {
+      mTrkMom = trk->gMom(mVertex, Bfield); // get global track vector
+    }
+
+    // track variables
+    double pt = mTrkMom.Perp();
+    double phi = mTrkMom.Phi();
+    if(phi < 0.0)    phi += 2.0*pi;  // force from 0-2pi
+    if(phi > 2.0*pi) phi -= 2.0*pi;  // force from 0-2pi
+    double p = mTrkMom.Mag();
+    fPx[i] = mTrkMom.x();
+    fPy[i] = mTrkMom.y();
+    fPz[i] = mTrkMom.z();
+    fP[i] = p;
+    fE[i] = 1.0*TMath::Sqrt(p*p + pi0mass*pi0mass);
+    fPt[i] = pt;
+    fEta[i] = mTrkMom.PseudoRapidity();
+    fPhi[i] = phi;
+    fFlags[i] |= kHasMomentum;
+
+    // standard cuts of this maker
+    if(PassCuts(i, fTrackPtMinCut, fTrackPtMaxCut, fTrackEtaMinCut, fTrackEtaMaxCut, fTrackPhiMinCut, fTrackPhiMaxCut, fTrackDCAcut, fTracknHitsFit, fTracknHitsRatio)) {
+      fFlags[i] |= kPassedCuts;
+      fAccepted.push_back(i);
+      if(pt > fMaxAcceptedPt) fMaxAcceptedPt = pt;
+    }
+  }
+
+  // cache is valid for this event
+  fCachedRunId = mPicoEvent->runId();
+  fCachedEventId = mPicoEvent->eventId();
+
+  if(fDebugLevel > 0) cout<<"StTrackCacheMaker: nTracks = "<<fNTracks<<"  nAccepted = "<<fAccepted.size()<<"  maxPt = "<<fMaxAcceptedPt<<endl;
+
+  return kStOK;
+}
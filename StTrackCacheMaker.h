@@ -0,0 +1,135 @@
+#ifndef StTrackCacheMaker_h
+#define StTrackCacheMaker_h
+
+#include "StJetFrameworkPicoBase.h"
+#include <vector>
+class StJetFrameworkPicoBase;
+
+// STAR classes
+class StPicoDst;
+class StPicoDstMaker;
+class StPicoEvent;
+class StPicoTrack;
+
+/**
+ * @brief Event-scoped cache of track kinematics shared by all makers in the chain
+ *
+ * Loops over the PicoDst tracks once per event, computes the (primary or global) momentum,
+ * pt, eta, phi (0, 2pi), charge, matched BEMC tower index and the quality variables used
+ * by the track cuts, and stores them in contiguous (SoA) arrays indexed by the PicoDst
+ * track index. Downstream makers read these arrays instead of re-calling gMom() and
+ * AcceptTrack() on every StPicoTrack. Each consumer still applies its own cuts via PassCuts(),
+ * the tracks passing this maker's standard cuts are flagged kPassedCuts.
+ *
+ * Add to the chain right after the CentMaker, the default name expected by consumers is "TrackCacheMaker".
+ */
+class StTrackCacheMaker : public StJetFrameworkPicoBase {
+  public:
+
+    // quality flags stored per track
+    enum fTrackCacheFlagEnum {
+      kHasMomentum   = BIT(0), // momentum was computed (unset for non-primary tracks when using primary tracks)
+      kIsPrimary     = BIT(1), // track has a primary vertex fit
+      kHasTowerMatch = BIT(2), // track matched to a BEMC tower
+      kPassedCuts    = BIT(3)  // track passed the standard cuts set on this maker
+    };
+
+    StTrackCacheMaker(const char *name, StPicoDstMaker *picoMaker, bool mDoComments);
+    virtual ~StTrackCacheMaker();
+
+    // class required functions
+    virtual Int_t Init();
+    virtual Int_t Make();
+    virtual void  Clear(Option_t *opt="");
+    virtual Int_t Finish();
+
+    // switches
+    virtual void            SetDebugLevel(Int_t l)             { fDebugLevel       = l; }
+
+    // validity of cache: filled for this event and for the requested track type
+    Bool_t                  IsCurrent(Int_t runId, Int_t eventId) const { return (fCachedRunId == runId && fCachedEventId == eventId); }
+    Bool_t                  GetUsePrimaryTracks() const        { return doUsePrimTracks; }
+
+    // per-track accessors - index is the PicoDst track index
+    Int_t                   GetNumberOfTracks() const          { return fNTracks; }
+    Float_t                 GetPx(Int_t i) const               { return fPx[i]; }
+    Float_t                 GetPy(Int_t i) const               { return fPy[i]; }
+    Float_t                 GetPz(Int_t i) const               { return fPz[i]; }
+    Float_t                 GetP(Int_t i) const                { return fP[i]; }
+    Float_t                 GetE(Int_t i) const                { return fE[i]; }     // assumes pi0 mass
+    Float_t                 GetPt(Int_t i) const               { return fPt[i]; }
+    Float_t                 GetEta(Int_t i) const              { return fEta[i]; }
+    Float_t                 GetPhi(Int_t i) const              { return fPhi[i]; }   // (0, 2pi)
+    Float_t                 GetDca(Int_t i) const              { return fDca[i]; }
+    Float_t                 GetnHitsRatio(Int_t i) const       { return fnHitsRatio[i]; }
+    Int_t                   GetnHitsFit(Int_t i) const         { return fnHitsFit[i]; }
+    Short_t                 GetCharge(Int_t i) const           { return fCharge[i]; }
+    Int_t                   GetTowerIndex(Int_t i) const       { return fTowerIndex[i]; } // towerIndex = towerID - 1
+    UChar_t                 GetFlags(Int_t i) const            { return fFlags[i]; }
+    Bool_t                  HasMomentum(Int_t i) const         { return (fFlags[i] & kHasMomentum); }
+    Bool_t                  IsAccepted(Int_t i) const          { return (fFlags[i] & kPassedCuts); }
+
+    // contiguous array access
+    const Float_t          *GetPtArray() const                 { return fNTracks ? &fPt[0]  : 0x0; }
+    const Float_t          *GetEtaArray() const                { return fNTracks ? &fEta[0] : 0x0; }
+    const Float_t          *GetPhiArray() const                { return fNTracks ? &fPhi[0] : 0x0; }
+
+    // tracks passing standard cuts of this maker
+    const std::vector<Int_t> &GetAcceptedTracks() const        { return fAccepted; }
+    Double_t                GetMaxAcceptedTrackPt() const      { return fMaxAcceptedPt; }
+
+    // apply a cut set to a cached track: returns kFALSE if no momentum was cached
+    Bool_t                  PassCuts(Int_t i, Double_t ptMin, Double_t ptMax, Double_t etaMin, Double_t etaMax,
+                                     Double_t phiMin, Double_t phiMax, Double_t dcaMax, Int_t nHitsFitMin, Double_t nHitsRatioMin) const;
+
+  protected:
+    void                    Resize(Int_t n);
+
+    // cached event identifiers
+    Int_t                   fCachedRunId;                // run ID of cached event
+    Int_t                   fCachedEventId;              // event ID of cached event
+    Int_t                   fNTracks;                    // number of PicoDst tracks in cache
+    Double_t                fMaxAcceptedPt;              // max pt of tracks passing standard cuts
+
+    // SoA track arrays
+    std::vector<Float_t>    fPx;//!
+    std::vector<Float_t>    fPy;//!
+    std::vector<Float_t>    fPz;//!
+    std::vector<Float_t>    fP;//!
+    std::vector<Float_t>    fE;//!
+    std::vector<Float_t>    fPt;//!
+    std::vector<Float_t>    fEta;//!
+    std::vector<Float_t>    fPhi;//!
+    std::vector<Float_t>    fDca;//!
+    std::vector<Float_t>    fnHitsRatio;//!
+    std::vector<Int_t>      fnHitsFit;//!
+    std::vector<Short_t>    fCharge;//!
+    std::vector<Int_t>      fTowerIndex;//!
+    std::vector<UChar_t>    fFlags;//!
+    std::vector<Int_t>      fAccepted;//! indices of tracks passing standard cuts
+
+  private:
+    // switches
+    bool                    doComments;
+
+    ClassDef(StTrackCacheMaker, 1)
+};
+
+//
+// Function: apply a set of track cuts to cached values - mirrors StJetFrameworkPicoBase::AcceptTrack()
+//________________________________________________________________________
+inline Bool_t StTrackCacheMaker::PassCuts(Int_t i, Double_t ptMin, Double_t ptMax, Double_t etaMin, Double_t etaMax,
+                                          Double_t phiMin, Double_t phiMax, Double_t dcaMax, Int_t nHitsFitMin, Double_t nHitsRatioMin) const
+{
+  if(!(fFlags[i] & kHasMomentum)) return kFALSE;
+  if(fPt[i] < ptMin) return kFALSE;
+  if(fPt[i] > ptMax) return kFALSE;
+  if((fEta[i] < etaMin) || (fEta[i] > etaMax)) return kFALSE;
+  if((fPhi[i] < phiMin) || (fPhi[i] > phiMax)) return kFALSE;
+  if(fDca[i] > dcaMax)                 return kFALSE;
+  if(fnHitsFit[i] < nHitsFitMin)       return kFALSE;
+  if(fnHitsRatio[i] < nHitsRatioMin)   return kFALSE;
+
+  return kTRUE;
+}
+#endif
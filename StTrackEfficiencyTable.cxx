@@ -0,0 +1,171 @@
+//******************************************************************************
+//
+// StTrackEfficiencyTable.cxx
+//
+// Authors: Joel Mazer
+//
+// In-memory single-track reconstruction efficiency lookup table
+//
+//******************************************************************************
+
+#include "StTrackEfficiencyTable.h"
+
+// ROOT includes
+#include "TFile.h"
+#include "TH2.h"
+#include "TAxis.h"
+#include "TArrayD.h"
+#include <iostream>
+
+// jet-framework includes
+#include "StJetFrameworkPicoBase.h"
+
+using std::cout;
+using std::endl;
+
+ClassImp(StTrackEfficiencyTable)
+
+//_________________________________________________________________________________________
+StTrackEfficiencyTable::StTrackEfficiencyTable() : TObject()
+{
+  Reset();
+}
+
+//_________________________________________________________________________________________
+StTrackEfficiencyTable::~StTrackEfficiencyTable()
+{ /*  */
+  // destructor
+}
+//
+// Function: clear table and binning
+//_________________________________________________________________________________________
+void StTrackEfficiencyTable::Reset()
+{
+  fLoaded = kFALSE;
+  fSourceName = "";
+  fRunFlag = -99;
+  for(int is = 0; is < kNSpecies; is++) fHasSpecies[is] = kFALSE;
+  fNCent = 0; fNLumi = 0;
+  fPtMax = 9999.;
+  fNx = 0; fNy = 0; fNCells = 0;
+  fXmin = 0.; fXmax = 0.; fXwidth = 1.;
+  fYmin = 0.; fYmax = 0.; fYwidth = 1.;
+  fXedges.clear();
+  fYedges.clear();
+  fTable.clear();
+}
+//
+// Function: take binning from the first map - all maps of a dataset share it
+//_________________________________________________________________________________________
+Bool_t StTrackEfficiencyTable::SetBinning(const TH2 *h)
+{
+  const TAxis *xaxis = h->GetXaxis();
+  const TAxis *yaxis = h->GetYaxis();
+  fNx = xaxis->GetNbins();
+  fNy = yaxis->GetNbins();
+  fNCells = (fNx + 2)*(fNy + 2);
+  fXmin = xaxis->GetXmin(); fXmax = xaxis->GetXmax(); fXwidth = fXmax - fXmin;
+  fYmin = yaxis->GetXmin(); fYmax = yaxis->GetXmax(); fYwidth = fYmax - fYmin;
+
+  // variable bin sizes: keep the edges for a binary search
+  fXedges.clear();
+  fYedges.clear();
+  const TArrayD *xbins = xaxis->GetXbins();
+  const TArrayD *ybins = yaxis->GetXbins();
+  if(xbins->GetSize() > 0) fXedges.assign(xbins->GetArray(), xbins->GetArray() + xbins->GetSize());
+  if(ybins->GetSize() > 0) fYedges.assign(ybins->GetArray(), ybins->GetArray() + ybins->GetSize());
+
+  return (fNx > 0 && fNy > 0);
+}
+//
+// Function: copy all cells (including under/overflow) of one map into the table
+//_________________________________________________________________________________________
+Bool_t StTrackEfficiencyTable::CopyMap(const TH2 *h, Int_t species, Int_t cbin, Int_t lumiBin)
+{
+  if(h->GetXaxis()->GetNbins() != fNx || h->GetYaxis()->GetNbins() != fNy) {
+    cout<<"StTrackEfficiencyTable: binning of "<<h->GetName()<<" differs from first map, not used!"<<endl;
+    return kFALSE;
+  }
+
+  int offset = MapOffset(species, cbin, lumiBin);
+  for(int icell = 0; icell < fNCells; icell++) {
+    fTable[offset + icell] = h->GetBinContent(icell);
+  }
+
+  return kTRUE;
+}
+//
+// Function: check if a load from this file was already attempted
+// - compared by name, so makers opening their own copy of the same file share the table
+//_________________________________________________________________________________________
+Bool_t StTrackEfficiencyTable::IsLoadedFrom(const TFile *infile) const
+{
+  if(fRunFlag == -99) return kFALSE;
+  return (fSourceName == (infile ? infile->GetName() : ""));
+}
+//
+// Function: read all efficiency maps of the dataset from the input file
+// - histograms are deleted after copying, the file is no longer needed for lookups
+//_________________________________________________________________________________________
+Bool_t StTrackEfficiencyTable::Load(TFile *infile, Int_t runFlag)
+{
+  Reset();
+  fSourceName = infile ? infile->GetName() : "";
+  fRunFlag = runFlag;
+  if(!infile) {
+    cout<<"StTrackEfficiencyTable: no efficiency input file!"<<endl;
+    return kFALSE;
+  }
+
+  const char *species[kNSpecies] = {"pion", "kaon", "proton"};
+
+  // ========== AuAu Run14 ===========
+  if(runFlag == StJetFrameworkPicoBase::Run14_AuAu200 || runFlag == StJetFrameworkPicoBase::Run14_AuAu200_MB) {
+    fNCent = 16;   // GetRef16() bins
+    fNLumi = 10;   // GetLuminosityBin() bins
+    fPtMax = 4.5;  // pt is flat for AuAu above 5.0 (4.5) GeV
+
+    for(int is = 0; is < kNSpecies; is++) {
+      for(int ic = 0; ic < fNCent; ic++) {
+        for(int il = 0; il < fNLumi; il++) {
+          TH2 *h = dynamic_cast<TH2*>(infile->Get(Form("hTrack_%s_Efficiency_pTEta_final_centbin%d_lumibin%d", species[is], ic, il)));
+          if(!h) {
+            // only pions are required
+            if(is == kPion) cout<<"don't have requested histogram! "<<Form("hTrack_%s_Efficiency_pTEta_final_centbin%d_lumibin%d", species[is], ic, il)<<endl;
+            continue;
+          }
+
+          // first map found: set binning and allocate the full table
+          if(fTable.empty()) {
+            SetBinning(h);
+            fTable.assign(kNSpecies*fNCent*fNLumi*fNCells, -99.);
+          }
+
+          if(CopyMap(h, is, ic, il)) fHasSpecies[is] = kTRUE;
+          delete h;
+        }
+      }
+    }
+  } // Run14 AuAu
+
+  // ========= Run12 pp ========
+  if(runFlag == StJetFrameworkPicoBase::Run12_pp200) {
+    fNCent = 1;
+    fNLumi = 1;
+    fPtMax = 1.8;  // pt is flat for pp above 2.0 (1.8) GeV
+
+    TH2 *h = dynamic_cast<TH2*>(infile->Get("hppRun12_PtEtaEfficiency_data_aacuts"));
+    if(!h) cout<<"don't have requested histogram! hppRun12_PtEtaEfficiency_data_aacuts"<<endl;
+    else {
+      SetBinning(h);
+      fTable.assign(kNSpecies*fNCent*fNLumi*fNCells, -99.);
+      if(CopyMap(h, kPion, 0, 0)) fHasSpecies[kPion] = kTRUE;
+      delete h;
+    }
+  } // Run12 pp
+
+  fLoaded = !fTable.empty();
+
+  if(fLoaded) cout<<"StTrackEfficiencyTable: loaded "<<fNCent<<" x "<<fNLumi<<" maps with "<<fNx<<" x "<<fNy<<" bins from "<<infile->GetName()<<endl;
+  return fLoaded;
+}
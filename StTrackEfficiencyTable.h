@@ -0,0 +1,109 @@
+//******************************************************************************
+//
+// StTrackEfficiencyTable.h
+//
+// Authors: Joel Mazer
+//
+// In-memory single-track reconstruction efficiency lookup table:
+// all centrality x luminosity x species pt-eta maps are read from the
+// efficiency file once and stored in one flat array
+//
+//******************************************************************************
+
+#ifndef StTrackEfficiencyTable_H
+#define StTrackEfficiencyTable_H
+
+// ROOT includes
+#include "TObject.h"
+#include "TString.h"
+#include <vector>
+#include <algorithm>
+
+// ROOT classes
+class TFile;
+class TH2;
+
+class StTrackEfficiencyTable : public TObject
+{
+   public:
+
+    // particle species with efficiency maps
+    enum fEffSpeciesEnum { kPion = 0, kKaon = 1, kProton = 2, kNSpecies = 3 };
+
+             StTrackEfficiencyTable();
+    virtual  ~StTrackEfficiencyTable();
+
+    // load all maps for the dataset from the input file, returns kFALSE if nothing was loaded
+    Bool_t            Load(TFile *infile, Int_t runFlag);
+    void              Reset();
+
+    Bool_t            IsLoaded() const                   { return fLoaded; }
+    Bool_t            IsLoadedFrom(const TFile *infile) const;  // load already attempted from this file (by name)
+    Bool_t            HasSpecies(Int_t species) const    { return (species >= 0 && species < kNSpecies && fHasSpecies[species]); }
+    Int_t             GetNCentBins() const               { return fNCent; }
+    Int_t             GetNLumiBins() const               { return fNLumi; }
+    Double_t          GetPtMax() const                   { return fPtMax; }
+
+    // single track lookup: same bin content as TH2::FindBin() + GetBinContent() on the input map
+    Double_t          GetEfficiency(Double_t pt, Double_t eta, Int_t cbin, Int_t lumiBin, Int_t species = kPion) const;
+
+   private:
+    Bool_t            CopyMap(const TH2 *h, Int_t species, Int_t cbin, Int_t lumiBin);
+    Bool_t            SetBinning(const TH2 *h);
+    Int_t             FindBin(Double_t pt, Double_t eta) const;
+    Int_t             MapOffset(Int_t species, Int_t cbin, Int_t lumiBin) const { return ((species*fNCent + cbin)*fNLumi + lumiBin)*fNCells; }
+
+    Bool_t            fLoaded;                      // table filled
+    TString           fSourceName;                  // name of file the table was filled from
+    Int_t             fRunFlag;                     // run flag of loaded dataset
+    Bool_t            fHasSpecies[kNSpecies];       // species maps found in file
+    Int_t             fNCent;                       // number of centrality bins (1 for pp)
+    Int_t             fNLumi;                       // number of luminosity bins (1 for pp)
+    Double_t          fPtMax;                       // efficiency is flat above this pt
+
+    // binning of the maps, including under/overflow cells as in TH2
+    Int_t             fNx;                          // number of pt bins
+    Int_t             fNy;                          // number of eta bins
+    Int_t             fNCells;                      // (fNx+2)*(fNy+2)
+    Double_t          fXmin, fXmax, fXwidth;        // pt axis
+    Double_t          fYmin, fYmax, fYwidth;        // eta axis
+    std::vector<Double_t> fXedges;                  // pt bin edges, only filled for variable binning
+    std::vector<Double_t> fYedges;                  // eta bin edges, only filled for variable binning
+
+    std::vector<Float_t> fTable;                    // [species][cent][lumi][cell]
+
+    ClassDef(StTrackEfficiencyTable, 1)
+};
+
+//
+// Function: global bin of (pt, eta) - same convention as TAxis::FindBin()
+//_________________________________________________________________________________________
+inline Int_t StTrackEfficiencyTable::FindBin(Double_t pt, Double_t eta) const
+{
+  Int_t binx, biny;
+  if(pt < fXmin)          binx = 0;
+  else if(!(pt < fXmax))  binx = fNx + 1;
+  else if(fXedges.empty()) binx = 1 + Int_t(fNx*(pt - fXmin)/fXwidth);
+  else                    binx = std::upper_bound(fXedges.begin(), fXedges.end(), pt) - fXedges.begin();
+
+  if(eta < fYmin)          biny = 0;
+  else if(!(eta < fYmax))  biny = fNy + 1;
+  else if(fYedges.empty()) biny = 1 + Int_t(fNy*(eta - fYmin)/fYwidth);
+  else                     biny = std::upper_bound(fYedges.begin(), fYedges.end(), eta) - fYedges.begin();
+
+  return binx + (fNx + 2)*biny;
+}
+//
+// Function: single track efficiency lookup - O(1), no allocation
+//_________________________________________________________________________________________
+inline Double_t StTrackEfficiencyTable::GetEfficiency(Double_t pt, Double_t eta, Int_t cbin, Int_t lumiBin, Int_t species) const
+{
+  if(!fLoaded || !HasSpecies(species)) return -99.;
+  if(fNCent == 1) cbin = 0;
+  if(fNLumi == 1) lumiBin = 0;
+  if(cbin < 0 || cbin >= fNCent || lumiBin < 0 || lumiBin >= fNLumi) return -99.;
+
+  if(pt > fPtMax) pt = fPtMax;  // flat above max pt
+  return fTable[MapOffset(species, cbin, lumiBin) + FindBin(pt, eta)];
+}
+#endif
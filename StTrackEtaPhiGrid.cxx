@@ -0,0 +1,232 @@
+//******************************************************************************
+//
+// StTrackEtaPhiGrid.cxx
+//
+// Authors: Joel Mazer
+//
+// Per-event eta-phi cell grid of accepted tracks for cone based analyses
+//
+//******************************************************************************
+
+#include "StTrackEtaPhiGrid.h"
+
+// ROOT includes
+#include "TMath.h"
+
+ClassImp(StTrackEtaPhiGrid)
+
+//_______________________________________________________________________________________________
+StTrackEtaPhiGrid::StTrackEtaPhiGrid() : TObject(),
+  fBuilt(kFALSE),
+  fRunId(-99),
+  fEventId(-99),
+  fEtaMin(-1.0),
+  fEtaCellSize(0.1),
+  fPhiCellSize(0.1),
+  fNEta(1),
+  fNPhi(1)
+{
+  // default: TPC acceptance |eta| < 1 with 0.1 x ~0.1 cells
+  SetGeometry(-1.0, 1.0, 0.1);
+}
+//_______________________________________________________________________________________________
+StTrackEtaPhiGrid::StTrackEtaPhiGrid(Double_t etaMin, Double_t etaMax, Double_t cellSize) : TObject(),
+  fBuilt(kFALSE),
+  fRunId(-99),
+  fEventId(-99),
+  fEtaMin(-1.0),
+  fEtaCellSize(0.1),
+  fPhiCellSize(0.1),
+  fNEta(1),
+  fNPhi(1)
+{
+  SetGeometry(etaMin, etaMax, cellSize);
+}
+//_______________________________________________________________________________________________
+StTrackEtaPhiGrid::~StTrackEtaPhiGrid()
+{
+}
+//
+// Function: set cells - phi cells are sized to tile (0, 2pi) exactly
+//_______________________________________________________________________________________________
+void StTrackEtaPhiGrid::SetGeometry(Double_t etaMin, Double_t etaMax, Double_t cellSize)
+{
+  if(cellSize <= 0. || etaMax <= etaMin) return;
+
+  fEtaMin = etaMin;
+  fNEta = (Int_t)TMath::Ceil((etaMax - etaMin)/cellSize - 1e-9);
+  if(fNEta < 1) fNEta = 1;
+  fEtaCellSize = (etaMax - etaMin)/fNEta;
+
+  fNPhi = (Int_t)(2.0*TMath::Pi()/cellSize);
+  if(fNPhi < 1) fNPhi = 1;
+  fPhiCellSize = 2.0*TMath::Pi()/fNPhi;
+
+  fCellOffset.assign(fNEta*fNPhi + 1, 0);
+
+  // typical number of accepted tracks in a central Au+Au event - grows as needed
+  fFillCell.reserve(2000); fFillTrack.reserve(2000);
+  fFillPt.reserve(2000); fFillEta.reserve(2000); fFillPhi.reserve(2000);
+  fTrackIndex.reserve(2000);
+  fPt.reserve(2000); fEta.reserve(2000); fPhi.reserve(2000);
+}
+//
+// Function: reset - memory stays allocated
+//_______________________________________________________________________________________________
+void StTrackEtaPhiGrid::Clear(Option_t * /*opt*/)
+{
+  fFillCell.clear();
+  fFillTrack.clear();
+  fFillPt.clear();
+  fFillEta.clear();
+  fFillPhi.clear();
+  fTrackIndex.clear();
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fBuilt = kFALSE;
+  fRunId = -99;
+  fEventId = -99;
+}
+//
+// Function: eta cell, tracks and queries beyond the grid are clamped to the edge cells
+//_______________________________________________________________________________________________
+Int_t StTrackEtaPhiGrid::EtaCell(Double_t eta) const
+{
+  Double_t x = (eta - fEtaMin)/fEtaCellSize;
+  if(!(x > 0.)) return 0; // also catches NaN
+  if(x >= fNEta) return fNEta - 1;
+
+  return (Int_t)x;
+}
+//
+// Function: phi cell of phi in (0, 2pi)
+//_______________________________________________________________________________________________
+Int_t StTrackEtaPhiGrid::PhiCell(Double_t phi) const
+{
+  Int_t iphi = (Int_t)(phi/fPhiCellSize);
+  if(iphi < 0) iphi = 0;
+  if(iphi >= fNPhi) iphi = fNPhi - 1;
+
+  return iphi;
+}
+//
+// Function: add an accepted track
+//_______________________________________________________________________________________________
+void StTrackEtaPhiGrid::AddTrack(Int_t trackIndex, Double_t pt, Double_t eta, Double_t phi)
+{
+  double pi = 1.0*TMath::Pi();
+  if(phi < 0.0)     phi += 2.0*pi;  // require 0,2pi interval
+  if(phi >= 2.0*pi) phi -= 2.0*pi;
+
+  fFillCell.push_back(EtaCell(eta)*fNPhi + PhiCell(phi));
+  fFillTrack.push_back(trackIndex);
+  fFillPt.push_back(pt);
+  fFillEta.push_back(eta);
+  fFillPhi.push_back(phi);
+}
+//
+// Function: build CSR arrays - tracks of a cell are kept in the order they were added
+//_______________________________________________________________________________________________
+void StTrackEtaPhiGrid::Build()
+{
+  int nCells = fNEta*fNPhi;
+  int nTracks = (int)fFillCell.size();
+
+  // offsets: count per cell, then point to the end of each cell's block
+  fCellOffset.assign(nCells + 1, 0);
+  for(int i = 0; i < nTracks; i++) fCellOffset[fFillCell[i]]++;
+  for(int c = 1; c < nCells; c++) fCellOffset[c] += fCellOffset[c - 1];
+  fCellOffset[nCells] = nTracks;
+
+  // fill blocks back to front, leaving fCellOffset at the start of each block
+  fTrackIndex.resize(nTracks);
+  fPt.resize(nTracks);
+  fEta.resize(nTracks);
+  fPhi.resize(nTracks);
+  for(int i = nTracks - 1; i >= 0; i--) {
+    int k = --fCellOffset[fFillCell[i]];
+    fTrackIndex[k] = fFillTrack[i];
+    fPt[k] = fFillPt[i];
+    fEta[k] = fFillEta[i];
+    fPhi[k] = fFillPhi[i];
+  }
+
+  fBuilt = kTRUE;
+}
+//
+// Function: tracks with deltaR <= radius of (eta, phi)
+//_______________________________________________________________________________________________
+Int_t StTrackEtaPhiGrid::FindInCone(Double_t eta, Double_t phi, Double_t radius,
+                                    std::vector<Int_t> &entries, std::vector<Double_t> *deltaR) const
+{
+  return FindInAnnulus(eta, phi, -1.0, radius, entries, deltaR);
+}
+//
+// Function: tracks with rMin < deltaR <= rMax of (eta, phi)
+// - only cells within rMax in eta and phi are visited, phi cells wrap around 2pi
+//_______________________________________________________________________________________________
+Int_t StTrackEtaPhiGrid::FindInAnnulus(Double_t eta, Double_t phi, Double_t rMin, Double_t rMax,
+                                       std::vector<Int_t> &entries, std::vector<Double_t> *deltaR) const
+{
+  entries.clear();
+  if(deltaR) deltaR->clear();
+  if(!fBuilt || rMax < 0.) return 0;
+
+  // query axis to (0, 2pi)
+  double pi = 1.0*TMath::Pi();
+  if(TMath::Abs(phi) > 4.0*pi) return 0;  // unset axis
+  while(phi < 0.0)     phi += 2.0*pi;
+  while(phi >= 2.0*pi) phi -= 2.0*pi;
+
+  // eta cells within reach
+  int ietaLo = EtaCell(eta - rMax);
+  int ietaHi = EtaCell(eta + rMax);
+
+  // phi cells within reach - all of them when the range covers the full circle
+  int nPhiOff = (int)(rMax/fPhiCellSize) + 1;
+  int iphiLo = 0, iphiHi = fNPhi - 1;
+  if(2*nPhiOff + 1 < fNPhi) {
+    int iphiAxis = PhiCell(phi);
+    iphiLo = iphiAxis - nPhiOff;
+    iphiHi = iphiAxis + nPhiOff;
+  }
+
+  for(int ieta = ietaLo; ieta <= ietaHi; ieta++) {
+    for(int ip = iphiLo; ip <= iphiHi; ip++) {
+      int iphi = (ip < 0) ? ip + fNPhi : ((ip >= fNPhi) ? ip - fNPhi : ip);
+      int cell = ieta*fNPhi + iphi;
+
+      for(int k = fCellOffset[cell]; k < fCellOffset[cell + 1]; k++) {
+        // radial distance between track and axis
+        double deltaEta = 1.0*TMath::Abs(eta - fEta[k]);
+        double deltaPhi = 1.0*TMath::Abs(phi - fPhi[k]);
+        if(deltaPhi > 1.0*pi) deltaPhi = 2.0*pi - deltaPhi;
+        double dR = 1.0*TMath::Sqrt(deltaEta*deltaEta + deltaPhi*deltaPhi);
+        if(dR > rMax || dR <= rMin) continue;
+
+        entries.push_back(k);
+        if(deltaR) deltaR->push_back(dR);
+      }
+    }
+  }
+
+  return (Int_t)entries.size();
+}
+//
+// Function: tracks with |eta_trk - eta| < halfWidth at any phi
+// - the cells of an eta row are contiguous, so the strip is one block of entries
+//_______________________________________________________________________________________________
+Int_t StTrackEtaPhiGrid::FindInEtaStrip(Double_t eta, Double_t halfWidth, std::vector<Int_t> &entries) const
+{
+  entries.clear();
+  if(!fBuilt || halfWidth <= 0.) return 0;
+
+  int ietaLo = EtaCell(eta - halfWidth);
+  int ietaHi = EtaCell(eta + halfWidth);
+  for(int k = fCellOffset[ietaLo*fNPhi]; k < fCellOffset[(ietaHi + 1)*fNPhi]; k++) {
+    if(TMath::Abs(fEta[k] - eta) < halfWidth) entries.push_back(k);
+  }
+
+  return (Int_t)entries.size();
+}
@@ -0,0 +1,90 @@
+//******************************************************************************
+//
+// StTrackEtaPhiGrid.h
+//
+// Authors: Joel Mazer
+//
+// Per-event eta-phi cell grid of accepted tracks for cone based analyses:
+// track pt, eta, phi (0, 2pi) and PicoDst index are stored grouped by cell in
+// CSR (offset + entry) format. Cone, annulus and eta-strip queries only visit
+// the cells within reach of the query (with phi wraparound), so a jet shape or
+// background cone costs O(tracks in cone) instead of O(tracks in event)
+//
+//******************************************************************************
+
+#ifndef StTrackEtaPhiGrid_H
+#define StTrackEtaPhiGrid_H
+
+// ROOT includes
+#include "TObject.h"
+#include <vector>
+
+class StTrackEtaPhiGrid : public TObject
+{
+   public:
+             StTrackEtaPhiGrid();
+             StTrackEtaPhiGrid(Double_t etaMin, Double_t etaMax, Double_t cellSize);
+    virtual  ~StTrackEtaPhiGrid();
+
+    // per event: Clear(), AddTrack() for each accepted track, then Build()
+    void              Clear(Option_t *opt = "");
+    void              AddTrack(Int_t trackIndex, Double_t pt, Double_t eta, Double_t phi);
+    void              Build();
+
+    // identify the event the grid was built for
+    void              SetEvent(Int_t runId, Int_t eventId)          { fRunId = runId; fEventId = eventId; }
+    Bool_t            IsCurrent(Int_t runId, Int_t eventId) const   { return (fBuilt && fRunId == runId && fEventId == eventId); }
+
+    // queries: 'entries' is refilled with the entries (position in grid order) of the tracks found and
+    // 'deltaR', if given, with their distance to (eta, phi) - return number of tracks found
+    Int_t             FindInCone(Double_t eta, Double_t phi, Double_t radius,
+                                 std::vector<Int_t> &entries, std::vector<Double_t> *deltaR = 0x0) const;   // deltaR <= radius
+    Int_t             FindInAnnulus(Double_t eta, Double_t phi, Double_t rMin, Double_t rMax,
+                                    std::vector<Int_t> &entries, std::vector<Double_t> *deltaR = 0x0) const; // rMin < deltaR <= rMax
+    Int_t             FindInEtaStrip(Double_t eta, Double_t halfWidth, std::vector<Int_t> &entries) const;  // |eta_trk - eta| < halfWidth, all phi
+
+    // entry accessors - entries are grouped by cell
+    Int_t             GetNEntries() const                   { return (Int_t)fTrackIndex.size(); }
+    Int_t             GetTrackIndex(Int_t k) const          { return fTrackIndex[k]; }   // PicoDst track index
+    Float_t           GetPt(Int_t k) const                  { return fPt[k]; }
+    Float_t           GetEta(Int_t k) const                 { return fEta[k]; }
+    Float_t           GetPhi(Int_t k) const                 { return fPhi[k]; }          // (0, 2pi)
+
+    // geometry
+    Int_t             GetNEtaCells() const                  { return fNEta; }
+    Int_t             GetNPhiCells() const                  { return fNPhi; }
+
+   private:
+    void              SetGeometry(Double_t etaMin, Double_t etaMax, Double_t cellSize);
+    Int_t             EtaCell(Double_t eta) const;          // clamped to the grid
+    Int_t             PhiCell(Double_t phi) const;          // phi in (0, 2pi)
+
+    Bool_t            fBuilt;                       // CSR arrays built for current event
+    Int_t             fRunId;                       // run ID of event the grid was built for
+    Int_t             fEventId;                     // event ID of event the grid was built for
+
+    // geometry: tracks outside (fEtaMin, fEtaMax) go to the edge cells
+    Double_t          fEtaMin;                      // lower eta edge
+    Double_t          fEtaCellSize;                 // cell size in eta
+    Double_t          fPhiCellSize;                 // cell size in phi, 2pi/fNPhi
+    Int_t             fNEta;                        // number of eta cells
+    Int_t             fNPhi;                        // number of phi cells
+
+    std::vector<Int_t>   fCellOffset;               // CSR: start of each cell in the entry arrays, size fNEta*fNPhi + 1
+
+    // tracks in fill order
+    std::vector<Int_t>   fFillCell;
+    std::vector<Int_t>   fFillTrack;
+    std::vector<Float_t> fFillPt;
+    std::vector<Float_t> fFillEta;
+    std::vector<Float_t> fFillPhi;
+
+    // entries grouped by cell
+    std::vector<Int_t>   fTrackIndex;
+    std::vector<Float_t> fPt;
+    std::vector<Float_t> fEta;
+    std::vector<Float_t> fPhi;
+
+    ClassDef(StTrackEtaPhiGrid, 1)
+};
+#endif